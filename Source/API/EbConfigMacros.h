@@ -276,6 +276,24 @@
 #define CONFIG_SINGLE_THREAD_KERNEL         1
 #endif
 
+// Work-stealing kernel pool: at lp>1 and when enable_thread_pool is set, run every
+// pipeline kernel's _iter() on one shared set of workers instead of per-stage
+// threads. Runnable workers are bounded by the lp level, not by the stage count.
+// Builds on the _iter() entry points exported for CONFIG_SINGLE_THREAD_KERNEL.
+// Also backs the multi-worker SvtKernelDispatcher mode (dispatch_workers).
+#ifndef CONFIG_KERNEL_POOL
+#define CONFIG_KERNEL_POOL                  CONFIG_SINGLE_THREAD_KERNEL
+#endif
+
+// Lock-free object queues: with per-stage threads (lp>1, no kernel pool), back each
+// full EbMuxingQueue with a bounded MPMC ring instead of the mutex + per-process
+// semaphore hand-off. Waiters spin briefly, then park on one semaphore per queue.
+// Empty queues stay on the mutex path to keep their LIFO object recycling.
+// Set to 0 to keep the semaphore path everywhere.
+#ifndef CONFIG_LOCKFREE_FIFO
+#define CONFIG_LOCKFREE_FIFO                1
+#endif
+
 // Native 8-bit CDEF NEON path (interior blocks in uint8 lanes). ARM-only.
 #if defined(ARCH_AARCH64)
 #define CDEF_8BITS_PATH 1
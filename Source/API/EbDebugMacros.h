@@ -57,6 +57,8 @@ extern "C" {
 #define FTR_FRAME_RATE_ON_FLY_SAMPLE 0 // Sample functions to change frame rate
 #define FTR_PER_FRAME_QUALITY_SAMPLE 0 // Sample functions to compute PSNR per frame
 #define FTR_MG_SIZE_ON_FLY_SAMPLE    0 // Sample functions to change mini-GOP size on the fly
+#define FTR_THREAD_SCALE_SAMPLE      0 // Sample functions to change the active worker threads on the fly
+#define FTR_FRAME_TIMING_SAMPLE      0 // Sample functions to report the per-stage latency of a frame
 #endif
 // Super-resolution debugging code
 #define DEBUG_SCALING           0
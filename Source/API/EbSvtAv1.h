@@ -249,6 +249,9 @@ typedef enum {
     REF_CLEAR_EVENT, // Ref-frame management: release a previously STOREd pic_id (payload: SvtAv1RefFrameCmd)
     REF_USE_EVENT, // Ref-frame management: predict current frame from a STOREd ref (payload: SvtAv1RefFrameCmd)
     MG_SIZE_CHANGE_EVENT, //MG size change data per picture
+    THREAD_SCALE_EVENT, // Active worker thread count change (payload: SvtAv1ThreadScaleInfo)
+    FRAME_TIMING_EVENT, // Return per-stage timestamps with the packet (payload: SvtAv1FrameTimingInfo)
+    ME_FIELD_EVENT, // Seed motion estimation from an exported motion field (payload: SvtAv1MeField and its vectors)
     PRIVATE_DATA_TYPES // end of private data types
 } PrivDataType;
 
@@ -343,11 +346,87 @@ typedef struct SvtAv1MgSizeInfo {
     uint32_t hierarchical_levels;
 } SvtAv1MgSizeInfo;
 
+typedef struct SvtAv1ThreadScaleInfo {
+    // Percentage [1, 100] of the worker threads created at init that each
+    // multi-threaded stage keeps active, from this call onwards. Every stage
+    // keeps at least one worker; the others park until scaled back in.
+    uint32_t active_percent;
+} SvtAv1ThreadScaleInfo;
+
 typedef struct SvtAv1ComputeQualityInfo {
     bool compute_psnr;
     bool compute_ssim;
 } SvtAv1ComputeQualityInfo;
 
+typedef struct SvtAv1FrameTimingInfo {
+    bool record_timing;
+} SvtAv1FrameTimingInfo;
+
+// Pipeline stages timed by FRAME_TIMING_EVENT, in the order a frame goes through them
+typedef enum SvtAv1FrameStage {
+    SVT_AV1_FRAME_STAGE_INPUT, // taken from the input queue by resource coordination
+    SVT_AV1_FRAME_STAGE_ANALYSIS, // picture analysis
+    SVT_AV1_FRAME_STAGE_DECISION, // picture decision: mini-GOP buffering and temporal filtering
+    SVT_AV1_FRAME_STAGE_ME, // open-loop motion estimation
+    SVT_AV1_FRAME_STAGE_TPL, // temporal dependency model, when enabled
+    SVT_AV1_FRAME_STAGE_RC, // rate control
+    SVT_AV1_FRAME_STAGE_MD, // mode decision and encode
+    SVT_AV1_FRAME_STAGE_FILTER, // deblocking, cdef and restoration
+    SVT_AV1_FRAME_STAGE_EC, // entropy coding
+    SVT_AV1_FRAME_STAGE_PACKETIZATION, // packetization and reordering
+    SVT_AV1_FRAME_STAGE_OUTPUT, // packet made available to svt_av1_enc_get_packet()
+    SVT_AV1_FRAME_STAGE_COUNT
+} SvtAv1FrameStage;
+
+typedef struct SvtAv1FrameTiming {
+    // Monotonic time in microseconds at which the frame entered each stage
+    // (first segment or tile when the stage is split), 0 for a stage the
+    // frame skipped. The time spent in stage i is the next nonzero stamp
+    // minus stage_us[i].
+    uint64_t stage_us[SVT_AV1_FRAME_STAGE_COUNT];
+} SvtAv1FrameTiming;
+
+// References of a picture covered by an SvtAv1MeField: up to 4 per list
+#define SVT_AV1_ME_FIELD_MAX_REFS 8
+// Vector of a reference the block was not searched against
+#define SVT_AV1_ME_FIELD_INVALID_MV INT16_MIN
+
+// Blocks of a 64x64 block ME searches: itself, its 4 32x32, 16 16x16 and 64
+// 8x8 blocks
+#define SVT_AV1_ME_FIELD_BLOCKS 85
+
+typedef struct SvtAv1MeFieldMv {
+    int16_t  x; // full-pel
+    int16_t  y;
+    uint32_t sad; // of the block at this vector, as motion estimation measured it
+} SvtAv1MeFieldMv;
+
+// Open-loop motion field of a picture: the full-pel vector of each 64x64
+// block against each reference motion estimation searched. The vectors
+// follow the header in memory, b64_cols * b64_rows * ref_count * block_count
+// of them, by block in raster order, then by reference, then by sub-block.
+// With a block_count of SVT_AV1_ME_FIELD_BLOCKS the 64x64 vector is followed
+// by those of its smaller blocks, in the order of the encoder's motion
+// estimation. Exported through svt_av1_enc_set_me_field_sink() and imported
+// with ME_FIELD_EVENT, by an encode of the same source at the same or another
+// resolution. An encode at the same resolution with the same references
+// takes all the block vectors of such a field and skips its own search.
+typedef struct SvtAv1MeField {
+    uint64_t picture_number; // in the order the pictures were sent
+    uint16_t width; // luma size of the picture that was searched
+    uint16_t height;
+    uint16_t b64_cols;
+    uint16_t b64_rows;
+    uint8_t  ref_count; // list 0 references first, then list 1
+    uint8_t  block_count; // vectors per 64x64 block and reference: 1 or SVT_AV1_ME_FIELD_BLOCKS
+    uint64_t ref_picture_number[SVT_AV1_ME_FIELD_MAX_REFS];
+} SvtAv1MeField;
+
+#define SVT_AV1_ME_FIELD_SIZE(b64_cols, b64_rows, ref_count, block_count) \
+    (sizeof(SvtAv1MeField) +                                              \
+     (size_t)(b64_cols) * (b64_rows) * (ref_count) * (block_count) * sizeof(SvtAv1MeFieldMv))
+#define SVT_AV1_ME_FIELD_MVS(field) ((SvtAv1MeFieldMv*)((SvtAv1MeField*)(field) + 1))
+
 /*!\brief Structure containing film grain synthesis parameters for a frame
      *
      * This structure contains input parameters for film grain synthesis
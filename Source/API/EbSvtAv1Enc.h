@@ -143,10 +143,106 @@ typedef enum SvtAv1IntraRefreshType {
 typedef enum {
     SVT_AV1_STREAM_INFO_START                = 1,
     SVT_AV1_STREAM_INFO_FIRST_PASS_STATS_OUT = SVT_AV1_STREAM_INFO_START,
+    // SvtAv1PipelineProfile, needs pipeline_profile
+    SVT_AV1_STREAM_INFO_PIPELINE_PROFILE,
+    // SvtAv1FixedBuf holding Chrome trace JSON, needs pipeline_profile 2
+    SVT_AV1_STREAM_INFO_PIPELINE_TRACE,
+    // SvtAv1InputLayout, plane layout of input pictures lent with zero_copy_input
+    SVT_AV1_STREAM_INFO_INPUT_LAYOUT,
+    // SvtAv1PoolUsage, size and peak use of the picture pools
+    SVT_AV1_STREAM_INFO_POOL_USAGE,
+    // SvtAv1MemoryUsage, bytes allocated per encoder component
+    SVT_AV1_STREAM_INFO_MEMORY_USAGE,
 
     SVT_AV1_STREAM_INFO_END,
 } SVT_AV1_STREAM_INFO_ID;
 
+#define SVT_AV1_PROFILE_MAX_STAGES 16
+#define SVT_AV1_PROFILE_DEPTH_BINS 8
+
+/*!\brief Counters of one pipeline stage, summed over its threads
+ *
+ * A thread is busy from the moment it takes an object from its input queue
+ * until it asks for the next one, and waits while it blocks for input.
+ */
+typedef struct SvtAv1StageProfile {
+    const char* name; // stage name, as used by the thread_affinity groups
+    uint32_t    threads;
+    uint64_t    busy_us;
+    uint64_t    wait_us; // blocked on an empty input queue (or parked by THREAD_SCALE_EVENT)
+    uint64_t    objects; // objects taken from the input queue
+    uint32_t    max_queue_depth;
+    // Objects queued when a thread asked for input: bin 0 counts an empty
+    // queue, bin i a depth in [2^(i-1), 2^i) and the last bin anything deeper
+    uint64_t queue_depth_histogram[SVT_AV1_PROFILE_DEPTH_BINS];
+} SvtAv1StageProfile;
+
+typedef struct SvtAv1PipelineProfile {
+    uint32_t           stage_count;
+    SvtAv1StageProfile stages[SVT_AV1_PROFILE_MAX_STAGES];
+} SvtAv1PipelineProfile;
+
+/*!\brief Plane layout of an input picture the encoder can use in place
+ *
+ * Every plane holds a border of border pixels (border >> 1 for chroma) around
+ * the picture on each side, which the encoder writes. A frame is lent only
+ * when its y_stride, cb_stride and cr_stride match the ones below; luma,
+ * cb and cr then point at the top-left picture pixel, i.e. luma_offset and
+ * chroma_offset bytes into planes of luma_size and chroma_size bytes.
+ */
+typedef struct SvtAv1InputLayout {
+    uint32_t y_stride;
+    uint32_t uv_stride;
+    uint32_t border;
+    uint32_t luma_size;
+    uint32_t chroma_size;
+    uint32_t luma_offset;
+    uint32_t chroma_offset;
+} SvtAv1InputLayout;
+
+#define SVT_AV1_MAX_POOLS 10
+
+/*!\brief Object counts of one picture pool
+ */
+typedef struct SvtAv1PoolStats {
+    const char* name;
+    uint32_t    ceiling; // objects the pool may hold
+    uint32_t    allocated; // objects constructed, below ceiling only with lazy_pool_alloc
+    uint32_t    in_use;
+    uint32_t    peak_in_use;
+    uint64_t    huge_page_bytes; // picture memory of the constructed objects on huge pages, see huge_pages
+} SvtAv1PoolStats;
+
+typedef struct SvtAv1PoolUsage {
+    uint32_t        pool_count;
+    SvtAv1PoolStats pools[SVT_AV1_MAX_POOLS];
+} SvtAv1PoolUsage;
+
+/*!\brief Components the memory of the encoder is accounted to
+ */
+typedef enum SvtAv1MemoryCategory {
+    SVT_AV1_MEMORY_PICTURES, // input, analysis and reconstruction pictures and their control sets
+    SVT_AV1_MEMORY_REFERENCES, // reference, TPL reference and pre-analysis reference pictures
+    SVT_AV1_MEMORY_ME_CONTEXTS, // motion estimation results and contexts
+    SVT_AV1_MEMORY_MD_CONTEXTS, // mode decision and encode-decode contexts
+    SVT_AV1_MEMORY_NEIGHBOR_ARRAYS,
+    SVT_AV1_MEMORY_ENTROPY, // entropy coder contexts, bitstream and output buffers
+    SVT_AV1_MEMORY_TPL, // TPL statistics and contexts
+    SVT_AV1_MEMORY_OTHER,
+    SVT_AV1_MEMORY_CATEGORIES,
+} SvtAv1MemoryCategory;
+
+/*!\brief Bytes allocated per component, indexed by SvtAv1MemoryCategory
+ *
+ * Counts the memory of the long-lived objects when they are constructed,
+ * including the pool objects lazy_pool_alloc constructs later. Buffers taken
+ * and released while a picture is coded are not counted.
+ */
+typedef struct SvtAv1MemoryUsage {
+    uint64_t bytes[SVT_AV1_MEMORY_CATEGORIES];
+    uint64_t total;
+} SvtAv1MemoryUsage;
+
 /*!\brief Generic fixed size buffer structure
  *
  * This structure is able to hold a reference to any fixed size buffer.
@@ -1041,6 +1137,207 @@ typedef struct EbSvtAv1EncConfiguration {
      */
     uint8_t max_managed_refs;
 
+    /**
+     * @brief Core sets of the encoder threads, as ';'-separated entries of the
+     * form "[<group>@]<cpulist>", e.g. "0-7;encdec@8-15;ec@0-1;pkt@0-1". An
+     * entry without a group replaces the default core set of the handle
+     * (numa_node, pin_threads). Group entries apply to the threads of one
+     * pipeline stage and need per-stage threads (level of parallelism greater
+     * than 1 without a thread pool). Groups: rescoord, picana, picdec, me,
+     * irc, srcops, tpl, picmgr, rc, mdcfg, encdec, ec, dlf, cdef, rest, pkt.
+     *
+     * Owned by the caller: svt_av1_enc_set_parameter() parses it into the
+     * handle and neither keeps nor frees the string.
+     * svt_av1_enc_parse_parameter("thread-affinity", ...) allocates it like
+     * the frame_scale_evts lists.
+     *
+     * Default is NULL. */
+    char* thread_affinity;
+
+    /**
+     * @brief Number of shared pool workers allowed to run kernels at the same
+     * time, process-wide; the pool creates at most 2 more threads to take over
+     * from blocked kernels. The handle that creates the shared pool (the first
+     * to attach) sets it, 0 uses the number of logical processors. A later
+     * handle with a different non-zero value fails svt_av1_enc_init() with
+     * EB_ErrorBadParameter; 0 accepts the value already in use.
+     *
+     * Default is 0. */
+    uint32_t shared_pool_threads;
+
+    /**
+     * @brief Pin the encoder threads to the first N processors the process may
+     * run on (of the NUMA node when numa_node is set). When the level of
+     * parallelism is left at the default, it follows N.
+     *
+     * 0: no pinning (default)
+     * [1-]: number of processors
+     *
+     * Default is 0. */
+    uint32_t pin_threads;
+
+    /**
+     * @brief Memory budget of the picture pools and thread contexts in MiB.
+     * When what the configuration needs would not fit, the encoder lowers
+     * pool_headroom, then the number of picture control sets encoded in
+     * parallel, then the level of parallelism, then the look-ahead beyond the
+     * TPL window and finally the TPL window itself, and warns about each
+     * feature it degraded. The sizes are estimated from the resolution, bit
+     * depth and preset. A budget the shortest pipeline does not fit in fails
+     * svt_av1_enc_set_parameter(), and svt_av1_enc_init() fails with
+     * EB_ErrorInsufficientResources when what it allocated, as reported by
+     * SVT_AV1_STREAM_INFO_MEMORY_USAGE, is over the budget.
+     *
+     * Default is 0, no budget. */
+    uint32_t max_memory_mb;
+
+    /**
+     * @brief Run the pipeline kernels on one shared work-stealing pool instead
+     * of a dedicated set of threads per stage. Only used when the level of
+     * parallelism is greater than 1.
+     *
+     * false: per-stage threads (default)
+     * true: shared pool; concurrently running workers are bounded by the level
+     *       of parallelism, idle workers pick up whichever stage has queued work
+     *
+     * Default is false. */
+    bool enable_thread_pool;
+
+    /**
+     * @brief Number of workers that cooperatively drive the whole pipeline
+     * kernel table when the level of parallelism is greater than 1. Each stage
+     * is limited to this many kernel instances and a worker only runs a stage
+     * whose input FIFO has work queued. Takes precedence over enable_thread_pool.
+     *
+     * 0: disabled, threading follows level_of_parallelism (default)
+     * [1-8]: number of workers
+     *
+     * Default is 0. */
+    uint8_t dispatch_workers;
+
+    /**
+     * @brief Run the pipeline kernels on one worker pool shared by every
+     * encoder handle of the process that sets this flag, instead of creating
+     * threads per handle. Only used when the level of parallelism is greater
+     * than 1. Takes precedence over dispatch_workers and enable_thread_pool;
+     * dispatch_workers still limits the kernel instances per stage.
+     *
+     * Default is false. */
+    bool shared_thread_pool;
+
+    /**
+     * @brief Share of the shared pool this handle receives while other handles
+     * have work queued: CPU time is split in proportion to the weights.
+     *
+     * [1-255], default is 1. */
+    uint8_t thread_pool_weight;
+
+    /**
+     * @brief Hand objects between per-stage threads (level of parallelism
+     * greater than 1 without a thread pool) through lock-free rings instead of
+     * the mutex and semaphore queues. Ignored when the library is built
+     * without CONFIG_LOCKFREE_FIFO.
+     *
+     * Default is true. */
+    bool lockfree_fifo;
+
+    /**
+     * @brief NUMA node the handle is placed on. Every pipeline thread of the
+     * handle is pinned to the processors of the node, and the picture buffers
+     * and contexts are first-touched there so they are allocated from the
+     * node's memory. Hosts with several nodes run one handle per node. When
+     * left at the default, the level of parallelism follows the processor
+     * count of the node. Linux only, ignored with a warning elsewhere.
+     *
+     * -1: no placement, threads run wherever the OS schedules them (default)
+     * [0-63]: node index
+     *
+     * Default is -1. */
+    int8_t numa_node;
+
+    /**
+     * @brief Scheduler priority of the pipeline stages, for live encoding.
+     * Latency-critical serial stages (resource coordination, picture decision,
+     * initial rate control, picture manager, rate control, entropy coding and
+     * packetization) are raised over the bulk stages (analysis, motion
+     * estimation, TPL, enc-dec, loop filters). Raising needs privileges
+     * (CAP_SYS_NICE or root on Linux); without them only the bulk stages are
+     * lowered. Needs per-stage threads (level of parallelism greater than 1
+     * without a thread pool).
+     *
+     * 0: all threads at the default priority (default)
+     * 1: bulk stages at nice +5, latency-critical stages at nice -5
+     * 2: as 1, with latency-critical stages on SCHED_FIFO
+     *
+     * Default is 0. */
+    uint8_t thread_qos;
+
+    /**
+     * @brief Per-stage pipeline profiler. Records the busy and wait time, the
+     * objects processed and the input queue depths of every pipeline stage,
+     * returned by svt_av1_enc_get_stream_info(SVT_AV1_STREAM_INFO_PIPELINE_PROFILE).
+     * Level 2 also keeps the last busy spans of every thread for
+     * SVT_AV1_STREAM_INFO_PIPELINE_TRACE. Needs per-stage threads (level of
+     * parallelism greater than 1 without a thread pool).
+     *
+     * 0: off (default)
+     * 1: counters
+     * 2: counters and trace
+     *
+     * Default is 0. */
+    uint8_t pipeline_profile;
+
+    /**
+     * @brief Use the planes of 8-bit input pictures in place instead of
+     * copying them. Pictures sent with svt_av1_enc_send_picture_lent() in
+     * the layout of SVT_AV1_STREAM_INFO_INPUT_LAYOUT are referenced until
+     * the encoder is done with them, then handed back through the callback.
+     * The encoder writes the plane borders and, with temporal filtering,
+     * the pictures themselves. Other pictures are copied as usual.
+     *
+     * Default is 0. */
+    bool zero_copy_input;
+
+    /**
+     * @brief Allocate the input, picture control set and reference picture
+     * pools on demand. Each pool starts with one object and constructs more
+     * only when all of them are in use, up to the size set by pool_headroom;
+     * SVT_AV1_STREAM_INFO_POOL_USAGE reports how far each one grew.
+     *
+     * Default is 0. */
+    bool lazy_pool_alloc;
+
+    /**
+     * @brief Size of the input, picture control set, motion estimation and
+     * reference picture pools, as a percentage of the pictures the level of
+     * parallelism can keep in flight on top of the minimum the prediction
+     * structure needs. Lower values trade parallelism for memory.
+     *
+     * Default is 100. */
+    uint8_t pool_headroom;
+
+    /**
+     * @brief Back the input, reference and TPL reference pictures and the
+     * reconstructed pictures and quantized coefficients of the encode-decode
+     * sets with 2 MiB pages to cut TLB misses on large resolutions. Linux only; allocations fall back to
+     * regular pages when huge pages are not available, and
+     * SVT_AV1_STREAM_INFO_POOL_USAGE reports which pools got them.
+     * 0: regular pages
+     * 1: transparent huge pages, advised with madvise(MADV_HUGEPAGE)
+     * 2: pages reserved in the hugetlbfs pool (vm.nr_hugepages), then 1
+     *
+     * Default is 0. */
+    uint8_t huge_pages;
+
+    /**
+     * @brief Keep the 2 least significant bits of the 10-bit reference
+     * pictures 4 pixels per byte instead of one, cutting the reference
+     * pictures by 37.5%. Motion compensation expands the blocks it reads; the
+     * output is unchanged. Ignored for 8-bit input.
+     *
+     * Default is 0. */
+    bool compact_refs;
+
     // clang-format off
     /* Add 128 Byte Padding to Struct to avoid changing the size of the public configuration struct */
     uint8_t padding[128
@@ -1050,10 +1347,36 @@ typedef struct EbSvtAv1EncConfiguration {
         - sizeof(uint32_t) * 2 // max intra/inter bitrates
         - sizeof(bool) // enable_intrabc
         - sizeof(uint8_t) // max_managed_refs (ref-frame mgmt)
+        // The fields below go from largest to smallest, so the only alignment
+        // hole is the one in front of thread_affinity
+        - 6 // alignment of thread_affinity
+        - sizeof(char*) // thread_affinity
+        - sizeof(uint32_t) // shared_pool_threads
+        - sizeof(uint32_t) // pin_threads
+        - sizeof(uint32_t) // max_memory_mb
+        - sizeof(bool) // enable_thread_pool
+        - sizeof(uint8_t) // dispatch_workers
+        - sizeof(bool) // shared_thread_pool
+        - sizeof(uint8_t) // thread_pool_weight
+        - sizeof(bool) // lockfree_fifo
+        - sizeof(int8_t) // numa_node
+        - sizeof(uint8_t) // thread_qos
+        - sizeof(uint8_t) // pipeline_profile
+        - sizeof(bool) // zero_copy_input
+        - sizeof(bool) // lazy_pool_alloc
+        - sizeof(uint8_t) // pool_headroom
+        - sizeof(uint8_t) // huge_pages
+        - sizeof(bool) // compact_refs
     ];
     // clang-format on
 } EbSvtAv1EncConfiguration;
 
+#if !defined(__cplusplus) && UINTPTR_MAX == UINT64_MAX && \
+    (defined(__GNUC__) || (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L))
+/* The padding above keeps the size applications were built against */
+_Static_assert(sizeof(EbSvtAv1EncConfiguration) == 664, "EbSvtAv1EncConfiguration changed size");
+#endif
+
 /**
  * Returns a string containing "v$tag-$commit_count-g$hash${dirty:+-dirty}"
  * @param[out] SVT_AV1_CVS_VERSION
@@ -1119,6 +1442,31 @@ EB_API EbErrorType svt_av1_enc_init_handle(
     EbComponentType**         p_handle,
     EbSvtAv1EncConfiguration* config_ptr); // config_ptr will be loaded with default params from the library
 
+/* OPTIONAL: Construct a Component Handle from an existing one, e.g. for the
+     * rungs of an ABR ladder. Like svt_av1_enc_init_handle(), every field of
+     * *config_ptr is overwritten, here with the configuration last passed to
+     * svt_av1_enc_set_parameter() on src_handle instead of the defaults, so
+     * that only what differs per rung (resolution, rate) has to be set before
+     * svt_av1_enc_set_parameter() and svt_av1_enc_init() on the new handle.
+     * The output allocator of src_handle is kept. The lists and strings the
+     * caller owns (frame_scale_evts, sframe_posi, thread_affinity) and
+     * rc_stats_buffer are left NULL.
+     *
+     * The rate, CDF, quantizer (unless sharpness is set) and quantization
+     * matrix tables are static or built once per process, so every handle
+     * shares them whether it is cloned or not. The only table built per handle
+     * is the block geometry, which the new handle takes from src_handle when
+     * the new configuration needs the same one; src_handle may be deinitialized
+     * before the new handle. The picture pools depend on the resolution of
+     * each rung and are always allocated by svt_av1_enc_init().
+     *
+     * Parameter:
+     * @ **p_handle      Handle of the new component.
+     * @ *src_handle     Configured component to copy.
+     * @ *config_ptr     Overwritten with the configuration of src_handle. */
+EB_API EbErrorType svt_av1_enc_clone_handle(EbComponentType** p_handle, EbComponentType* src_handle,
+                                            EbSvtAv1EncConfiguration* config_ptr);
+
 /* STEP 2: Set all configuration parameters.
      *
      * Parameter:
@@ -1138,6 +1486,59 @@ EB_API EbErrorType svt_av1_enc_set_parameter(
 EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration* pComponentParameterStructure, const char* name,
                                                const char* value);
 
+/**
+ * @brief Allocator of the memory the output packets are written to
+ *
+ * The encoder writes each packet, i.e. the OBUs of a temporal unit, into one
+ * buffer of this allocator, so that the application can hand it to its muxer
+ * without copying it. alloc is called from an encoder thread and returns a
+ * buffer of at least size bytes, or NULL to let the encoder allocate that
+ * packet itself. release is called by svt_av1_enc_release_out_buffer() with
+ * a buffer alloc returned. alloc is called in the order the packets come out
+ * of svt_av1_enc_get_packet(), so a ring buffer fits when the application
+ * releases the packets in that order too.
+ */
+typedef struct SvtAv1OutputAllocator {
+    void* ctx; // passed back to alloc and release
+    uint8_t* (*alloc)(void* ctx, uint32_t size);
+    void (*release)(void* ctx, uint8_t* buffer);
+} SvtAv1OutputAllocator;
+
+/* OPTIONAL: Write the output packets into application memory.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *allocator          Copied by the library; NULL restores the library allocation.
+     *                       To be called before svt_av1_enc_init(). */
+EB_API EbErrorType svt_av1_enc_set_output_allocator(EbComponentType*             svt_enc_component,
+                                                    const SvtAv1OutputAllocator* allocator);
+
+/**
+ * @brief Receiver of the open-loop motion fields of an encode
+ *
+ * write is called once per picture that goes through open-loop motion
+ * estimation, from an encoder thread, in the order the pictures finish it
+ * rather than the order they were sent. Calls are never concurrent. field and
+ * its vectors, size bytes in all, are only valid during the call. Another
+ * encode can be seeded with them through ME_FIELD_EVENT.
+ */
+typedef struct SvtAv1MeFieldSink {
+    void* ctx; // passed back to write
+    void (*write)(void* ctx, const SvtAv1MeField* field, uint32_t size);
+    // Also export the vectors of the 32x32, 16x16 and 8x8 blocks, so that an
+    // encode of the same source at the same resolution, a rung of the same
+    // ladder at another rate, can skip its motion search
+    bool all_blocks;
+} SvtAv1MeFieldSink;
+
+/* OPTIONAL: Export the open-loop motion field of every picture.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *sink               Copied by the library; NULL stops the export.
+     *                       To be called before svt_av1_enc_init(). */
+EB_API EbErrorType svt_av1_enc_set_me_field_sink(EbComponentType* svt_enc_component, const SvtAv1MeFieldSink* sink);
+
 /* STEP 3: Initialize encoder and allocates memory to necessary buffers.
      *
      * Parameter:
@@ -1165,6 +1566,21 @@ EB_API EbErrorType svt_av1_enc_stream_header_release(EbBufferHeaderType* stream_
      * @ *p_buffer           Header pointer, picture buffer. */
 EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component, EbBufferHeaderType* p_buffer);
 
+/* OPTIONAL: Send the picture, lending its planes to the encoder when it runs
+     * with zero_copy_input. release_cb is called with release_ctx exactly once,
+     * from any encoder thread, when the encoder no longer references the
+     * planes: right away when they were copied (zero_copy_input off, a layout
+     * other than SVT_AV1_STREAM_INFO_INPUT_LAYOUT, a rejected picture), before
+     * svt_av1_enc_deinit() returns otherwise.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *p_buffer           Header pointer, picture buffer.
+     * @ release_cb          Called once the planes are free again, must not be NULL.
+     * @ *release_ctx        Passed to release_cb. */
+EB_API EbErrorType svt_av1_enc_send_picture_lent(EbComponentType* svt_enc_component, EbBufferHeaderType* p_buffer,
+                                                 void (*release_cb)(void* release_ctx), void* release_ctx);
+
 /**
  * @brief Step 5: Receive packet.
  * This function will become blocking if either pic_send_done is set to 1 or if we are in low-delay (pred-struct=1).
@@ -1184,6 +1600,16 @@ EB_API EbErrorType svt_av1_enc_get_packet(EbComponentType* svt_enc_component, Eb
      * @ **p_buffer          Header pointer that contains the output packet to be released. */
 EB_API void svt_av1_enc_release_out_buffer(EbBufferHeaderType** p_buffer);
 
+/* OPTIONAL: Read the per-stage timestamps of a packet whose picture was sent
+     * with a FRAME_TIMING_EVENT node. Valid until the packet is released.
+     *
+     * Parameter:
+     * @ *packet             Packet returned by svt_av1_enc_get_packet().
+     * @ *timing             Loaded with the timestamps of the packet.
+     * @return EB_NoErrorEmptyQueue when the packet carries no timestamps,
+     * EB_ErrorBadParameter when packet does not come from svt_av1_enc_get_packet(). */
+EB_API EbErrorType svt_av1_enc_get_packet_timing(const EbBufferHeaderType* packet, SvtAv1FrameTiming* timing);
+
 /* OPTIONAL: Fill buffer with reconstructed picture.
      *
      * Parameter:
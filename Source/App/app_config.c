@@ -56,6 +56,10 @@
 #define TWO_PASS_STATS_TOKEN "--stats"
 #define PASSES_TOKEN "--passes"
 #define STAT_FILE_TOKEN "--stat-file"
+#define PROFILE_TRACE_FILE_TOKEN "--profile-trace-file"
+#define ME_FIELD_OUT_FILE_TOKEN "--me-field-out"
+#define ME_FIELD_IN_FILE_TOKEN "--me-field-in"
+#define ME_FIELD_ALL_BLOCKS_TOKEN "--me-field-all-blocks"
 #define WIDTH_TOKEN "-w"
 #define HEIGHT_TOKEN "-h"
 #define NUMBER_OF_PICTURES_TOKEN "-n"
@@ -139,6 +143,22 @@
 #define INJECTOR_FRAMERATE_TOKEN "--inj-frm-rt" // no Eval
 #define ASM_TYPE_TOKEN "--asm"
 #define THREAD_MGMNT "--lp"
+#define THREAD_POOL_TOKEN "--thread-pool"
+#define DISPATCH_WORKERS_TOKEN "--dispatch-workers"
+#define SHARED_THREAD_POOL_TOKEN "--shared-thread-pool"
+#define THREAD_POOL_WEIGHT_TOKEN "--thread-pool-weight"
+#define SHARED_POOL_THREADS_TOKEN "--shared-pool-threads"
+#define LOCKFREE_FIFO_TOKEN "--lockfree-fifo"
+#define NUMA_NODE_TOKEN "--numa-node"
+#define PIN_THREADS_TOKEN "--pin"
+#define THREAD_AFFINITY_TOKEN "--thread-affinity"
+#define THREAD_QOS_TOKEN "--thread-qos"
+#define PIPELINE_PROFILE_TOKEN "--pipeline-profile"
+#define LAZY_POOL_ALLOC_TOKEN "--lazy-pool-alloc"
+#define POOL_HEADROOM_TOKEN "--pool-headroom"
+#define MAX_MEMORY_MB_TOKEN "--max-memory-mb"
+#define HUGE_PAGES_TOKEN "--huge-pages"
+#define COMPACT_REFS_TOKEN "--compact-refs"
 
 //double dash
 #define PRESET_TOKEN "--preset"
@@ -449,6 +469,28 @@ static EbErrorType set_cfg_stat_file(EbConfig* cfg, const char* token, const cha
     return open_file(&cfg->stat_file, token, value, "wb");
 }
 
+static EbErrorType set_cfg_profile_trace_file(EbConfig* cfg, const char* token, const char* value) {
+    return open_file(&cfg->profile_trace_file, token, value, "wb");
+}
+
+static EbErrorType set_cfg_me_field_out_file(EbConfig* cfg, const char* token, const char* value) {
+    return open_file(&cfg->me_field_out_file, token, value, "wb");
+}
+
+static EbErrorType set_cfg_me_field_in_file(EbConfig* cfg, const char* token, const char* value) {
+    return open_file(&cfg->me_field_in_file, token, value, "rb");
+}
+
+static EbErrorType set_cfg_me_field_all_blocks(EbConfig* cfg, const char* token, const char* value) {
+    uint32_t    all_blocks = 0;
+    EbErrorType err        = str_to_uint(token, value, &all_blocks);
+    if (err == EB_ErrorNone && all_blocks > 1) {
+        return validate_error(EB_ErrorBadParameter, token, value);
+    }
+    cfg->me_field_all_blocks = all_blocks;
+    return err;
+}
+
 static EbErrorType set_cfg_roi_map_file(EbConfig* cfg, const char* token, const char* value) {
     return open_file(&cfg->roi_map_file, token, value, "r");
 }
@@ -726,6 +768,13 @@ ConfigDescription config_entry_options[] = {
     {OUTPUT_RECON_LONG_TOKEN, "Reconstructed yuv file path"},
 
     {STAT_FILE_TOKEN, "PSNR / SSIM per picture stat output file path, requires `--enable-stat-report 1`"},
+    {PROFILE_TRACE_FILE_TOKEN,
+     "Chrome trace JSON output file path of the pipeline stages, requires `" PIPELINE_PROFILE_TOKEN " 2`"},
+    {ME_FIELD_OUT_FILE_TOKEN, "Open-loop motion field output file path, to seed the ME of another encode"},
+    {ME_FIELD_IN_FILE_TOKEN, "Open-loop motion field input file path, written by `" ME_FIELD_OUT_FILE_TOKEN "`"},
+    {ME_FIELD_ALL_BLOCKS_TOKEN,
+     "Write the vectors of every block to `" ME_FIELD_OUT_FILE_TOKEN
+     "`, for encodes at the same resolution to skip ME, default is 0 [0-1]"},
 
     {PROGRESS_TOKEN, "Verbosity of the output, default is 1 [0: no progress is printed, 2: detailed progress]"},
     {NO_PROGRESS_TOKEN,
@@ -790,6 +839,43 @@ ConfigDescription config_entry_global_options[] = {
     {THREAD_MGMNT,
      "Amount of parallelism to use. 0 means choose the level based on machine core count. Refer to Appendix A.1 "
      "of the user guide, default is 0 [0, 6]"},
+    {THREAD_POOL_TOKEN,
+     "Run all pipeline stages on one shared work-stealing thread pool (lp > 1 only), default is 0 [0-1]"},
+    {DISPATCH_WORKERS_TOKEN,
+     "Drive all pipeline stages with N cooperative workers, 0 is off (lp > 1 only), default is 0 [0-8]"},
+    {SHARED_THREAD_POOL_TOKEN,
+     "Run all pipeline stages on one worker pool shared by every encoder of the process (lp > 1 only), default is 0 "
+     "[0-1]"},
+    {THREAD_POOL_WEIGHT_TOKEN, "Share of the shared worker pool given to this encoder, default is 1 [1-255]"},
+    {SHARED_POOL_THREADS_TOKEN,
+     "Shared worker pool workers running at once, 0 is the logical processor count, default is 0 [0-]"},
+    {LOCKFREE_FIFO_TOKEN,
+     "Hand work between per-stage threads through lock-free rings, 0 uses the mutex and semaphore queues, default "
+     "is 1 [0-1]"},
+    {NUMA_NODE_TOKEN,
+     "Pin the encoder threads to a NUMA node and allocate its buffers there, -1 is off, default is -1 [-1-63]"},
+    {PIN_THREADS_TOKEN, "Pin the encoder threads to the first N processors, 0 is off, default is 0 [0-]"},
+    {THREAD_AFFINITY_TOKEN,
+     "Core sets of the encoder threads, ';'-separated \"[group@]cpulist\" entries, e.g. \"0-7;encdec@8-15\""},
+    {THREAD_QOS_TOKEN,
+     "Raise latency-critical stages over bulk stages, 0: off, 1: nice levels, 2: SCHED_FIFO for latency-critical "
+     "stages, default is 0 [0-2]"},
+    {PIPELINE_PROFILE_TOKEN,
+     "Print the busy and wait time and queue depths of every pipeline stage, 0: off, 1: counters, 2: counters and "
+     "trace, default is 0 [0-2]"},
+    {LAZY_POOL_ALLOC_TOKEN,
+     "Allocate the picture pools on demand and print their peak use at the end, default is 0 [0-1]"},
+    {POOL_HEADROOM_TOKEN,
+     "Size of the picture pools above the minimum the prediction structure needs, in percent of what the level of "
+     "parallelism uses, default is 100 [0-100]"},
+    {MAX_MEMORY_MB_TOKEN,
+     "Memory budget of the picture pools in MiB, lowers parallelism, look-ahead and the TPL window to fit, default is "
+     "0 [0: no budget]"},
+    {HUGE_PAGES_TOKEN,
+     "Back the picture buffers with 2 MiB pages and print which pools got them at the end, 0: off, 1: transparent "
+     "huge pages, 2: hugetlbfs pool then transparent huge pages, default is 0 [0-2]"},
+    {COMPACT_REFS_TOKEN,
+     "Keep the 2 least significant bits of the 10-bit reference pictures 4 pixels per byte, default is 0 [0-1]"},
     // Termination
     {NULL, NULL}};
 
@@ -1062,6 +1148,10 @@ ConfigEntry config_entry[] = {
     {OUTPUT_RECON_TOKEN, "ReconFile", set_cfg_recon_file},
     {OUTPUT_RECON_LONG_TOKEN, "ReconFile", set_cfg_recon_file},
     {STAT_FILE_TOKEN, "StatFile", set_cfg_stat_file},
+    {PROFILE_TRACE_FILE_TOKEN, "ProfileTraceFile", set_cfg_profile_trace_file},
+    {ME_FIELD_OUT_FILE_TOKEN, "MeFieldOutFile", set_cfg_me_field_out_file},
+    {ME_FIELD_IN_FILE_TOKEN, "MeFieldInFile", set_cfg_me_field_in_file},
+    {ME_FIELD_ALL_BLOCKS_TOKEN, "MeFieldAllBlocks", set_cfg_me_field_all_blocks},
     {PROGRESS_TOKEN, "Progress", set_progress},
     {NO_PROGRESS_TOKEN, "NoProgress", set_no_progress},
     {PRESET_TOKEN, "EncoderMode", set_cfg_generic_token},
@@ -1105,6 +1195,22 @@ ConfigEntry config_entry[] = {
 
     //   Thread Management
     {THREAD_MGMNT, "LevelOfParallelism", set_cfg_generic_token},
+    {THREAD_POOL_TOKEN, "ThreadPool", set_cfg_generic_token},
+    {DISPATCH_WORKERS_TOKEN, "DispatchWorkers", set_cfg_generic_token},
+    {SHARED_THREAD_POOL_TOKEN, "SharedThreadPool", set_cfg_generic_token},
+    {THREAD_POOL_WEIGHT_TOKEN, "ThreadPoolWeight", set_cfg_generic_token},
+    {SHARED_POOL_THREADS_TOKEN, "SharedPoolThreads", set_cfg_generic_token},
+    {LOCKFREE_FIFO_TOKEN, "LockfreeFifo", set_cfg_generic_token},
+    {NUMA_NODE_TOKEN, "NumaNode", set_cfg_generic_token},
+    {PIN_THREADS_TOKEN, "PinThreads", set_cfg_generic_token},
+    {THREAD_AFFINITY_TOKEN, "ThreadAffinity", set_cfg_generic_token},
+    {THREAD_QOS_TOKEN, "ThreadQos", set_cfg_generic_token},
+    {PIPELINE_PROFILE_TOKEN, "PipelineProfile", set_cfg_generic_token},
+    {LAZY_POOL_ALLOC_TOKEN, "LazyPoolAlloc", set_cfg_generic_token},
+    {POOL_HEADROOM_TOKEN, "PoolHeadroom", set_cfg_generic_token},
+    {MAX_MEMORY_MB_TOKEN, "MaxMemoryMb", set_cfg_generic_token},
+    {HUGE_PAGES_TOKEN, "HugePages", set_cfg_generic_token},
+    {COMPACT_REFS_TOKEN, "CompactRefs", set_cfg_generic_token},
 
     // Rate Control Options
     {RATE_CONTROL_ENABLE_TOKEN, "RateControlMode", set_cfg_generic_token},
@@ -1333,6 +1439,11 @@ void svt_config_dtor(EbConfig* app_cfg) {
         app_cfg->stat_file = NULL;
     }
 
+    if (app_cfg->profile_trace_file) {
+        fclose(app_cfg->profile_trace_file);
+        app_cfg->profile_trace_file = NULL;
+    }
+
     if (app_cfg->output_stat_file) {
         fclose(app_cfg->output_stat_file);
         app_cfg->output_stat_file = NULL;
@@ -1343,6 +1454,16 @@ void svt_config_dtor(EbConfig* app_cfg) {
         app_cfg->roi_map_file = NULL;
     }
 
+    if (app_cfg->me_field_out_file) {
+        fclose(app_cfg->me_field_out_file);
+        app_cfg->me_field_out_file = NULL;
+    }
+
+    if (app_cfg->me_field_in_file) {
+        fclose(app_cfg->me_field_in_file);
+        app_cfg->me_field_in_file = NULL;
+    }
+
     if (app_cfg->fgs_table_path) {
         free(app_cfg->fgs_table_path);
         app_cfg->fgs_table_path = NULL;
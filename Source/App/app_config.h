@@ -140,6 +140,7 @@ typedef struct EbConfig {
     FILE*      recon_file;
     FILE*      error_log_file;
     FILE*      stat_file;
+    FILE*      profile_trace_file;
     FILE*      qp_file;
     /* two pass */
     const char* stats;
@@ -200,6 +201,12 @@ typedef struct EbConfig {
     FILE*         roi_map_file;
     SvtAv1RoiMap* roi_map;
 
+    FILE*           me_field_out_file;
+    FILE*           me_field_in_file;
+    bool            me_field_all_blocks; // export every block vector, not only the 64x64 ones
+    SvtAv1MeField** me_fields; // imported fields by picture number, NULL where missing
+    uint64_t        me_field_count;
+
     char* fgs_table_path;
 } EbConfig;
 
@@ -88,7 +88,7 @@ static EbErrorType allocate_input_buffers(EbConfig* app_cfg) {
     // Initialize Header
     app_cfg->input_buffer_pool->size = sizeof(EbBufferHeaderType);
 
-    EbSvtIOFormat* p_buffer = malloc(sizeof(EbSvtIOFormat));
+    EbSvtIOFormat* p_buffer = calloc(1, sizeof(EbSvtIOFormat));
 
     if (p_buffer == NULL) {
         return EB_ErrorInsufficientResources;
@@ -386,6 +386,66 @@ fail:
     return ret;
 }
 
+// Motion field file: ME_FIELD_FILE_MAGIC, then per picture the size of the
+// field and the field as svt_av1_enc_set_me_field_sink() returns it
+#define ME_FIELD_FILE_MAGIC "SVTMEF02"
+
+static void write_me_field(void* ctx, const SvtAv1MeField* field, uint32_t size) {
+    FILE* file = (FILE*)ctx;
+    fwrite(&size, sizeof(size), 1, file);
+    fwrite(field, 1, size, file);
+}
+
+// Read the fields of me_field_in_file, by picture number
+EbErrorType load_me_fields(EbConfig* app_cfg) {
+    FILE* file = app_cfg->me_field_in_file;
+    char  magic[sizeof(ME_FIELD_FILE_MAGIC) - 1];
+    if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) || memcmp(magic, ME_FIELD_FILE_MAGIC, sizeof(magic))) {
+        fprintf(stderr, "Error: Invalid motion field file - missing header\n");
+        return EB_ErrorBadParameter;
+    }
+    uint32_t size;
+    while (fread(&size, sizeof(size), 1, file) == 1) {
+        SvtAv1MeField* field = size >= sizeof(*field) ? (SvtAv1MeField*)malloc(size) : NULL;
+        if (!field || fread(field, 1, size, file) != size || field->ref_count > SVT_AV1_ME_FIELD_MAX_REFS ||
+            size != SVT_AV1_ME_FIELD_SIZE(field->b64_cols, field->b64_rows, field->ref_count, field->block_count)) {
+            free(field);
+            fprintf(stderr, "Error: Invalid motion field file - truncated or malformed field\n");
+            return EB_ErrorBadParameter;
+        }
+        if (field->picture_number >= app_cfg->me_field_count) {
+            const uint64_t  count  = field->picture_number + 1;
+            SvtAv1MeField** fields = (SvtAv1MeField**)realloc(app_cfg->me_fields, count * sizeof(*fields));
+            if (!fields) {
+                free(field);
+                return EB_ErrorInsufficientResources;
+            }
+            memset(fields + app_cfg->me_field_count, 0, (count - app_cfg->me_field_count) * sizeof(*fields));
+            app_cfg->me_fields      = fields;
+            app_cfg->me_field_count = count;
+        }
+        free(app_cfg->me_fields[field->picture_number]);
+        app_cfg->me_fields[field->picture_number] = field;
+    }
+    return EB_ErrorNone;
+}
+
+// Write the field of every picture to me_field_out_file
+EbErrorType export_me_fields(EbConfig* app_cfg) {
+    const SvtAv1MeFieldSink sink = {app_cfg->me_field_out_file, write_me_field, app_cfg->me_field_all_blocks};
+    fwrite(ME_FIELD_FILE_MAGIC, 1, sizeof(ME_FIELD_FILE_MAGIC) - 1, app_cfg->me_field_out_file);
+    return svt_av1_enc_set_me_field_sink(app_cfg->svt_encoder_handle, &sink);
+}
+
+void release_me_fields(EbConfig* app_cfg) {
+    for (uint64_t i = 0; i < app_cfg->me_field_count; ++i) {
+        free(app_cfg->me_fields[i]);
+    }
+    free(app_cfg->me_fields);
+    app_cfg->me_fields      = NULL;
+    app_cfg->me_field_count = 0;
+}
+
 static void deallocate_buffers(EbConfig* app_cfg) {
     // Deallocate input buffers
     if (app_cfg->input_buffer_pool) {
@@ -414,6 +474,9 @@ static void deallocate_buffers(EbConfig* app_cfg) {
         }
         free(app_cfg->sequence_buffer);
     }
+
+    // Deallocate imported motion fields
+    release_me_fields(app_cfg);
 }
 
 /***************************************
@@ -436,6 +499,22 @@ EbErrorType init_encoder(EbConfig* app_cfg) {
         }
     }
 
+    if (app_cfg->me_field_in_file != NULL) {
+        // Load the motion fields to seed ME with
+        EbErrorType return_error = load_me_fields(app_cfg);
+        if (return_error != EB_ErrorNone) {
+            return return_error;
+        }
+    }
+
+    if (app_cfg->me_field_out_file != NULL) {
+        // Export the motion fields
+        EbErrorType return_error = export_me_fields(app_cfg);
+        if (return_error != EB_ErrorNone) {
+            return return_error;
+        }
+    }
+
     // Send over all configuration parameters
     // Set the Parameters
     EbErrorType return_error = svt_av1_enc_set_parameter(app_cfg->svt_encoder_handle, &app_cfg->config);
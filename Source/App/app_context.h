@@ -21,4 +21,9 @@
 EbErrorType init_encoder(EbConfig* app_cfg);
 EbErrorType de_init_encoder(EbConfig* app_cfg);
 
+/* Motion field files of --me-field-in and --me-field-out */
+EbErrorType load_me_fields(EbConfig* app_cfg);
+EbErrorType export_me_fields(EbConfig* app_cfg);
+void        release_me_fields(EbConfig* app_cfg);
+
 #endif // EbAppContext_h
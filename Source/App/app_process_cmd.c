@@ -627,6 +627,65 @@ static EbErrorType test_update_mg_size_info(uint64_t pic_num, EbBufferHeaderType
     return EB_ErrorNone;
 }
 #endif
+#if FTR_THREAD_SCALE_SAMPLE
+// test_update_thread_scale_info: sample test case for scaling the active worker threads on the fly.
+// Drops to a quarter of the workers every 'interval' frames and restores all of them after another.
+static EbErrorType test_update_thread_scale_info(uint64_t pic_num, EbBufferHeaderType* header_ptr) {
+    int interval = 150;
+    if (pic_num == 0 || pic_num % interval != 0) {
+        return EB_ErrorNone;
+    }
+    SvtAv1ThreadScaleInfo* data = (SvtAv1ThreadScaleInfo*)malloc(sizeof(SvtAv1ThreadScaleInfo));
+    data->active_percent        = (pic_num / interval) % 2 ? 25 : 100;
+    EbPrivDataNode* new_node    = (EbPrivDataNode*)malloc(sizeof(EbPrivDataNode));
+    new_node->size              = sizeof(SvtAv1ThreadScaleInfo);
+    new_node->node_type         = THREAD_SCALE_EVENT;
+    new_node->data              = data;
+    new_node->next              = NULL;
+
+    // append to tail
+    if (header_ptr->p_app_private == NULL) {
+        header_ptr->p_app_private = new_node;
+    } else {
+        EbPrivDataNode* last = header_ptr->p_app_private;
+        while (last->next != NULL) {
+            last = last->next;
+        }
+        last->next = new_node;
+    }
+
+    return EB_ErrorNone;
+}
+#endif
+#if FTR_FRAME_TIMING_SAMPLE
+// test_update_frame_timing_info: sample test case for requesting the stage timestamps of a frame
+static EbErrorType test_update_frame_timing_info(uint64_t pic_num, EbBufferHeaderType* header_ptr) {
+    int interval = 10;
+    if (pic_num % interval != 0) {
+        return EB_ErrorNone;
+    }
+    SvtAv1FrameTimingInfo* data = (SvtAv1FrameTimingInfo*)malloc(sizeof(SvtAv1FrameTimingInfo));
+    data->record_timing         = true;
+    EbPrivDataNode* new_node    = (EbPrivDataNode*)malloc(sizeof(EbPrivDataNode));
+    new_node->size              = sizeof(SvtAv1FrameTimingInfo);
+    new_node->node_type         = FRAME_TIMING_EVENT;
+    new_node->data              = data;
+    new_node->next              = NULL;
+
+    // append to tail
+    if (header_ptr->p_app_private == NULL) {
+        header_ptr->p_app_private = new_node;
+    } else {
+        EbPrivDataNode* last = header_ptr->p_app_private;
+        while (last->next != NULL) {
+            last = last->next;
+        }
+        last->next = new_node;
+    }
+
+    return EB_ErrorNone;
+}
+#endif
 
 static EbErrorType retrieve_roi_map_event(SvtAv1RoiMap* roi_map, uint64_t pic_num, EbBufferHeaderType* header_ptr) {
     if (roi_map == NULL || roi_map->evt_list == NULL) {
@@ -667,6 +726,41 @@ static EbErrorType retrieve_roi_map_event(SvtAv1RoiMap* roi_map, uint64_t pic_nu
     return EB_ErrorNone;
 }
 
+// Attach the imported motion field of the picture, if any, to seed its ME
+static EbErrorType retrieve_me_field_event(EbConfig* app_cfg, uint64_t pic_num, EbBufferHeaderType* header_ptr) {
+    if (pic_num >= app_cfg->me_field_count || app_cfg->me_fields[pic_num] == NULL) {
+        return EB_ErrorNone;
+    }
+    const SvtAv1MeField* field = app_cfg->me_fields[pic_num];
+    const uint32_t       size  = (uint32_t)SVT_AV1_ME_FIELD_SIZE(
+        field->b64_cols, field->b64_rows, field->ref_count, field->block_count);
+    EbPrivDataNode* new_node = (EbPrivDataNode*)malloc(sizeof(EbPrivDataNode));
+    void*           data     = malloc(size);
+    if (new_node == NULL || data == NULL) {
+        free(new_node);
+        free(data);
+        return EB_ErrorInsufficientResources;
+    }
+    memcpy(data, field, size);
+    new_node->size      = size;
+    new_node->node_type = ME_FIELD_EVENT;
+    new_node->data      = data;
+    new_node->next      = NULL;
+
+    // append to tail
+    if (header_ptr->p_app_private == NULL) {
+        header_ptr->p_app_private = new_node;
+    } else {
+        EbPrivDataNode* last = header_ptr->p_app_private;
+        while (last->next != NULL) {
+            last = last->next;
+        }
+        last->next = new_node;
+    }
+
+    return EB_ErrorNone;
+}
+
 static void free_private_data_list(void* node_head) {
     while (node_head) {
         EbPrivDataNode* node = (EbPrivDataNode*)node_head;
@@ -753,8 +847,15 @@ void process_input_buffer(EncChannel* channel) {
 #endif
 #if FTR_MG_SIZE_ON_FLY_SAMPLE
             test_update_mg_size_info(header_ptr->pts, header_ptr);
+#endif
+#if FTR_THREAD_SCALE_SAMPLE
+            test_update_thread_scale_info(header_ptr->pts, header_ptr);
+#endif
+#if FTR_FRAME_TIMING_SAMPLE
+            test_update_frame_timing_info(header_ptr->pts, header_ptr);
 #endif
             retrieve_roi_map_event(app_cfg->roi_map, header_ptr->pts, header_ptr);
+            retrieve_me_field_event(app_cfg, header_ptr->pts, header_ptr);
             // Send the picture
             if (svt_av1_enc_send_picture(component_handle, header_ptr) != EB_ErrorNone) {
                 return_value = APP_ExitConditionFinished;
@@ -1033,6 +1134,106 @@ void process_output_statistics_buffer(EbBufferHeaderType* header_ptr, EbConfig*
     }
 }
 
+// Print how long the frame spent in each stage: up to the next stage it went through
+static void report_frame_timing(const EbBufferHeaderType* header_ptr, const SvtAv1FrameTiming* timing) {
+    static const char* const stage_names[SVT_AV1_FRAME_STAGE_COUNT] = {
+        "input", "analysis", "decision", "me", "tpl", "rc", "md", "filter", "ec", "packetization", "output"};
+    const uint64_t* stage_us = timing->stage_us;
+    fprintf(stderr, "\nSVT [timing]: pts %lld:", (long long)header_ptr->pts);
+    int prev = SVT_AV1_FRAME_STAGE_INPUT;
+    for (int stage = SVT_AV1_FRAME_STAGE_INPUT + 1; stage < SVT_AV1_FRAME_STAGE_COUNT; stage++) {
+        if (!stage_us[stage]) {
+            continue;
+        }
+        fprintf(stderr, " %s %.2f ms", stage_names[prev], (stage_us[stage] - stage_us[prev]) / 1000.0);
+        prev = stage;
+    }
+    fprintf(stderr,
+            ", total %.2f ms\n",
+            (stage_us[SVT_AV1_FRAME_STAGE_OUTPUT] - stage_us[SVT_AV1_FRAME_STAGE_INPUT]) / 1000.0);
+}
+
+static void report_pipeline_profile(EbComponentType* component_handle, EbConfig* app_cfg) {
+    SvtAv1PipelineProfile profile;
+    if (svt_av1_enc_get_stream_info(component_handle, SVT_AV1_STREAM_INFO_PIPELINE_PROFILE, &profile) !=
+        EB_ErrorNone) {
+        return;
+    }
+    fprintf(stderr,
+            "\nSVT [profile]: %-8s %7s %10s %10s %8s %6s %9s\n",
+            "stage",
+            "threads",
+            "busy ms",
+            "wait ms",
+            "objects",
+            "util",
+            "max depth");
+    for (uint32_t s = 0; s < profile.stage_count; s++) {
+        const SvtAv1StageProfile* stage = &profile.stages[s];
+        const uint64_t            total = stage->busy_us + stage->wait_us;
+        fprintf(stderr,
+                "SVT [profile]: %-8s %7u %10.1f %10.1f %8llu %5.1f%% %9u\n",
+                stage->name,
+                stage->threads,
+                stage->busy_us / 1000.0,
+                stage->wait_us / 1000.0,
+                (unsigned long long)stage->objects,
+                total ? 100.0 * stage->busy_us / total : 0.0,
+                stage->max_queue_depth);
+    }
+    if (app_cfg->profile_trace_file) {
+        SvtAv1FixedBuf trace;
+        if (svt_av1_enc_get_stream_info(component_handle, SVT_AV1_STREAM_INFO_PIPELINE_TRACE, &trace) ==
+            EB_ErrorNone) {
+            fwrite(trace.buf, 1, trace.sz, app_cfg->profile_trace_file);
+        } else {
+            fprintf(stderr, "SVT [profile]: no trace recorded, --profile-trace-file requires --pipeline-profile 2\n");
+        }
+    }
+}
+
+static void report_pool_usage(EbComponentType* component_handle) {
+    SvtAv1PoolUsage usage;
+    if (svt_av1_enc_get_stream_info(component_handle, SVT_AV1_STREAM_INFO_POOL_USAGE, &usage) != EB_ErrorNone) {
+        return;
+    }
+    fprintf(stderr,
+            "\nSVT [pools]: %-13s %9s %7s %11s %14s\n",
+            "pool",
+            "allocated",
+            "ceiling",
+            "peak in use",
+            "huge pages MiB");
+    for (uint32_t p = 0; p < usage.pool_count; p++) {
+        const SvtAv1PoolStats* pool = &usage.pools[p];
+        fprintf(stderr,
+                "SVT [pools]: %-13s %9u %7u %11u %14.1f\n",
+                pool->name,
+                pool->allocated,
+                pool->ceiling,
+                pool->peak_in_use,
+                pool->huge_page_bytes / (1024.0 * 1024.0));
+    }
+}
+
+static void report_memory_usage(EbComponentType* component_handle) {
+    static const char* const names[SVT_AV1_MEMORY_CATEGORIES] = {
+        "pictures", "references", "me contexts", "md contexts", "neighbor arrays", "entropy", "tpl", "other"};
+    SvtAv1MemoryUsage usage;
+    if (svt_av1_enc_get_stream_info(component_handle, SVT_AV1_STREAM_INFO_MEMORY_USAGE, &usage) != EB_ErrorNone) {
+        return;
+    }
+    fprintf(stderr, "\nSVT [memory]: %-15s %10s %6s\n", "component", "MiB", "%");
+    for (uint32_t c = 0; c < SVT_AV1_MEMORY_CATEGORIES; c++) {
+        fprintf(stderr,
+                "SVT [memory]: %-15s %10.1f %6.1f\n",
+                names[c],
+                usage.bytes[c] / (1024.0 * 1024.0),
+                usage.total ? 100.0 * usage.bytes[c] / usage.total : 0.0);
+    }
+    fprintf(stderr, "SVT [memory]: %-15s %10.1f\n", "total", usage.total / (1024.0 * 1024.0));
+}
+
 void process_output_stream_buffer(EncChannel* channel, EncApp* enc_app, int32_t* frame_count) {
     EbConfig*            app_cfg    = channel->app_cfg;
     AppPortActiveType*   port_state = &app_cfg->output_stream_port_active;
@@ -1091,6 +1292,14 @@ void process_output_stream_buffer(EncChannel* channel, EncApp* enc_app, int32_t*
                         }
                     }
                 }
+                if (app_cfg->config.pipeline_profile) {
+                    report_pipeline_profile(component_handle, app_cfg);
+                }
+                if (app_cfg->config.lazy_pool_alloc || app_cfg->config.huge_pages || app_cfg->config.max_memory_mb ||
+                    app_cfg->config.compact_refs) {
+                    report_pool_usage(component_handle);
+                    report_memory_usage(component_handle);
+                }
             } else {
                 is_alt_ref = (flags & EB_BUFFERFLAG_IS_ALT_REF);
                 if (!(flags & EB_BUFFERFLAG_IS_ALT_REF)) {
@@ -1132,6 +1341,10 @@ void process_output_stream_buffer(EncChannel* channel, EncApp* enc_app, int32_t*
                 if (app_cfg->config.stat_report && !(flags & EB_BUFFERFLAG_IS_ALT_REF)) {
                     process_output_statistics_buffer(header_ptr, app_cfg);
                 }
+                SvtAv1FrameTiming timing;
+                if (svt_av1_enc_get_packet_timing(header_ptr, &timing) == EB_ErrorNone) {
+                    report_frame_timing(header_ptr, &timing);
+                }
 
                 // Update Output Port Activity State
                 return_value = APP_ExitConditionNone;
@@ -4717,6 +4717,186 @@ void svt_sad_loop_kernel_avx512_intrin(uint8_t*  src, // input parameter, source
     *y_search_center = (int16_t)best_y;
 }
 
+/* Sum the SAD's of the lines of 8x8 blocks, one block per 128-bit lane: each 64-bit half of a lane
+   holds the search positions 0 to 3 ("sad_03") or 4 to 7 ("sad_47") of one 4 sample half of the lines.
+   Return the search positions 0 to 7 of the blocks. */
+static INLINE __m512i sad_8x8_reduce_avx512(const __m512i sad_03, const __m512i sad_47) {
+    return _mm512_add_epi16(_mm512_unpacklo_epi64(sad_03, sad_47), _mm512_unpackhi_epi64(sad_03, sad_47));
+}
+
+/* SAD's of the 8 search positions of the left ("sad_l") and right ("sad_r") 8x8 blocks of the four
+   16x16 blocks of 8 lines starting at src, one 16x16 block per 128-bit lane. */
+static INLINE void sad_8x8_x8_eight_avx512(const uint8_t* src, const uint32_t src_stride, const uint8_t* ref,
+                                           const uint32_t ref_stride, const uint32_t step, __m512i* const sad_l,
+                                           __m512i* const sad_r) {
+    __m512i sad_l_03 = _mm512_setzero_si512();
+    __m512i sad_l_47 = _mm512_setzero_si512();
+    __m512i sad_r_03 = _mm512_setzero_si512();
+    __m512i sad_r_47 = _mm512_setzero_si512();
+
+    for (uint32_t i = 0; i < 8; i += step) {
+        const __m512i ss = _mm512_loadu_si512(src);
+        const __m512i rl = _mm512_loadu_si512(ref);
+        const __m512i rr = _mm512_loadu_si512(ref + 8);
+        // Samples 0 to 3 of a block in the low 64 bits of each lane, 4 to 7 in the high ones
+        const __m512i sl = _mm512_unpacklo_epi32(ss, ss);
+        const __m512i sr = _mm512_unpackhi_epi32(ss, ss);
+
+        sad_l_03 = _mm512_adds_epu16(sad_l_03, _mm512_dbsad_epu8(sl, rl, 0x94));
+        sad_l_47 = _mm512_adds_epu16(sad_l_47, _mm512_dbsad_epu8(sl, rl, 0xE9));
+        sad_r_03 = _mm512_adds_epu16(sad_r_03, _mm512_dbsad_epu8(sr, rr, 0x94));
+        sad_r_47 = _mm512_adds_epu16(sad_r_47, _mm512_dbsad_epu8(sr, rr, 0xE9));
+        src += step * src_stride;
+        ref += step * ref_stride;
+    }
+
+    *sad_l = sad_8x8_reduce_avx512(sad_l_03, sad_l_47);
+    *sad_r = sad_8x8_reduce_avx512(sad_r_03, sad_r_47);
+    if (step == 2) {
+        *sad_l = _mm512_slli_epi16(*sad_l, 1);
+        *sad_r = _mm512_slli_epi16(*sad_r, 1);
+    }
+}
+
+/* Keep the best SAD's and MV's of the four 8x8 blocks and of the 16x16 block. */
+static INLINE void update_best_8x8_16x16_avx512(const __m128i sad0, const __m128i sad1, const __m128i sad2,
+                                                const __m128i sad3, const __m128i mvs,
+                                                const uint32_t start_16x16_pos, uint32_t* p_best_sad_8x8,
+                                                uint32_t* p_best_sad_16x16, uint32_t* p_best_mv8x8,
+                                                uint32_t* p_best_mv16x16, uint32_t p_eight_sad16x16[16][8]) {
+    const uint32_t start_8x8_pos = 4 * start_16x16_pos;
+
+    const __m128i minpos0 = _mm_minpos_epu16(sad0);
+    const __m128i minpos1 = _mm_minpos_epu16(sad1);
+    const __m128i minpos2 = _mm_minpos_epu16(sad2);
+    const __m128i minpos3 = _mm_minpos_epu16(sad3);
+
+    const __m128i minpos01   = _mm_unpacklo_epi16(minpos0, minpos1);
+    const __m128i minpos23   = _mm_unpacklo_epi16(minpos2, minpos3);
+    const __m128i minpos0123 = _mm_unpacklo_epi32(minpos01, minpos23);
+    const __m128i sad8x8     = _mm_unpacklo_epi16(minpos0123, _mm_setzero_si128());
+    const __m128i pos8x8     = _mm_unpackhi_epi16(minpos0123, _mm_setzero_si128());
+
+    __m128i        best_sad8x8 = _mm_loadu_si128((__m128i*)(p_best_sad_8x8 + start_8x8_pos));
+    const __mmask8 mask        = _mm_cmplt_epu32_mask(sad8x8, best_sad8x8);
+    best_sad8x8                = _mm_min_epu32(best_sad8x8, sad8x8);
+    _mm_storeu_si128((__m128i*)(p_best_sad_8x8 + start_8x8_pos), best_sad8x8);
+    _mm_mask_storeu_epi32(p_best_mv8x8 + start_8x8_pos, mask, _mm_add_epi16(mvs, pos8x8));
+
+    const __m128i sad16x16_16 = _mm_add_epi16(_mm_add_epi16(sad0, sad1), _mm_add_epi16(sad2, sad3));
+    _mm256_storeu_si256((__m256i*)(p_eight_sad16x16[start_16x16_pos]), _mm256_cvtepu16_epi32(sad16x16_16));
+
+    const __m128i  minpos16x16 = _mm_minpos_epu16(sad16x16_16);
+    const uint32_t min16x16    = _mm_extract_epi16(minpos16x16, 0);
+
+    if (min16x16 < p_best_sad_16x16[start_16x16_pos]) {
+        p_best_sad_16x16[start_16x16_pos] = min16x16;
+
+        const __m128i pos16x16          = _mm_srli_si128(minpos16x16, 2);
+        const __m128i mv16x16           = _mm_add_epi16(mvs, pos16x16);
+        p_best_mv16x16[start_16x16_pos] = _mm_extract_epi32(mv16x16, 0);
+    }
+}
+
+/* The four 16x16 blocks of a row of 16x16 blocks are searched at once, one per 128-bit lane, so
+   that each line of the row is a single load. */
+void svt_ext_all_sad_calculation_8x8_16x16_avx512(uint8_t* src, uint32_t src_stride, uint8_t* ref,
+                                                  uint32_t ref_stride, uint32_t mv, uint32_t* p_best_sad_8x8,
+                                                  uint32_t* p_best_sad_16x16, uint32_t* p_best_mv8x8,
+                                                  uint32_t* p_best_mv16x16, uint32_t p_eight_sad16x16[16][8],
+                                                  uint32_t p_eight_sad8x8[64][8], bool sub_sad) {
+    static const char offsets[16] = {0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15};
+    const uint32_t    step        = sub_sad ? 2 : 1;
+    const __m128i     mvs         = _mm_set1_epi32(mv);
+    (void)p_eight_sad8x8;
+
+    //---- 16x16 : 0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15
+    for (int y = 0; y < 4; y++) {
+        const uint8_t* s = src + 16 * y * src_stride;
+        const uint8_t* r = ref + 16 * y * ref_stride;
+        __m512i        sad_tl, sad_tr, sad_bl, sad_br;
+
+        sad_8x8_x8_eight_avx512(s, src_stride, r, ref_stride, step, &sad_tl, &sad_tr);
+        sad_8x8_x8_eight_avx512(s + 8 * src_stride, src_stride, r + 8 * ref_stride, ref_stride, step, &sad_bl, &sad_br);
+
+#define UPDATE_BEST_8X8_16X16(x)                                        \
+    update_best_8x8_16x16_avx512(_mm512_extracti32x4_epi32(sad_tl, x), \
+                                 _mm512_extracti32x4_epi32(sad_tr, x), \
+                                 _mm512_extracti32x4_epi32(sad_bl, x), \
+                                 _mm512_extracti32x4_epi32(sad_br, x), \
+                                 mvs,                                  \
+                                 offsets[4 * y + x],                   \
+                                 p_best_sad_8x8,                       \
+                                 p_best_sad_16x16,                     \
+                                 p_best_mv8x8,                         \
+                                 p_best_mv16x16,                       \
+                                 p_eight_sad16x16)
+        UPDATE_BEST_8X8_16X16(0);
+        UPDATE_BEST_8X8_16X16(1);
+        UPDATE_BEST_8X8_16X16(2);
+        UPDATE_BEST_8X8_16X16(3);
+#undef UPDATE_BEST_8X8_16X16
+    }
+}
+
+/* Index of the minimum of each 256-bit half of "in", the lowest one on ties.
+   The values are reduced to 29 bits, as in the AVX2 version. */
+static INLINE void min_pos_x2_avx512(const __m512i in, uint32_t* const idx_lo, uint32_t* const idx_hi) {
+    const __m512i idx = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7);
+    __m512i       x   = _mm512_add_epi32(_mm512_slli_epi32(in, 3), idx); /* x = x<<3 | idx */
+    x                 = _mm512_min_epu32(x, _mm512_shuffle_i64x2(x, x, 0xB1));
+    x                 = _mm512_min_epu32(x, _mm512_shuffle_epi32(x, 0x4E));
+    x                 = _mm512_min_epu32(x, _mm512_shuffle_epi32(x, 0xB1));
+    *idx_lo           = (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(x)) & 0x07;
+    *idx_hi           = (uint32_t)_mm_cvtsi128_si32(_mm512_extracti32x4_epi32(x, 2)) & 0x07;
+}
+
+void svt_ext_eight_sad_calculation_32x32_64x64_avx512(const uint32_t p_sad16x16[16][8], uint32_t* p_best_sad_32x32,
+                                                      uint32_t* p_best_sad_64x64, uint32_t* p_best_mv32x32,
+                                                      uint32_t* p_best_mv64x64, uint32_t mv,
+                                                      uint32_t p_sad32x32[4][8]) {
+    __m256i  sad32[4];
+    uint32_t si[5];
+
+    // p_sad16x16 was just stored one 16x16 block at a time, so it is loaded the same way
+    for (int i = 0; i < 4; i++) {
+        const __m256i s0 = _mm256_loadu_si256((const __m256i*)p_sad16x16[4 * i + 0]);
+        const __m256i s1 = _mm256_loadu_si256((const __m256i*)p_sad16x16[4 * i + 1]);
+        const __m256i s2 = _mm256_loadu_si256((const __m256i*)p_sad16x16[4 * i + 2]);
+        const __m256i s3 = _mm256_loadu_si256((const __m256i*)p_sad16x16[4 * i + 3]);
+        sad32[i]         = _mm256_add_epi32(_mm256_add_epi32(s0, s1), _mm256_add_epi32(s2, s3));
+        _mm256_storeu_si256((__m256i*)p_sad32x32[i], sad32[i]);
+    }
+
+    const __m512i sad32_01 = _mm512_inserti64x4(_mm512_castsi256_si512(sad32[0]), sad32[1], 1);
+    const __m512i sad32_23 = _mm512_inserti64x4(_mm512_castsi256_si512(sad32[2]), sad32[3], 1);
+    const __m256i sad64    = _mm256_add_epi32(_mm256_add_epi32(sad32[0], sad32[1]), _mm256_add_epi32(sad32[2], sad32[3]));
+    DECLARE_ALIGNED(32, uint32_t, p_sad64x64[8]);
+    _mm256_store_si256((__m256i*)p_sad64x64, sad64);
+
+    DECLARE_ALIGNED(32, uint32_t, computed_idx[8]);
+    const __m256i mv_avx2     = _mm256_set1_epi32(mv);
+    const __m256i new_mv_avx2 = _mm256_and_si256(_mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), mv_avx2),
+                                                 _mm256_set1_epi32(0xffff));
+    _mm256_store_si256((__m256i*)computed_idx,
+                       _mm256_or_si256(new_mv_avx2, _mm256_and_si256(mv_avx2, _mm256_set1_epi32(0xffff0000))));
+
+    min_pos_x2_avx512(sad32_01, &si[0], &si[1]);
+    min_pos_x2_avx512(sad32_23, &si[2], &si[3]);
+    min_pos_x2_avx512(_mm512_broadcast_i64x4(sad64), &si[4], &si[4]);
+
+    for (int i = 0; i < 4; i++) {
+        if (p_sad32x32[i][si[i]] < p_best_sad_32x32[i]) {
+            p_best_sad_32x32[i] = p_sad32x32[i][si[i]];
+            p_best_mv32x32[i]   = computed_idx[si[i]];
+        }
+    }
+    if (p_sad64x64[si[4]] < p_best_sad_64x64[0]) {
+        p_best_sad_64x64[0] = p_sad64x64[si[4]];
+        p_best_mv64x64[0]   = computed_idx[si[4]];
+    }
+}
+
 uint32_t svt_nxm_sad_kernel_helper_avx512(const uint8_t* src, uint32_t src_stride, const uint8_t* ref,
                                           uint32_t ref_stride, uint32_t height, uint32_t width) {
     uint32_t nxm_sad = 0;
@@ -2239,6 +2239,12 @@ void svt_ext_all_sad_calculation_8x8_16x16_avx2(uint8_t* src, uint32_t src_strid
     uint32_t* p_best_mv8x8, uint32_t* p_best_mv16x16,
     uint32_t p_eight_sad16x16[16][8],
     uint32_t p_eight_sad8x8[64][8], bool sub_sad);
+void svt_ext_all_sad_calculation_8x8_16x16_avx512(uint8_t* src, uint32_t src_stride, uint8_t* ref,
+    uint32_t ref_stride, uint32_t mv,
+    uint32_t* p_best_sad_8x8, uint32_t* p_best_sad_16x16,
+    uint32_t* p_best_mv8x8, uint32_t* p_best_mv16x16,
+    uint32_t p_eight_sad16x16[16][8],
+    uint32_t p_eight_sad8x8[64][8], bool sub_sad);
 void svt_ext_all_sad_calculation_8x8_16x16_sse4_1(uint8_t* src, uint32_t src_stride, uint8_t* ref,
     uint32_t ref_stride, uint32_t mv,
     uint32_t* p_best_sad_8x8, uint32_t* p_best_sad_16x16,
@@ -2255,6 +2261,11 @@ void svt_ext_eight_sad_calculation_32x32_64x64_avx2(const uint32_t  p_sad16x16[1
     uint32_t *p_best_sad_64x64,
     uint32_t *p_best_mv32x32, uint32_t *p_best_mv64x64,
     uint32_t mv, uint32_t p_sad32x32[4][8]);
+void svt_ext_eight_sad_calculation_32x32_64x64_avx512(const uint32_t  p_sad16x16[16][8],
+    uint32_t *p_best_sad_32x32,
+    uint32_t *p_best_sad_64x64,
+    uint32_t *p_best_mv32x32, uint32_t *p_best_mv64x64,
+    uint32_t mv, uint32_t p_sad32x32[4][8]);
 uint32_t svt_compute4x_m_sad_avx2_intrin(
     const uint8_t *src, // input parameter, source samples Ptr
     uint32_t       src_stride, // input parameter, source stride
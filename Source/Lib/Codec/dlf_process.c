@@ -68,6 +68,7 @@ EbErrorType svt_aom_dlf_kernel_iter(void* context) {
     pcs                           = (PictureControlSet*)enc_dec_results->pcs_wrapper->object_ptr;
     PictureParentControlSet* ppcs = pcs->ppcs;
     scs                           = pcs->scs;
+    svt_aom_stamp_frame_stage(ppcs, SVT_AV1_FRAME_STAGE_FILTER);
 
     bool is_16bit = SVT_EFFECTIVE_IS_16BIT_PIPELINE(scs->is_16bit_pipeline);
     if (is_16bit && SVT_EFFECTIVE_BIT_DEPTH(scs->static_config.encoder_bit_depth) == EB_EIGHT_BIT) {
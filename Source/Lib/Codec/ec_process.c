@@ -152,6 +152,7 @@ EbErrorType svt_aom_entropy_coding_kernel_iter(void* context) {
     RestResults*        rest_results = (RestResults*)rest_results_wrapper->object_ptr;
     PictureControlSet*  pcs          = (PictureControlSet*)rest_results->pcs_wrapper->object_ptr;
     SequenceControlSet* scs          = pcs->scs;
+    svt_aom_stamp_frame_stage(pcs->ppcs, SVT_AV1_FRAME_STAGE_EC);
     // SB Constants
 
     uint32_t sb_size = scs->sb_size;
@@ -248,10 +249,8 @@ EbErrorType svt_aom_entropy_coding_kernel_iter(void* context) {
                 }
             }
 
-            //free palette data
-            if (pcs->tile_tok[0][0]) {
-                EB_FREE_ARRAY(pcs->tile_tok[0][0]);
-            }
+            // palette data is held by pcs->arena
+            pcs->tile_tok[0][0] = NULL;
         }
         frame_entropy_done = true;
     }
@@ -1069,6 +1069,24 @@ EbErrorType psnr_calculations(PictureControlSet* pcs, SequenceControlSet* scs, b
     return EB_ErrorNone;
 }
 
+// Split a padded 16 bit plane into the 8 bit and 2 bit planes of the reference
+static void unpack_ref_plane(EbPictureBufferDesc* pic_16bit, EbPictureBufferDesc* ref_pic, int plane, uint16_t ss_x,
+                             uint16_t ss_y) {
+    const int32_t border_x = ref_pic->border >> ss_x;
+    const int32_t border_y = ref_pic->border >> ss_y;
+    uint16_t*     src      = (uint16_t*)pic_16bit->buffer[plane] -
+        ((pic_16bit->border >> ss_x) + (pic_16bit->border >> ss_y) * pic_16bit->stride[plane]);
+    svt_aom_unpack_ref_block(src,
+                             pic_16bit->stride[plane],
+                             ref_pic->buffer[plane],
+                             ref_pic->buffer_bit_inc[plane],
+                             ref_pic->compressed_2b,
+                             ref_pic->stride[plane],
+                             -(border_x + border_y * ref_pic->stride[plane]),
+                             (pic_16bit->width + ss_x + (ref_pic->border << 1)) >> ss_x,
+                             (pic_16bit->height + ss_y + (ref_pic->border << 1)) >> ss_y);
+}
+
 void pad_ref_and_set_flags(PictureControlSet* pcs, SequenceControlSet* scs) {
     EbReferenceObject* ref_object = (EbReferenceObject*)pcs->ppcs->ref_pic_wrapper->object_ptr;
 
@@ -1141,42 +1159,9 @@ void pad_ref_and_set_flags(PictureControlSet* pcs, SequenceControlSet* scs) {
                                        (ref_pic_16bit_ptr->border + ss_y) >> ss_y);
 
         // Unpack ref samples (to be used @ MD)
-        svt_aom_un_pack2d(
-            ((uint16_t*)ref_pic_16bit_ptr->y_buffer) -
-                (ref_pic_16bit_ptr->border + ref_pic_16bit_ptr->border * ref_pic_16bit_ptr->y_stride),
-            ref_pic_16bit_ptr->y_stride,
-            ref_pic_ptr->y_buffer - (ref_pic_ptr->border + ref_pic_ptr->border * ref_pic_ptr->y_stride),
-            ref_pic_ptr->y_stride,
-            ref_pic_ptr->y_buffer_bit_inc - (ref_pic_ptr->border + ref_pic_ptr->border * ref_pic_ptr->y_stride_bit_inc),
-            ref_pic_ptr->y_stride_bit_inc,
-            ref_pic_16bit_ptr->width + (ref_pic_ptr->border << 1),
-            ref_pic_16bit_ptr->height + (ref_pic_ptr->border << 1));
-        svt_aom_un_pack2d(
-            ((uint16_t*)ref_pic_16bit_ptr->u_buffer) -
-                ((ref_pic_16bit_ptr->border >> ss_x) +
-                 ((ref_pic_16bit_ptr->border >> ss_y) * ref_pic_16bit_ptr->u_stride)),
-            ref_pic_16bit_ptr->u_stride,
-            ref_pic_ptr->u_buffer -
-                ((ref_pic_ptr->border >> ss_x) + ((ref_pic_ptr->border >> ss_y) * ref_pic_ptr->u_stride)),
-            ref_pic_ptr->u_stride,
-            ref_pic_ptr->u_buffer_bit_inc -
-                ((ref_pic_ptr->border >> ss_x) + ((ref_pic_ptr->border >> ss_y) * ref_pic_ptr->u_stride_bit_inc)),
-            ref_pic_ptr->u_stride_bit_inc,
-            (ref_pic_16bit_ptr->width + ss_x + (ref_pic_ptr->border << 1)) >> ss_x,
-            (ref_pic_16bit_ptr->height + ss_y + (ref_pic_ptr->border << 1)) >> ss_y);
-        svt_aom_un_pack2d(
-            ((uint16_t*)ref_pic_16bit_ptr->v_buffer) -
-                ((ref_pic_16bit_ptr->border >> ss_x) +
-                 ((ref_pic_16bit_ptr->border >> ss_y) * ref_pic_16bit_ptr->v_stride)),
-            ref_pic_16bit_ptr->v_stride,
-            ref_pic_ptr->v_buffer -
-                ((ref_pic_ptr->border >> ss_x) + ((ref_pic_ptr->border >> ss_y) * ref_pic_ptr->v_stride)),
-            ref_pic_ptr->v_stride,
-            ref_pic_ptr->v_buffer_bit_inc -
-                ((ref_pic_ptr->border >> ss_x) + ((ref_pic_ptr->border >> ss_y) * ref_pic_ptr->v_stride_bit_inc)),
-            ref_pic_ptr->v_stride_bit_inc,
-            (ref_pic_16bit_ptr->width + ss_x + (ref_pic_ptr->border << 1)) >> ss_x,
-            (ref_pic_16bit_ptr->height + ss_y + (ref_pic_ptr->border << 1)) >> ss_y);
+        unpack_ref_plane(ref_pic_16bit_ptr, ref_pic_ptr, 0, 0, 0);
+        unpack_ref_plane(ref_pic_16bit_ptr, ref_pic_ptr, 1, ss_x, ss_y);
+        unpack_ref_plane(ref_pic_16bit_ptr, ref_pic_ptr, 2, ss_x, ss_y);
     }
     if ((SVT_EFFECTIVE_IS_16BIT_PIPELINE(scs->is_16bit_pipeline)) && (!is_16bit)) {
         // Y samples
@@ -3204,7 +3189,7 @@ EbErrorType svt_aom_mode_decision_kernel_iter(void* context) {
                 }
 
             } else {
-                EB_FREE_ARRAY(pcs->ec_ctx_array);
+                pcs->ec_ctx_array = NULL; // held by pcs->arena
                 // Copy film grain data from parent picture set to the reference object for
                 // further reference
                 if (scs->seq_header.film_grain_params_present) {
@@ -74,11 +74,14 @@ static INLINE Mv clamp_mv_to_umv_border_sb(const MacroBlockD* xd, const Mv* src_
     return clamped_mv;
 }
 
+// src_ptr and src_ptr_2b are the plane origins and src_pos the pixel offset of the block
 static void av1_make_masked_scaled_inter_predictor(
-    uint8_t* src_ptr, uint8_t* src_ptr_2b, uint32_t src_stride, uint8_t* dst_ptr, uint32_t dst_stride, BlockSize bsize,
-    uint8_t bwidth, uint8_t bheight, InterpFilter interp_filters, const SubpelParams* subpel_params,
-    const ScaleFactors* sf, ConvolveParams* conv_params, const InterInterCompoundData* const comp_data,
-    uint8_t* seg_mask, uint8_t bitdepth, uint8_t plane, uint8_t use_intrabc, uint8_t is_16bit) {
+    uint8_t* src_ptr, uint8_t* src_ptr_2b, bool compressed_2b, uint32_t src_stride, int32_t src_pos, uint8_t* dst_ptr,
+    uint32_t dst_stride, BlockSize bsize, uint8_t bwidth, uint8_t bheight, InterpFilter interp_filters,
+    const SubpelParams* subpel_params, const ScaleFactors* sf, ConvolveParams* conv_params,
+    const InterInterCompoundData* const comp_data, uint8_t* seg_mask, uint8_t bitdepth, uint8_t plane,
+    uint8_t use_intrabc, uint8_t is_16bit) {
+    uint8_t* src_mod = src_ptr + (src_ptr_2b ? src_pos : src_pos * (1 << is_16bit));
     //We come here when we have a prediction done using regular path for the ref0 stored in conv_param.dst.
     //use regular path to generate a prediction for ref1 into  a temporary buffer,
     //then  blend that temporary buffer with that from  the first reference.
@@ -120,17 +123,18 @@ static void av1_make_masked_scaled_inter_predictor(
                 src_stride16 = ALIGN_POWER_OF_TWO(src_stride16, 3);
             }
 
-            svt_aom_pack_block(src_ptr - offset - (offset * src_stride),
-                               src_stride,
-                               src_ptr_2b - offset - (offset * src_stride),
-                               src_stride,
-                               src16,
-                               src_stride16,
-                               bwidth * width_scale + (offset << 1),
-                               bheight * height_scale + (offset << 1));
+            svt_aom_pack_ref_block(src_ptr,
+                                   src_ptr_2b,
+                                   compressed_2b,
+                                   src_stride,
+                                   src_pos - offset - (offset * src_stride),
+                                   src16,
+                                   src_stride16,
+                                   bwidth * width_scale + (offset << 1),
+                                   bheight * height_scale + (offset << 1));
             src_ptr_10b = src16 + offset + (offset * src_stride16);
         } else {
-            src_ptr_10b  = (uint16_t*)src_ptr;
+            src_ptr_10b  = (uint16_t*)src_mod;
             src_stride16 = src_stride;
         }
         svt_highbd_inter_predictor(src_ptr_10b,
@@ -148,9 +152,10 @@ static void av1_make_masked_scaled_inter_predictor(
     } else
 #else
     UNUSED(src_ptr_2b);
+    UNUSED(compressed_2b);
 #endif
     {
-        svt_inter_predictor(src_ptr,
+        svt_inter_predictor(src_mod,
                             src_stride,
                             dst_ptr,
                             dst_stride,
@@ -316,11 +321,11 @@ static void av1_model_rd_curvfit(BlockSize bsize, double sse_norm, double xqr, d
 static void model_rd_with_curvfit(PictureControlSet* pcs, BlockSize plane_bsize, int64_t sse, int num_samples,
                                   int* rate, int64_t* dist, ModeDecisionContext* ctx, uint32_t rdmult) {
     (void)plane_bsize;
-    const int           dequant_shift   = 3;
-    int32_t             current_q_index = pcs->ppcs->frm_hdr.quantization_params.base_q_idx;
-    SequenceControlSet* scs             = pcs->scs;
-    Dequants* const     dequants  = SVT_EFFECTIVE_HBD_MD(ctx->hbd_md) ? &scs->enc_ctx->deq_bd : &scs->enc_ctx->deq_8bit;
-    int16_t             quantizer = dequants->y_dequant_qtx[current_q_index][1];
+    const int             dequant_shift   = 3;
+    int32_t               current_q_index = pcs->ppcs->frm_hdr.quantization_params.base_q_idx;
+    SequenceControlSet*   scs             = pcs->scs;
+    const Dequants* const dequants = SVT_EFFECTIVE_HBD_MD(ctx->hbd_md) ? scs->enc_ctx->deq_bd : scs->enc_ctx->deq_8bit;
+    int16_t               quantizer = dequants->y_dequant_qtx[current_q_index][1];
 
     const int qstep = AOMMAX(quantizer >> dequant_shift, 1);
 
@@ -825,6 +830,7 @@ static EbErrorType get_single_prediction_for_obmc_luma_hbd(SequenceControlSet* s
     svt_aom_enc_make_inter_predictor(scs,
                                      src_ptr_8b,
                                      src_ptr_2b,
+                                     ref_pic_list0->compressed_2b,
                                      (uint8_t*)dst_ptr,
                                      (int16_t)pu_origin_y,
                                      (int16_t)pu_origin_x,
@@ -891,6 +897,7 @@ static EbErrorType get_single_prediction_for_obmc_chroma_hbd(SequenceControlSet*
     svt_aom_enc_make_inter_predictor(scs,
                                      src_ptr_8b,
                                      src_ptr_2b,
+                                     ref_pic_list0->compressed_2b,
                                      (uint8_t*)dst_ptr,
                                      (int16_t)pu_origin_y_chroma,
                                      (int16_t)pu_origin_x_chroma,
@@ -930,6 +937,7 @@ static EbErrorType get_single_prediction_for_obmc_chroma_hbd(SequenceControlSet*
     svt_aom_enc_make_inter_predictor(scs,
                                      src_ptr_8b,
                                      src_ptr_2b,
+                                     ref_pic_list0->compressed_2b,
                                      (uint8_t*)dst_ptr,
                                      (int16_t)pu_origin_y_chroma,
                                      (int16_t)pu_origin_x_chroma,
@@ -990,6 +998,7 @@ static EbErrorType get_single_prediction_for_obmc_luma(SequenceControlSet* scs,
     svt_aom_enc_make_inter_predictor(scs,
                                      src_ptr,
                                      NULL,
+                                     false,
                                      dst_ptr,
                                      (int16_t)pu_origin_y,
                                      (int16_t)pu_origin_x,
@@ -1054,6 +1063,7 @@ static EbErrorType get_single_prediction_for_obmc_chroma(SequenceControlSet* scs
     svt_aom_enc_make_inter_predictor(scs,
                                      src_ptr,
                                      NULL,
+                                     false,
                                      dst_ptr,
                                      (int16_t)pu_origin_y_chroma,
                                      (int16_t)pu_origin_x_chroma,
@@ -1092,6 +1102,7 @@ static EbErrorType get_single_prediction_for_obmc_chroma(SequenceControlSet* scs
     svt_aom_enc_make_inter_predictor(scs,
                                      src_ptr,
                                      NULL,
+                                     false,
                                      dst_ptr,
                                      (int16_t)pu_origin_y_chroma,
                                      (int16_t)pu_origin_x_chroma,
@@ -1635,10 +1646,10 @@ void svt_av1_calc_target_weighted_pred_left_c(uint8_t is16bit, MacroBlockD* xd,
 }
 
 #if CONFIG_ENABLE_WARP
-static void av1_make_masked_warp_inter_predictor(uint8_t* src_ptr, uint8_t* src_2b_ptr, uint32_t src_stride,
-                                                 uint16_t buf_width, uint16_t buf_height, uint8_t* dst_ptr,
-                                                 uint32_t dst_stride, const BlockSize bsize, uint8_t bwidth,
-                                                 uint8_t bheight, ConvolveParams* conv_params,
+static void av1_make_masked_warp_inter_predictor(uint8_t* src_ptr, uint8_t* src_2b_ptr, bool compressed_2b,
+                                                 uint32_t src_stride, uint16_t buf_width, uint16_t buf_height,
+                                                 uint8_t* dst_ptr, uint32_t dst_stride, const BlockSize bsize,
+                                                 uint8_t bwidth, uint8_t bheight, ConvolveParams* conv_params,
                                                  const InterInterCompoundData* const comp_data, uint8_t* seg_mask,
                                                  uint8_t bitdepth, uint8_t plane, uint16_t pu_origin_x,
                                                  uint16_t pu_origin_y, WarpedMotionParams* wm_params_l1, bool is16bit) {
@@ -1667,6 +1678,7 @@ static void av1_make_masked_warp_inter_predictor(uint8_t* src_ptr, uint8_t* src_
                        bitdepth,
                        src_ptr,
                        src_2b_ptr,
+                       compressed_2b,
                        (int)buf_width,
                        (int)buf_height,
                        src_stride,
@@ -2023,11 +2035,12 @@ static void model_rd_for_sb(PictureControlSet* pcs, EbPictureBufferDesc* predict
                                          plane ? scs->static_config.ac_bias : effective_ac_bias);
         }
 
-        uint32_t        rate;
-        uint64_t        dist;
-        const uint8_t   current_q_index = pcs->ppcs->frm_hdr.quantization_params.base_q_idx;
-        Dequants* const dequants  = SVT_EFFECTIVE_HBD_MD(ctx->hbd_md) ? &scs->enc_ctx->deq_bd : &scs->enc_ctx->deq_8bit;
-        int16_t         quantizer = dequants->y_dequant_qtx[current_q_index][1];
+        uint32_t              rate;
+        uint64_t              dist;
+        const uint8_t         current_q_index = pcs->ppcs->frm_hdr.quantization_params.base_q_idx;
+        const Dequants* const dequants = SVT_EFFECTIVE_HBD_MD(ctx->hbd_md) ? scs->enc_ctx->deq_bd
+                                                                           : scs->enc_ctx->deq_8bit;
+        int16_t               quantizer = dequants->y_dequant_qtx[current_q_index][1];
         model_rd_from_sse(plane == 0 ? ctx->blk_geom->bsize : ctx->blk_geom->bsize_uv,
                           quantizer,
                           bit_depth,
@@ -2506,11 +2519,11 @@ static void enc_make_inter_predictor_pd0(uint8_t* src, uint8_t* dst, SubpelParam
     svt_inter_predictor_pd0(src, src_stride, dst, dst_stride, blk_width, blk_height, subpel_params, conv_params);
 }
 
-void svt_aom_enc_make_inter_predictor(SequenceControlSet* scs, uint8_t* src_ptr, uint8_t* src_ptr_2b, uint8_t* dst_ptr,
-                                      int16_t pre_y, int16_t pre_x, Mv mv, const struct ScaleFactors* const sf,
-                                      ConvolveParams* conv_params, InterpFilters interp_filters,
-                                      const InterInterCompoundData* const interinter_comp, uint8_t* seg_mask,
-                                      uint16_t frame_width, uint16_t frame_height, uint8_t blk_width,
+void svt_aom_enc_make_inter_predictor(SequenceControlSet* scs, uint8_t* src_ptr, uint8_t* src_ptr_2b,
+                                      bool compressed_2b, uint8_t* dst_ptr, int16_t pre_y, int16_t pre_x, Mv mv,
+                                      const struct ScaleFactors* const sf, ConvolveParams* conv_params,
+                                      InterpFilters interp_filters, const InterInterCompoundData* const interinter_comp,
+                                      uint8_t* seg_mask, uint16_t frame_width, uint16_t frame_height, uint8_t blk_width,
                                       uint8_t blk_height, BlockSize bsize, MacroBlockD* av1xd, int32_t src_stride,
                                       int32_t dst_stride, uint8_t plane, const uint32_t ss_y, const uint32_t ss_x,
                                       uint8_t bit_depth, uint8_t use_intrabc, uint8_t is_masked_compound,
@@ -2521,6 +2534,7 @@ void svt_aom_enc_make_inter_predictor(SequenceControlSet* scs, uint8_t* src_ptr,
             conv_params->do_average = 0;
             av1_make_masked_warp_inter_predictor(src_ptr,
                                                  src_ptr_2b,
+                                                 compressed_2b,
                                                  src_stride,
                                                  frame_width >> ss_x,
                                                  frame_height >> ss_y,
@@ -2545,6 +2559,7 @@ void svt_aom_enc_make_inter_predictor(SequenceControlSet* scs, uint8_t* src_ptr,
                            bit_depth,
                            src_ptr,
                            src_ptr_2b,
+                           compressed_2b,
                            (int)(frame_width >> ss_x),
                            (int)(frame_height >> ss_y),
                            src_stride,
@@ -2582,19 +2597,16 @@ void svt_aom_enc_make_inter_predictor(SequenceControlSet* scs, uint8_t* src_ptr,
                               &pos_y,
                               &pos_x);
 
-        uint8_t* src_mod;
-        uint8_t* src_mod_2b = NULL;
-        if (src_ptr_2b) {
-            src_mod    = src_ptr + ((pos_x + (pos_y * src_stride)));
-            src_mod_2b = src_ptr_2b + ((pos_x + (pos_y * src_stride)));
-        } else {
-            src_mod = src_ptr + ((pos_x + (pos_y * src_stride)) * (1 << is16bit));
-        }
+        // Pixel offset of the block; the 2 bit plane is read by svt_aom_pack_ref_block()
+        const int32_t src_pos = pos_x + pos_y * src_stride;
+        uint8_t*      src_mod = src_ptr + (src_ptr_2b ? src_pos : src_pos * (1 << is16bit));
         if (is_masked_compound) {
             conv_params->do_average = 0;
-            av1_make_masked_scaled_inter_predictor(src_mod,
-                                                   src_mod_2b,
+            av1_make_masked_scaled_inter_predictor(src_ptr,
+                                                   src_ptr_2b,
+                                                   compressed_2b,
                                                    src_stride,
+                                                   src_pos,
                                                    dst_ptr,
                                                    dst_stride,
                                                    bsize,
@@ -2636,14 +2648,15 @@ void svt_aom_enc_make_inter_predictor(SequenceControlSet* scs, uint8_t* src_ptr,
                     src_stride16 = ALIGN_POWER_OF_TWO(src_stride16, 3);
                 }
 
-                svt_aom_pack_block(src_mod - offset - (offset * src_stride),
-                                   src_stride,
-                                   src_mod_2b - offset - (offset * src_stride),
-                                   src_stride,
-                                   src16,
-                                   src_stride16,
-                                   blk_width * width_scale + (offset << 1),
-                                   blk_height * height_scale + (offset << 1));
+                svt_aom_pack_ref_block(src_ptr,
+                                       src_ptr_2b,
+                                       compressed_2b,
+                                       src_stride,
+                                       src_pos - offset - (offset * src_stride),
+                                       src16,
+                                       src_stride16,
+                                       blk_width * width_scale + (offset << 1),
+                                       blk_height * height_scale + (offset << 1));
                 src16_ptr = src16 + offset + (offset * src_stride16);
             } else {
                 src16_ptr    = (uint16_t*)src_mod;
@@ -2800,8 +2813,6 @@ static void av1_inter_prediction_light_pd1(SequenceControlSet* scs, ModeDecision
     const uint8_t    is_16bit     = hbd_md ? 1 : 0;
     const uint8_t    is_compound  = has_second_ref(block_mi);
     uint16_t*        tmp_dst_y    = ctx->tmp_conv_buf;
-    uint8_t*         src_mod;
-    uint8_t*         src_mod_2b;
 
     // Luma prediction
     if (component_mask & PICTURE_BUFFER_DESC_LUMA_MASK) {
@@ -2836,11 +2847,11 @@ static void av1_inter_prediction_light_pd1(SequenceControlSet* scs, ModeDecision
             }
 
             assert(IMPLIES(conv_params_y.do_average, is_compound));
-            src_mod    = ref_pic->y_buffer + ((pos_x + (pos_y)*ref_pic->y_stride));
-            src_mod_2b = ADD_OFFSET_OR_NULL(ref_pic->y_buffer_bit_inc, pos_x + (pos_y)*ref_pic->y_stride_bit_inc);
-            svt_inter_predictor_light_pd1(src_mod,
-                                          src_mod_2b,
+            svt_inter_predictor_light_pd1(ref_pic->y_buffer,
+                                          ref_pic->y_buffer_bit_inc,
+                                          ref_pic->compressed_2b,
                                           ref_pic->y_stride,
+                                          pos_x + pos_y * ref_pic->y_stride,
                                           dst_ptr_y,
                                           pred_pic->y_stride,
                                           bwidth,
@@ -2894,11 +2905,11 @@ static void av1_inter_prediction_light_pd1(SequenceControlSet* scs, ModeDecision
                                   &pos_y,
                                   &pos_x);
             if (component_mask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-                src_mod    = ref_pic->u_buffer + (pos_x + pos_y * ref_pic->u_stride);
-                src_mod_2b = ADD_OFFSET_OR_NULL(ref_pic->u_buffer_bit_inc, pos_x + pos_y * ref_pic->u_stride_bit_inc);
-                svt_inter_predictor_light_pd1(src_mod,
-                                              src_mod_2b,
+                svt_inter_predictor_light_pd1(ref_pic->u_buffer,
+                                              ref_pic->u_buffer_bit_inc,
+                                              ref_pic->compressed_2b,
                                               ref_pic->u_stride,
+                                              pos_x + pos_y * ref_pic->u_stride,
                                               dst_ptr_cb,
                                               pred_pic->u_stride,
                                               blk_geom->bwidth_uv,
@@ -2910,11 +2921,11 @@ static void av1_inter_prediction_light_pd1(SequenceControlSet* scs, ModeDecision
             }
 
             if (component_mask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-                src_mod    = ref_pic->v_buffer + ((pos_x + (pos_y)*ref_pic->v_stride));
-                src_mod_2b = ADD_OFFSET_OR_NULL(ref_pic->v_buffer_bit_inc, pos_x + (pos_y)*ref_pic->v_stride_bit_inc);
-                svt_inter_predictor_light_pd1(src_mod,
-                                              src_mod_2b,
+                svt_inter_predictor_light_pd1(ref_pic->v_buffer,
+                                              ref_pic->v_buffer_bit_inc,
+                                              ref_pic->compressed_2b,
                                               ref_pic->v_stride,
+                                              pos_x + pos_y * ref_pic->v_stride,
                                               dst_ptr_cr,
                                               pred_pic->v_stride,
                                               blk_geom->bwidth_uv,
@@ -3130,6 +3141,7 @@ static uint8_t inter_chroma_4xn_pred(PictureControlSet* pcs, MacroBlockD* xd, Bl
                 pcs->ppcs->scs,
                 src_ptr,
                 src_ptr_2b,
+                ref_pic->compressed_2b,
                 dst_ptr,
                 pu_origin_y_chroma + y,
                 pu_origin_x_chroma + x,
@@ -3172,6 +3184,7 @@ static uint8_t inter_chroma_4xn_pred(PictureControlSet* pcs, MacroBlockD* xd, Bl
                 pcs->ppcs->scs,
                 src_ptr,
                 src_ptr_2b,
+                ref_pic->compressed_2b,
                 dst_ptr,
                 pu_origin_y_chroma + y,
                 pu_origin_x_chroma + x,
@@ -3312,6 +3325,7 @@ EbErrorType svt_aom_inter_prediction(SequenceControlSet* scs, PictureControlSet*
                 scs,
                 src_ptr,
                 src_ptr_2b,
+                ref_pic->compressed_2b,
                 dst_ptr_y,
                 (int16_t)ref_origin_y,
                 (int16_t)ref_origin_x,
@@ -3425,6 +3439,7 @@ EbErrorType svt_aom_inter_prediction(SequenceControlSet* scs, PictureControlSet*
                     scs,
                     src_ptr,
                     src_ptr_2b,
+                    ref_pic->compressed_2b,
                     dst_ptr_cb,
                     pu_origin_y_chroma,
                     pu_origin_x_chroma,
@@ -3464,6 +3479,7 @@ EbErrorType svt_aom_inter_prediction(SequenceControlSet* scs, PictureControlSet*
                     scs,
                     src_ptr,
                     src_ptr_2b,
+                    ref_pic->compressed_2b,
                     dst_ptr_cr,
                     pu_origin_y_chroma,
                     pu_origin_x_chroma,
@@ -75,11 +75,11 @@ const uint8_t* svt_av1_get_obmc_mask(int length);
 
 void model_rd_from_sse(BlockSize bsize, int16_t quantizer, uint8_t bit_depth, uint64_t sse, uint32_t* rate,
                        uint64_t* dist, uint8_t simple_model_rd_from_var);
-void svt_aom_enc_make_inter_predictor(SequenceControlSet* scs, uint8_t* src_ptr, uint8_t* src_ptr_2b, uint8_t* dst_ptr,
-                                      int16_t pre_y, int16_t pre_x, Mv mv, const struct ScaleFactors* const sf,
-                                      ConvolveParams* conv_params, InterpFilters interp_filters,
-                                      const InterInterCompoundData* const interinter_comp, uint8_t* seg_mask,
-                                      uint16_t frame_width, uint16_t frame_height, uint8_t blk_width,
+void svt_aom_enc_make_inter_predictor(SequenceControlSet* scs, uint8_t* src_ptr, uint8_t* src_ptr_2b,
+                                      bool compressed_2b, uint8_t* dst_ptr, int16_t pre_y, int16_t pre_x, Mv mv,
+                                      const struct ScaleFactors* const sf, ConvolveParams* conv_params,
+                                      InterpFilters interp_filters, const InterInterCompoundData* const interinter_comp,
+                                      uint8_t* seg_mask, uint16_t frame_width, uint16_t frame_height, uint8_t blk_width,
                                       uint8_t blk_height, BlockSize bsize, MacroBlockD* av1xd, int32_t src_stride,
                                       int32_t dst_stride, uint8_t plane, const uint32_t ss_y, const uint32_t ss_x,
                                       uint8_t bit_depth, uint8_t use_intrabc, uint8_t is_masked_compound,
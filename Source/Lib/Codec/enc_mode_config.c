@@ -613,6 +613,50 @@ static void svt_aom_set_prehme_ctrls(MeContext* me_ctx, uint8_t level) {
     }
 }
 
+/*configure the motion field projection of HME*/
+static void svt_aom_set_mv_proj_ctrls(MeContext* me_ctx, uint8_t level) {
+    MvProjCtrls* ctrl = &me_ctx->mv_proj_ctrls;
+
+    switch (level) {
+    case 0:
+        ctrl->enabled = 0;
+        break;
+    case 1:
+        ctrl->enabled           = 1;
+        ctrl->sa                = (SearchArea){16, 8};
+        ctrl->hme_l0_sa_divisor = 1;
+        ctrl->use_tf_mv         = 1;
+        break;
+    case 2:
+        ctrl->enabled           = 1;
+        ctrl->sa                = (SearchArea){16, 8};
+        ctrl->hme_l0_sa_divisor = 2;
+        ctrl->use_tf_mv         = 1;
+        break;
+    default:
+        assert(0);
+        break;
+    }
+}
+
+/*
+* Get the motion field projection level (0-2). The motion field and the TF HME centres used for the projection
+* are kept per picture at the input resolution.
+*/
+uint8_t svt_aom_get_mv_proj_level(SequenceControlSet* scs, PictureParentControlSet* pcs) {
+    uint8_t mv_proj_level = 0;
+    if (scs->static_config.rtc || pcs->enc_mode <= ENC_M9) {
+        mv_proj_level = 0;
+    } else {
+        mv_proj_level = 2;
+    }
+    if (scs->static_config.superres_mode > SUPERRES_NONE || scs->static_config.resize_mode > RESIZE_NONE ||
+        scs->static_config.pass == ENC_FIRST_PASS || !pcs->enable_hme_level0_flag) {
+        mv_proj_level = 0;
+    }
+    return mv_proj_level;
+}
+
 /************************************************
  * Set ME/HME Params for Altref Temporal Filtering
  ************************************************/
@@ -754,6 +798,8 @@ void svt_aom_sig_deriv_me(SequenceControlSet* scs, PictureParentControlSet* pcs,
 
     svt_aom_set_prehme_ctrls(me_ctx, prehme_level);
 
+    svt_aom_set_mv_proj_ctrls(me_ctx, svt_aom_get_mv_proj_level(scs, pcs));
+
     // Set hme/me based reference pruning level (0-4)
 
     uint8_t me_ref_prune_level = 0;
@@ -875,6 +921,7 @@ void svt_aom_sig_deriv_me_tf(PictureParentControlSet* pcs, MeContext* me_ctx) {
 
     uint8_t prehme_level = 0;
     svt_aom_set_prehme_ctrls(me_ctx, prehme_level);
+    svt_aom_set_mv_proj_ctrls(me_ctx, 0);
 
     // Set hme/me based reference pruning level (0-4)
     // Ref pruning is disallowed for TF in motion_estimate_sb()
@@ -8567,7 +8614,7 @@ Input   : encoder mode and tune
 Output  : EncDec Kernel signal(s)
 ******************************************************/
 static EbErrorType rtime_alloc_ec_ctx_array(PictureControlSet* pcs, uint16_t all_sb) {
-    EB_MALLOC_ARRAY(pcs->ec_ctx_array, all_sb);
+    EB_ARENA_MALLOC_ARRAY(&pcs->arena, pcs->ec_ctx_array, all_sb);
     return EB_ErrorNone;
 }
 
@@ -46,6 +46,7 @@ void    svt_aom_sig_deriv_enc_dec_pd0(SequenceControlSet* scs, PictureControlSet
 void    svt_aom_sig_deriv_enc_dec_common(SequenceControlSet* scs, PictureControlSet* pcs, ModeDecisionContext* ctx);
 
 void svt_aom_sig_deriv_me(SequenceControlSet* scs, PictureParentControlSet* pcs, MeContext* me_ctx);
+uint8_t svt_aom_get_mv_proj_level(SequenceControlSet* scs, PictureParentControlSet* pcs);
 void svt_aom_sig_deriv_enc_dec_default(PictureControlSet* pcs, ModeDecisionContext* ctx);
 void svt_aom_sig_deriv_enc_dec_rtc(PictureControlSet* pcs, ModeDecisionContext* ctx);
 void svt_aom_sig_deriv_enc_dec_allintra(PictureControlSet* pcs, ModeDecisionContext* ctx);
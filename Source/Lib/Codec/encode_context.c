@@ -61,6 +61,7 @@ static void encode_context_dctor(EbPtr p) {
     EB_DESTROY_MUTEX(obj->total_number_of_shown_frames_mutex);
     EB_DESTROY_MUTEX(obj->sc_buffer_mutex);
     EB_DESTROY_MUTEX(obj->stat_file_mutex);
+    EB_DESTROY_MUTEX(obj->me_field_sink_mutex);
     EB_DESTROY_MUTEX(obj->frame_updated_mutex);
     EB_DELETE(obj->prediction_structure_group_ptr);
     EB_DELETE_PTR_ARRAY(obj->picture_decision_reorder_queue, obj->picture_decision_reorder_queue_size);
@@ -75,6 +76,8 @@ static void encode_context_dctor(EbPtr p) {
     EB_DELETE_PTR_ARRAY(obj->packetization_reorder_queue, obj->packetization_reorder_queue_size);
     obj->packetization_reorder_queue_size = 0;
     EB_FREE(obj->stats_out.stat);
+    EB_FREE_ALIGNED_ARRAY(obj->stream_quants);
+    EB_FREE_ALIGNED_ARRAY(obj->stream_deq);
     destroy_stats_buffer(&obj->stats_buf_context, obj->frame_stats_buffer);
     // coded_frames_stat_queue[] entries are borrowed from the pool; free the pool + the
     // (alias) pointer array once each.
@@ -121,6 +124,7 @@ EbErrorType svt_aom_encode_context_ctor(EncodeContext* enc_ctx, EbPtr object_ini
     enc_ctx->recode_tolerance = 25;
     enc_ctx->rc_cfg.min_cr    = 0;
     EB_CREATE_MUTEX(enc_ctx->stat_file_mutex);
+    EB_CREATE_MUTEX(enc_ctx->me_field_sink_mutex);
     enc_ctx->num_lap_buffers = 0; // lap not supported for now
     int* num_lap_buffers     = &enc_ctx->num_lap_buffers;
     create_stats_buffer(&enc_ctx->frame_stats_buffer, &enc_ctx->stats_buf_context, *num_lap_buffers);
@@ -80,6 +80,11 @@ typedef struct EncodeContext {
     // Output Buffer Fifos
     EbFifo* stream_output_fifo_ptr;
     EbFifo* recon_output_fifo_ptr;
+    // Memory of the output packets, alloc is NULL unless set by the application
+    SvtAv1OutputAllocator output_allocator;
+    // Receiver of the open-loop motion fields, write is NULL unless set by the application
+    SvtAv1MeFieldSink me_field_sink;
+    EbHandle          me_field_sink_mutex;
 
     // Picture Buffer Fifos
     EbFifo* reference_picture_pool_fifo_ptr;
@@ -184,10 +189,16 @@ typedef struct EncodeContext {
     uint32_t         cr_sb_end;
     uint32_t         cr_sb_index; // SB cycling index (persists across frames)
     SvtAv1RoiMapEvt* roi_map_evt;
-    Quants           quants_bd; // follows input bit depth
-    Dequants         deq_bd; // follows input bit depth
-    Quants           quants_8bit; // 8bit
-    Dequants         deq_8bit; // 8bit
+    // Quantizers of qindex offset 0, shared by all the encoders of the process
+    // unless sharpness makes them depend on the first picture
+    const Quants*   quants_bd; // follows input bit depth
+    const Dequants* deq_bd; // follows input bit depth
+    const Quants*   quants_8bit; // 8bit
+    const Dequants* deq_8bit; // 8bit
+    // Quantizers built for this stream when sharpness is set, [0] 8bit, [1]
+    // input bit depth; NULL otherwise
+    Quants*   stream_quants;
+    Dequants* stream_deq;
     uint32_t         frames_since_last_cdf_update; // For selective CDF disable
 #if CONFIG_SINGLE_THREAD_KERNEL
     void* st_me_context; // MotionEstimationContext_t* for inline TF in ST mode
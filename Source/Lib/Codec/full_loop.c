@@ -12,6 +12,7 @@
 
 #include "definitions.h"
 #include "full_loop.h"
+#include "md_config_process.h"
 #include "pcs.h"
 #include "rd_cost.h"
 #include "aom_dsp_rtcd.h"
@@ -1269,22 +1270,22 @@ void svt_aom_quantize_inv_quantize_light(PictureControlSet* pcs, int32_t* coeff,
 
     TxSize adjusted_tx_size = aom_av1_get_adjusted_tx_size(txsize);
 
-    const QmVal* q_matrix = pcs->ppcs->gqmatrix[qmatrix_level][PLANE_Y][adjusted_tx_size];
+    const QmVal* q_matrix = svt_aom_gqmatrix[qmatrix_level][PLANE_Y][adjusted_tx_size];
 
-    const QmVal* iq_matrix = pcs->ppcs->giqmatrix[qmatrix_level][PLANE_Y][adjusted_tx_size];
+    const QmVal* iq_matrix = svt_aom_giqmatrix[qmatrix_level][PLANE_Y][adjusted_tx_size];
 
     if (q_matrix == NULL && iq_matrix == NULL) {
 #if CONFIG_ENABLE_HIGH_BIT_DEPTH
         if (bit_depth > EB_EIGHT_BIT) {
             svt_aom_highbd_quantize_b((TranLow*)coeff,
                                       n_coeffs,
-                                      enc_ctx->quants_bd.y_zbin[q_index],
-                                      enc_ctx->quants_bd.y_round[q_index],
-                                      enc_ctx->quants_bd.y_quant[q_index],
-                                      enc_ctx->quants_bd.y_quant_shift[q_index],
+                                      enc_ctx->quants_bd->y_zbin[q_index],
+                                      enc_ctx->quants_bd->y_round[q_index],
+                                      enc_ctx->quants_bd->y_quant[q_index],
+                                      enc_ctx->quants_bd->y_quant_shift[q_index],
                                       quant_coeff,
                                       (TranLow*)recon_coeff,
-                                      enc_ctx->deq_bd.v_dequant_qtx[q_index],
+                                      enc_ctx->deq_bd->v_dequant_qtx[q_index],
                                       eob,
                                       scan_order->scan,
                                       scan_order->iscan,
@@ -1298,13 +1299,13 @@ void svt_aom_quantize_inv_quantize_light(PictureControlSet* pcs, int32_t* coeff,
         {
             svt_aom_quantize_b((TranLow*)coeff,
                                n_coeffs,
-                               enc_ctx->quants_8bit.v_zbin[q_index],
-                               enc_ctx->quants_8bit.v_round[q_index],
-                               enc_ctx->quants_8bit.v_quant[q_index],
-                               enc_ctx->quants_8bit.v_quant_shift[q_index],
+                               enc_ctx->quants_8bit->v_zbin[q_index],
+                               enc_ctx->quants_8bit->v_round[q_index],
+                               enc_ctx->quants_8bit->v_quant[q_index],
+                               enc_ctx->quants_8bit->v_quant_shift[q_index],
                                quant_coeff,
                                (TranLow*)recon_coeff,
-                               enc_ctx->deq_8bit.y_dequant_qtx[q_index],
+                               enc_ctx->deq_8bit->y_dequant_qtx[q_index],
                                eob,
                                scan_order->scan,
                                scan_order->iscan,
@@ -1317,13 +1318,13 @@ void svt_aom_quantize_inv_quantize_light(PictureControlSet* pcs, int32_t* coeff,
         if (bit_depth > EB_EIGHT_BIT) {
             svt_av1_highbd_quantize_b_qm((TranLow*)coeff,
                                          n_coeffs,
-                                         enc_ctx->quants_bd.y_zbin[q_index],
-                                         enc_ctx->quants_bd.y_round[q_index],
-                                         enc_ctx->quants_bd.y_quant[q_index],
-                                         enc_ctx->quants_bd.y_quant_shift[q_index],
+                                         enc_ctx->quants_bd->y_zbin[q_index],
+                                         enc_ctx->quants_bd->y_round[q_index],
+                                         enc_ctx->quants_bd->y_quant[q_index],
+                                         enc_ctx->quants_bd->y_quant_shift[q_index],
                                          quant_coeff,
                                          (TranLow*)recon_coeff,
-                                         enc_ctx->deq_bd.v_dequant_qtx[q_index],
+                                         enc_ctx->deq_bd->v_dequant_qtx[q_index],
                                          eob,
                                          scan_order->scan,
                                          scan_order->iscan,
@@ -1335,13 +1336,13 @@ void svt_aom_quantize_inv_quantize_light(PictureControlSet* pcs, int32_t* coeff,
         {
             svt_av1_quantize_b_qm((TranLow*)coeff,
                                   n_coeffs,
-                                  enc_ctx->quants_8bit.v_zbin[q_index],
-                                  enc_ctx->quants_8bit.v_round[q_index],
-                                  enc_ctx->quants_8bit.v_quant[q_index],
-                                  enc_ctx->quants_8bit.v_quant_shift[q_index],
+                                  enc_ctx->quants_8bit->v_zbin[q_index],
+                                  enc_ctx->quants_8bit->v_round[q_index],
+                                  enc_ctx->quants_8bit->v_quant[q_index],
+                                  enc_ctx->quants_8bit->v_quant_shift[q_index],
                                   quant_coeff,
                                   (TranLow*)recon_coeff,
-                                  enc_ctx->deq_8bit.y_dequant_qtx[q_index],
+                                  enc_ctx->deq_8bit->y_dequant_qtx[q_index],
                                   eob,
                                   scan_order->scan,
                                   scan_order->iscan,
@@ -1533,8 +1534,8 @@ uint8_t svt_aom_quantize_inv_quantize(PictureControlSet* pcs, ModeDecisionContex
 
     TxSize          adjusted_tx_size = aom_av1_get_adjusted_tx_size(txsize);
     MacroblockPlane candidate_plane;
-    const QmVal*    q_matrix  = pcs->ppcs->gqmatrix[qmatrix_level][plane][adjusted_tx_size];
-    const QmVal*    iq_matrix = pcs->ppcs->giqmatrix[qmatrix_level][plane][adjusted_tx_size];
+    const QmVal*    q_matrix  = svt_aom_gqmatrix[qmatrix_level][plane][adjusted_tx_size];
+    const QmVal*    iq_matrix = svt_aom_giqmatrix[qmatrix_level][plane][adjusted_tx_size];
     int32_t         q_index   = pcs->ppcs->frm_hdr.delta_q_params.delta_q_present
                   ? qindex
                   : pcs->ppcs->frm_hdr.quantization_params.base_q_idx;
@@ -1550,61 +1551,61 @@ uint8_t svt_aom_quantize_inv_quantize(PictureControlSet* pcs, ModeDecisionContex
     }
     if (bit_depth == EB_EIGHT_BIT) {
         if (component_type == COMPONENT_LUMA) {
-            candidate_plane.quant_qtx       = enc_ctx->quants_8bit.y_quant[q_index];
-            candidate_plane.quant_fp_qtx    = enc_ctx->quants_8bit.y_quant_fp[q_index];
-            candidate_plane.round_fp_qtx    = enc_ctx->quants_8bit.y_round_fp[q_index];
-            candidate_plane.quant_shift_qtx = enc_ctx->quants_8bit.y_quant_shift[q_index];
-            candidate_plane.zbin_qtx        = enc_ctx->quants_8bit.y_zbin[q_index];
-            candidate_plane.round_qtx       = enc_ctx->quants_8bit.y_round[q_index];
-            candidate_plane.dequant_qtx     = enc_ctx->deq_8bit.y_dequant_qtx[q_index];
+            candidate_plane.quant_qtx       = enc_ctx->quants_8bit->y_quant[q_index];
+            candidate_plane.quant_fp_qtx    = enc_ctx->quants_8bit->y_quant_fp[q_index];
+            candidate_plane.round_fp_qtx    = enc_ctx->quants_8bit->y_round_fp[q_index];
+            candidate_plane.quant_shift_qtx = enc_ctx->quants_8bit->y_quant_shift[q_index];
+            candidate_plane.zbin_qtx        = enc_ctx->quants_8bit->y_zbin[q_index];
+            candidate_plane.round_qtx       = enc_ctx->quants_8bit->y_round[q_index];
+            candidate_plane.dequant_qtx     = enc_ctx->deq_8bit->y_dequant_qtx[q_index];
         } else if (component_type == COMPONENT_CHROMA_CB) {
-            candidate_plane.quant_qtx       = enc_ctx->quants_8bit.u_quant[q_index];
-            candidate_plane.quant_fp_qtx    = enc_ctx->quants_8bit.u_quant_fp[q_index];
-            candidate_plane.round_fp_qtx    = enc_ctx->quants_8bit.u_round_fp[q_index];
-            candidate_plane.quant_shift_qtx = enc_ctx->quants_8bit.u_quant_shift[q_index];
-            candidate_plane.zbin_qtx        = enc_ctx->quants_8bit.u_zbin[q_index];
-            candidate_plane.round_qtx       = enc_ctx->quants_8bit.u_round[q_index];
-            candidate_plane.dequant_qtx     = enc_ctx->deq_8bit.u_dequant_qtx[q_index];
+            candidate_plane.quant_qtx       = enc_ctx->quants_8bit->u_quant[q_index];
+            candidate_plane.quant_fp_qtx    = enc_ctx->quants_8bit->u_quant_fp[q_index];
+            candidate_plane.round_fp_qtx    = enc_ctx->quants_8bit->u_round_fp[q_index];
+            candidate_plane.quant_shift_qtx = enc_ctx->quants_8bit->u_quant_shift[q_index];
+            candidate_plane.zbin_qtx        = enc_ctx->quants_8bit->u_zbin[q_index];
+            candidate_plane.round_qtx       = enc_ctx->quants_8bit->u_round[q_index];
+            candidate_plane.dequant_qtx     = enc_ctx->deq_8bit->u_dequant_qtx[q_index];
         }
 
         else {
-            candidate_plane.quant_qtx       = enc_ctx->quants_8bit.v_quant[q_index];
-            candidate_plane.quant_fp_qtx    = enc_ctx->quants_8bit.v_quant_fp[q_index];
-            candidate_plane.round_fp_qtx    = enc_ctx->quants_8bit.v_round_fp[q_index];
-            candidate_plane.quant_shift_qtx = enc_ctx->quants_8bit.v_quant_shift[q_index];
-            candidate_plane.zbin_qtx        = enc_ctx->quants_8bit.v_zbin[q_index];
-            candidate_plane.round_qtx       = enc_ctx->quants_8bit.v_round[q_index];
-            candidate_plane.dequant_qtx     = enc_ctx->deq_8bit.v_dequant_qtx[q_index];
+            candidate_plane.quant_qtx       = enc_ctx->quants_8bit->v_quant[q_index];
+            candidate_plane.quant_fp_qtx    = enc_ctx->quants_8bit->v_quant_fp[q_index];
+            candidate_plane.round_fp_qtx    = enc_ctx->quants_8bit->v_round_fp[q_index];
+            candidate_plane.quant_shift_qtx = enc_ctx->quants_8bit->v_quant_shift[q_index];
+            candidate_plane.zbin_qtx        = enc_ctx->quants_8bit->v_zbin[q_index];
+            candidate_plane.round_qtx       = enc_ctx->quants_8bit->v_round[q_index];
+            candidate_plane.dequant_qtx     = enc_ctx->deq_8bit->v_dequant_qtx[q_index];
         }
     } else {
         if (component_type == COMPONENT_LUMA) {
-            candidate_plane.quant_qtx       = enc_ctx->quants_bd.y_quant[q_index];
-            candidate_plane.quant_fp_qtx    = enc_ctx->quants_bd.y_quant_fp[q_index];
-            candidate_plane.round_fp_qtx    = enc_ctx->quants_bd.y_round_fp[q_index];
-            candidate_plane.quant_shift_qtx = enc_ctx->quants_bd.y_quant_shift[q_index];
-            candidate_plane.zbin_qtx        = enc_ctx->quants_bd.y_zbin[q_index];
-            candidate_plane.round_qtx       = enc_ctx->quants_bd.y_round[q_index];
-            candidate_plane.dequant_qtx     = enc_ctx->deq_bd.y_dequant_qtx[q_index];
+            candidate_plane.quant_qtx       = enc_ctx->quants_bd->y_quant[q_index];
+            candidate_plane.quant_fp_qtx    = enc_ctx->quants_bd->y_quant_fp[q_index];
+            candidate_plane.round_fp_qtx    = enc_ctx->quants_bd->y_round_fp[q_index];
+            candidate_plane.quant_shift_qtx = enc_ctx->quants_bd->y_quant_shift[q_index];
+            candidate_plane.zbin_qtx        = enc_ctx->quants_bd->y_zbin[q_index];
+            candidate_plane.round_qtx       = enc_ctx->quants_bd->y_round[q_index];
+            candidate_plane.dequant_qtx     = enc_ctx->deq_bd->y_dequant_qtx[q_index];
         }
 
         else if (component_type == COMPONENT_CHROMA_CB) {
-            candidate_plane.quant_qtx       = enc_ctx->quants_bd.u_quant[q_index];
-            candidate_plane.quant_fp_qtx    = enc_ctx->quants_bd.u_quant_fp[q_index];
-            candidate_plane.round_fp_qtx    = enc_ctx->quants_bd.u_round_fp[q_index];
-            candidate_plane.quant_shift_qtx = enc_ctx->quants_bd.u_quant_shift[q_index];
-            candidate_plane.zbin_qtx        = enc_ctx->quants_bd.u_zbin[q_index];
-            candidate_plane.round_qtx       = enc_ctx->quants_bd.u_round[q_index];
-            candidate_plane.dequant_qtx     = enc_ctx->deq_bd.u_dequant_qtx[q_index];
+            candidate_plane.quant_qtx       = enc_ctx->quants_bd->u_quant[q_index];
+            candidate_plane.quant_fp_qtx    = enc_ctx->quants_bd->u_quant_fp[q_index];
+            candidate_plane.round_fp_qtx    = enc_ctx->quants_bd->u_round_fp[q_index];
+            candidate_plane.quant_shift_qtx = enc_ctx->quants_bd->u_quant_shift[q_index];
+            candidate_plane.zbin_qtx        = enc_ctx->quants_bd->u_zbin[q_index];
+            candidate_plane.round_qtx       = enc_ctx->quants_bd->u_round[q_index];
+            candidate_plane.dequant_qtx     = enc_ctx->deq_bd->u_dequant_qtx[q_index];
         }
 
         else {
-            candidate_plane.quant_qtx       = enc_ctx->quants_bd.v_quant[q_index];
-            candidate_plane.quant_fp_qtx    = enc_ctx->quants_bd.v_quant_fp[q_index];
-            candidate_plane.round_fp_qtx    = enc_ctx->quants_bd.v_round_fp[q_index];
-            candidate_plane.quant_shift_qtx = enc_ctx->quants_bd.v_quant_shift[q_index];
-            candidate_plane.zbin_qtx        = enc_ctx->quants_bd.v_zbin[q_index];
-            candidate_plane.round_qtx       = enc_ctx->quants_bd.v_round[q_index];
-            candidate_plane.dequant_qtx     = enc_ctx->deq_bd.v_dequant_qtx[q_index];
+            candidate_plane.quant_qtx       = enc_ctx->quants_bd->v_quant[q_index];
+            candidate_plane.quant_fp_qtx    = enc_ctx->quants_bd->v_quant_fp[q_index];
+            candidate_plane.round_fp_qtx    = enc_ctx->quants_bd->v_round_fp[q_index];
+            candidate_plane.quant_shift_qtx = enc_ctx->quants_bd->v_quant_shift[q_index];
+            candidate_plane.zbin_qtx        = enc_ctx->quants_bd->v_zbin[q_index];
+            candidate_plane.round_qtx       = enc_ctx->quants_bd->v_round[q_index];
+            candidate_plane.dequant_qtx     = enc_ctx->deq_bd->v_dequant_qtx[q_index];
         }
     }
 
@@ -92,13 +92,13 @@ static uint32_t get_xor_hash_value_hbd(const uint16_t a, const uint16_t b, const
     return result;
 }
 
+// The lookup table itself is held by the arena it was created from
 void svt_av1_hash_table_destroy(HashTable* p_hash_table) {
     hash_table_clear_all(p_hash_table);
-    EB_FREE_ARRAY(p_hash_table->p_lookup_table);
     p_hash_table->p_lookup_table = NULL;
 }
 
-EbErrorType svt_aom_rtime_alloc_svt_av1_hash_table_create(HashTable* p_hash_table) {
+EbErrorType svt_aom_rtime_alloc_svt_av1_hash_table_create(HashTable* p_hash_table, SvtArena* arena) {
     EbErrorType err_code = EB_ErrorNone;
     ;
 
@@ -107,7 +107,7 @@ EbErrorType svt_aom_rtime_alloc_svt_av1_hash_table_create(HashTable* p_hash_tabl
         return err_code;
     }
     const int max_addr = 1 << (crc_bits + block_size_bits);
-    EB_CALLOC_ARRAY(p_hash_table->p_lookup_table, max_addr);
+    EB_ARENA_CALLOC_ARRAY(arena, p_hash_table->p_lookup_table, max_addr);
 
     return err_code;
 }
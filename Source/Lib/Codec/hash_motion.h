@@ -16,6 +16,7 @@
 #include "coding_unit.h"
 #include "vector.h"
 #include "pic_buffer_desc.h"
+#include "svt_arena.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,7 +36,7 @@ typedef struct HashTable {
 } HashTable;
 
 void        svt_av1_hash_table_destroy(HashTable* p_hash_table);
-EbErrorType svt_aom_rtime_alloc_svt_av1_hash_table_create(HashTable* p_hash_table);
+EbErrorType svt_aom_rtime_alloc_svt_av1_hash_table_create(HashTable* p_hash_table, SvtArena* arena);
 int32_t     svt_av1_hash_table_count(const HashTable* p_hash_table, uint32_t hash_value);
 Iterator    svt_av1_hash_get_first_iterator(HashTable* p_hash_table, uint32_t hash_value);
 void        svt_av1_generate_block_2x2_hash_value(const Yv12BufferConfig* picture, uint32_t* pic_block_hash);
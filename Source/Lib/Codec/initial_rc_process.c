@@ -800,16 +800,16 @@ EbErrorType svt_aom_initial_rate_control_kernel_iter(void* context) {
             return EB_ErrorNone;
         }
         // The quant/dequant params derivation is performaed 1 time per sequence assuming the qindex offset(s) are 0
-        // then adjusted per TU prior of the quantization at svt_aom_quantize_inv_quantize() depending on the qindex offset(s)
-        if (pcs->picture_number == 0) {
-            Quants* const   quants_8bit = &scs->enc_ctx->quants_8bit;
-            Dequants* const deq_8bit    = &scs->enc_ctx->deq_8bit;
-            svt_av1_build_quantizer(pcs, EB_EIGHT_BIT, 0, 0, 0, 0, 0, quants_8bit, deq_8bit);
+        // then adjusted per TU prior of the quantization at svt_aom_quantize_inv_quantize() depending on the qindex offset(s).
+        // Without sharpness the shared tables set at init are used instead.
+        if (pcs->picture_number == 0 && scs->enc_ctx->stream_quants) {
+            EncodeContext* enc_ctx = scs->enc_ctx;
+            svt_av1_build_quantizer(
+                pcs, EB_EIGHT_BIT, 0, 0, 0, 0, 0, &enc_ctx->stream_quants[0], &enc_ctx->stream_deq[0]);
 
             if (SVT_EFFECTIVE_BIT_DEPTH(scs->static_config.encoder_bit_depth) == EB_TEN_BIT) {
-                Quants* const   quants_bd = &scs->enc_ctx->quants_bd;
-                Dequants* const deq_bd    = &scs->enc_ctx->deq_bd;
-                svt_av1_build_quantizer(pcs, EB_TEN_BIT, 0, 0, 0, 0, 0, quants_bd, deq_bd);
+                svt_av1_build_quantizer(
+                    pcs, EB_TEN_BIT, 0, 0, 0, 0, 0, &enc_ctx->stream_quants[1], &enc_ctx->stream_deq[1]);
             }
         }
         // Set the one pass VBR parameters based on the look ahead data
@@ -15,6 +15,7 @@
 #include "inter_prediction.h"
 #include "convolve.h"
 #include "common_dsp_rtcd.h"
+#include "aom_dsp_rtcd.h"
 #include "utility.h"
 #include "pic_operators.h"
 
@@ -29,6 +30,103 @@ void svt_aom_pack_block(uint8_t* in8_bit_buffer, uint32_t in8_stride, uint8_t* i
         in8_bit_buffer, in8_stride, inn_bit_buffer, inn_stride, out16_bit_buffer, out_stride, width, height);
 }
 
+static void pack_ref_columns(uint8_t* src, uint8_t* src_2b, int32_t stride, int32_t pos, uint16_t* out16_bit_buffer,
+                             uint32_t out_stride, uint32_t width, uint32_t height) {
+    for (int32_t y = 0; y < (int32_t)height; y++) {
+        for (int32_t x = 0; x < (int32_t)width; x++) {
+            const int32_t p   = pos + x;
+            const uint8_t b   = src_2b[(p - (p & 3)) / 4 + y * (stride >> 2)];
+            const uint8_t lsb = (b >> (6 - 2 * (p & 3))) & 3;
+            out16_bit_buffer[x + y * (int32_t)out_stride] = (uint16_t)(src[p + y * stride] << 2) | lsb;
+        }
+    }
+}
+
+void svt_aom_pack_ref_block(uint8_t* src, uint8_t* src_2b, bool compressed_2b, int32_t stride, int32_t pos,
+                            uint16_t* out16_bit_buffer, uint32_t out_stride, uint32_t width, uint32_t height) {
+    if (!compressed_2b) {
+        svt_aom_pack_block(src + pos, stride, src_2b + pos, stride, out16_bit_buffer, out_stride, width, height);
+        return;
+    }
+    // The kernel reads whole bytes over pairs of rows: the columns sharing a byte with pixels outside the block, and
+    // the last row of an odd height, are done one by one. Strides are a multiple of 4 so the columns are the same on
+    // every row.
+    const uint32_t lead    = AOMMIN((uint32_t)(-pos & 3), width);
+    const uint32_t width4  = (width - lead) & ~3u;
+    const uint32_t height2 = width4 ? height & ~1u : 0;
+    if (height2) {
+        svt_compressed_packmsb(src + pos + lead,
+                               stride,
+                               src_2b + (pos + (int32_t)lead) / 4,
+                               stride >> 2,
+                               out16_bit_buffer + lead,
+                               out_stride,
+                               width4,
+                               height2);
+    }
+    pack_ref_columns(src, src_2b, stride, pos, out16_bit_buffer, out_stride, lead, height2);
+    pack_ref_columns(src,
+                     src_2b,
+                     stride,
+                     pos + (int32_t)(lead + width4),
+                     out16_bit_buffer + lead + width4,
+                     out_stride,
+                     width - lead - width4,
+                     height2);
+    pack_ref_columns(src + height2 * stride,
+                     src_2b + height2 * (stride >> 2),
+                     stride,
+                     pos,
+                     out16_bit_buffer + height2 * out_stride,
+                     out_stride,
+                     width,
+                     height - height2);
+}
+
+static void unpack_ref_columns(uint16_t* in16_bit_buffer, uint32_t in_stride, uint8_t* dst, uint8_t* dst_2b,
+                               int32_t stride, int32_t pos, uint32_t width, uint32_t height) {
+    for (int32_t y = 0; y < (int32_t)height; y++) {
+        for (int32_t x = 0; x < (int32_t)width; x++) {
+            const uint16_t v     = in16_bit_buffer[x + y * (int32_t)in_stride];
+            const int32_t  p     = pos + x;
+            const int      shift = 6 - 2 * (p & 3);
+            uint8_t*       b     = dst_2b + (p - (p & 3)) / 4 + y * (stride >> 2);
+            dst[p + y * stride]  = (uint8_t)(v >> 2);
+            *b                   = (uint8_t)((*b & ~(3 << shift)) | ((v & 3) << shift));
+        }
+    }
+}
+
+void svt_aom_unpack_ref_block(uint16_t* in16_bit_buffer, uint32_t in_stride, uint8_t* dst, uint8_t* dst_2b,
+                              bool compressed_2b, int32_t stride, int32_t pos, uint32_t width, uint32_t height) {
+    if (!compressed_2b) {
+        svt_aom_un_pack2d(in16_bit_buffer, in_stride, dst + pos, stride, dst_2b + pos, stride, width, height);
+        return;
+    }
+    // The kernel writes whole bytes: the columns sharing a byte with pixels outside the block are done one by one
+    const uint32_t lead   = AOMMIN((uint32_t)(-pos & 3), width);
+    const uint32_t width4 = (width - lead) & ~3u;
+    if (width4) {
+        svt_unpack_and_2bcompress(in16_bit_buffer + lead,
+                                  in_stride,
+                                  dst + pos + lead,
+                                  stride,
+                                  dst_2b + (pos + (int32_t)lead) / 4,
+                                  stride >> 2,
+                                  width4,
+                                  height);
+    }
+    unpack_ref_columns(in16_bit_buffer, in_stride, dst, dst_2b, stride, pos, lead, height);
+    unpack_ref_columns(in16_bit_buffer + lead + width4,
+                       in_stride,
+                       dst,
+                       dst_2b,
+                       stride,
+                       pos + (int32_t)(lead + width4),
+                       width - lead - width4,
+                       height);
+}
+
 const int             div_mult[32] = {0,    16384, 8192, 5461, 4096, 3276, 2730, 2340, 2048, 1820, 1638,
                                       1489, 1365,  1260, 1170, 1092, 1024, 963,  910,  862,  819,  780,
                                       744,  712,   682,  655,  630,  606,  585,  564,  546,  528};
@@ -1285,8 +1383,9 @@ void svt_inter_predictor_pd0(const uint8_t* src, int32_t src_stride, uint8_t* ds
     }
 }
 
-void svt_inter_predictor_light_pd1(uint8_t* src, uint8_t* src_2b, int32_t src_stride, uint8_t* dst, int32_t dst_stride,
-                                   int32_t w, int32_t h, InterpFilters interp_filters, SubpelParams* subpel_params,
+void svt_inter_predictor_light_pd1(uint8_t* src, uint8_t* src_2b, bool compressed_2b, int32_t src_stride,
+                                   int32_t src_pos, uint8_t* dst, int32_t dst_stride, int32_t w, int32_t h,
+                                   InterpFilters interp_filters, SubpelParams* subpel_params,
                                    ConvolveParams* conv_params, int32_t bd) {
     InterpFilterParams filter_params_x, filter_params_y;
     av1_get_convolve_filter_params(interp_filters, &filter_params_x, &filter_params_y, w, h);
@@ -1314,14 +1413,15 @@ void svt_inter_predictor_light_pd1(uint8_t* src, uint8_t* src_2b, int32_t src_st
             src_stride16 = ALIGN_POWER_OF_TWO(src_stride16, 3);
         }
 
-        svt_aom_pack_block(src - offset - (offset * src_stride),
-                           src_stride,
-                           src_2b - offset - (offset * src_stride),
-                           src_stride,
-                           src16,
-                           src_stride16,
-                           w * width_scale + (offset << 1),
-                           h * height_scale + (offset << 1));
+        svt_aom_pack_ref_block(src,
+                               src_2b,
+                               compressed_2b,
+                               src_stride,
+                               src_pos - offset - (offset * src_stride),
+                               src16,
+                               src_stride16,
+                               w * width_scale + (offset << 1),
+                               h * height_scale + (offset << 1));
         uint16_t* src_10b = src16 + offset + (offset * src_stride16);
         uint16_t* dst16   = (uint16_t*)dst;
 
@@ -1360,8 +1460,10 @@ void svt_inter_predictor_light_pd1(uint8_t* src, uint8_t* src_2b, int32_t src_st
 #else
     UNUSED(bd);
     UNUSED(src_2b);
+    UNUSED(compressed_2b);
 #endif
     {
+        src += src_pos;
         if (is_scaled) {
             svt_av1_convolve_2d_scale(src,
                                       src_stride,
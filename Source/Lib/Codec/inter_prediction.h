@@ -99,8 +99,10 @@ typedef struct WedgeParamsType {
 
 void svt_inter_predictor_pd0(const uint8_t* src, int32_t src_stride, uint8_t* dst, int32_t dst_stride, int32_t w,
                              int32_t h, SubpelParams* subpel_params, ConvolveParams* conv_params);
-void svt_inter_predictor_light_pd1(uint8_t* src, uint8_t* src_2b, int32_t src_stride, uint8_t* dst, int32_t dst_stride,
-                                   int32_t w, int32_t h, InterpFilters interp_filters, SubpelParams* subpel_params,
+// src and src_2b are the plane origins and src_pos the pixel offset of the block
+void svt_inter_predictor_light_pd1(uint8_t* src, uint8_t* src_2b, bool compressed_2b, int32_t src_stride,
+                                   int32_t src_pos, uint8_t* dst, int32_t dst_stride, int32_t w, int32_t h,
+                                   InterpFilters interp_filters, SubpelParams* subpel_params,
                                    ConvolveParams* conv_params, int32_t bd);
 void svt_inter_predictor(const uint8_t* src, int32_t src_stride, uint8_t* dst, int32_t dst_stride,
                          const SubpelParams* subpel_params, const ScaleFactors* sf, int32_t w, int32_t h,
@@ -173,6 +175,13 @@ static INLINE int valid_ref_frame_size(int ref_width, int ref_height, int this_w
 
 void svt_aom_pack_block(uint8_t* in8_bit_buffer, uint32_t in8_stride, uint8_t* inn_bit_buffer, uint32_t inn_stride,
                         uint16_t* out16_bit_buffer, uint32_t out_stride, uint32_t width, uint32_t height);
+// Pack the block at pixel offset pos of a split plane, given by the origins of its 8 bit and 2 bit planes and a stride
+// in pixels. The 2 bit plane may be compressed, see EbPictureBufferDesc.compressed_2b.
+void svt_aom_pack_ref_block(uint8_t* src, uint8_t* src_2b, bool compressed_2b, int32_t stride, int32_t pos,
+                            uint16_t* out16_bit_buffer, uint32_t out_stride, uint32_t width, uint32_t height);
+// The inverse of svt_aom_pack_ref_block(): split a 16 bit block into the 8 bit and 2 bit planes
+void svt_aom_unpack_ref_block(uint16_t* in16_bit_buffer, uint32_t in_stride, uint8_t* dst, uint8_t* dst_2b,
+                              bool compressed_2b, int32_t stride, int32_t pos, uint32_t width, uint32_t height);
 
 void highbd_convolve_2d_for_intrabc(const uint16_t* src, int src_stride, uint16_t* dst, int dst_stride, int w, int h,
                                     int subpel_x_q4, int subpel_y_q4, ConvolveParams* conv_params, int bd);
@@ -15,14 +15,37 @@
 #include <string.h>
 #include <assert.h>
 #include "enc_handle.h" // for EbThreadContext (struct _EbThreadContext)
+#include "svt_malloc.h"
+#if CONFIG_KERNEL_POOL
+#include "kernel_pool.h"
+#endif
 
-void svt_kernel_dispatcher_init(SvtKernelDispatcher* dispatcher) {
+EbErrorType svt_kernel_dispatcher_init(SvtKernelDispatcher* dispatcher, uint32_t max_kernels) {
     memset(dispatcher, 0, sizeof(*dispatcher));
+    EB_CALLOC_ARRAY(dispatcher->kernels, max_kernels);
+    dispatcher->max_kernels = max_kernels;
+    return EB_ErrorNone;
+}
+
+void svt_kernel_dispatcher_deinit(SvtKernelDispatcher* dispatcher) {
+#if CONFIG_KERNEL_POOL
+    EB_DELETE(dispatcher->group);
+    if (dispatcher->shared_pool) {
+        svt_kernel_pool_release_shared();
+        dispatcher->pool        = NULL;
+        dispatcher->shared_pool = false;
+    } else {
+        EB_DELETE(dispatcher->pool);
+    }
+#endif
+    EB_FREE_ARRAY(dispatcher->kernels);
+    dispatcher->num_kernels = 0;
+    dispatcher->max_kernels = 0;
 }
 
 void svt_kernel_dispatcher_register(SvtKernelDispatcher* dispatcher, SvtKernelIterFn iter_fn, void* context,
                                     EbFifo* input_fifo, const char* name) {
-    assert(dispatcher->num_kernels < SVT_MAX_KERNELS);
+    assert(dispatcher->num_kernels < dispatcher->max_kernels);
     SvtKernelDesc* desc = &dispatcher->kernels[dispatcher->num_kernels++];
     desc->iter_fn       = iter_fn;
     desc->context       = context;
@@ -48,6 +71,38 @@ void svt_kernel_dispatcher_run(SvtKernelDispatcher* dispatcher) {
     } while (progress);
 }
 
+#if CONFIG_KERNEL_POOL
+static EbErrorType kernel_dispatcher_attach(SvtKernelDispatcher* dispatcher, uint32_t weight) {
+    EB_NEW(dispatcher->group, svt_kernel_group_ctor, dispatcher->pool, dispatcher->num_kernels, weight);
+    for (uint32_t i = 0; i < dispatcher->num_kernels; i++) {
+        const SvtKernelDesc* desc = &dispatcher->kernels[i];
+        EbErrorType          err  = svt_kernel_pool_register(
+            dispatcher->group, desc->iter_fn, desc->context, desc->input_fifo, desc->name);
+        if (err != EB_ErrorNone) {
+            return err;
+        }
+    }
+    return svt_kernel_pool_start(dispatcher->pool);
+}
+
+EbErrorType svt_kernel_dispatcher_start_workers(SvtKernelDispatcher* dispatcher, uint32_t num_workers) {
+    assert(!dispatcher->active && !dispatcher->pool);
+    EB_NEW(dispatcher->pool, svt_kernel_pool_ctor, num_workers);
+    return kernel_dispatcher_attach(dispatcher, 1);
+}
+
+EbErrorType svt_kernel_dispatcher_attach_shared_pool(SvtKernelDispatcher* dispatcher, uint32_t weight,
+                                                     uint32_t max_running, uint32_t default_running) {
+    assert(!dispatcher->active && !dispatcher->pool);
+    EbErrorType err = svt_kernel_pool_acquire_shared(&dispatcher->pool, max_running, default_running);
+    if (err != EB_ErrorNone) {
+        return err;
+    }
+    dispatcher->shared_pool = true;
+    return kernel_dispatcher_attach(dispatcher, weight);
+}
+#endif
+
 EbErrorType svt_create_kernel_or_thread(EbHandle* thread_handle, void* (*kernel_fn)(void*), SvtKernelIterFn iter_fn,
                                         EbThreadContext* thread_ctx, EbFifo* input_fifo, const char* name,
                                         SvtKernelDispatcher* dispatcher) {
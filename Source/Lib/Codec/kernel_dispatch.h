@@ -34,10 +34,8 @@ extern "C" {
 typedef EbErrorType (*SvtKernelIterFn)(void* context);
 
 /**************************************
- * Kernel descriptor — one per pipeline stage.
+ * Kernel descriptor — one per registered kernel instance.
  **************************************/
-#define SVT_MAX_KERNELS 32
-
 typedef struct SvtKernelDesc {
     SvtKernelIterFn iter_fn; // single-iteration function
     void*           context; // kernel-specific context (EbThreadContext->priv)
@@ -46,20 +44,34 @@ typedef struct SvtKernelDesc {
 } SvtKernelDesc;
 
 /**************************************
- * Kernel dispatcher — cooperative scheduler for single-thread mode.
- * Replaces 16 OS threads with one cooperative loop.
+ * Kernel dispatcher — table of kernel instances driven either
+ * cooperatively by the calling thread (single-thread mode, lp=1) or by
+ * N worker threads sharing the table (multi-worker mode).
+ *
+ * In multi-worker mode each kernel's input FIFO acts as its readiness
+ * signal: posting an object to it schedules that kernel on the next free
+ * worker, so no worker ever polls or blocks in svt_get_full_object().
  **************************************/
 typedef struct SvtKernelDispatcher {
-    SvtKernelDesc kernels[SVT_MAX_KERNELS];
-    uint32_t      num_kernels;
-    bool          active; // true when single-thread dispatch mode is enabled
+    SvtKernelDesc* kernels;
+    uint32_t       num_kernels;
+    uint32_t       max_kernels;
+    bool           active; // true when single-thread dispatch mode is enabled
+#if CONFIG_KERNEL_POOL
+    struct SvtKernelPool*  pool; // multi-worker mode backend, NULL otherwise
+    struct SvtKernelGroup* group; // this table's kernels attached to pool
+    bool                   shared_pool; // pool is the process-wide shared pool
+#endif
 } SvtKernelDispatcher;
 
-// Initialize the dispatcher (zeroes everything, sets active=false)
-void svt_kernel_dispatcher_init(SvtKernelDispatcher* dispatcher);
+// Initialize the dispatcher with room for max_kernels instances (active=false)
+EbErrorType svt_kernel_dispatcher_init(SvtKernelDispatcher* dispatcher, uint32_t max_kernels);
+
+// Stop the workers (if any) and release the kernel table
+void svt_kernel_dispatcher_deinit(SvtKernelDispatcher* dispatcher);
 
-// Register a kernel for single-thread dispatch.
-// Call in pipeline order (stage 0 first, stage 15 last).
+// Register a kernel instance. Call in pipeline order (stage 0 first);
+// single-thread dispatch visits the kernels in registration order.
 void svt_kernel_dispatcher_register(SvtKernelDispatcher* dispatcher, SvtKernelIterFn iter_fn, void* context,
                                     EbFifo* input_fifo, const char* name);
 
@@ -68,6 +80,22 @@ void svt_kernel_dispatcher_register(SvtKernelDispatcher* dispatcher, SvtKernelIt
 // is idle (all FIFOs drained) or shutdown is signaled.
 void svt_kernel_dispatcher_run(SvtKernelDispatcher* dispatcher);
 
+#if CONFIG_KERNEL_POOL
+// Multi-worker mode: drive the registered table with num_workers threads
+// running kernels concurrently. Every input FIFO is armed as the readiness
+// signal of its kernel. Call once, after all kernels are registered.
+EbErrorType svt_kernel_dispatcher_start_workers(SvtKernelDispatcher* dispatcher, uint32_t num_workers);
+
+// Multi-worker mode on the process-wide pool shared with other dispatchers.
+// weight is this table's share of the workers when several tables have work;
+// max_running caps the shared pool's concurrently running workers (and with
+// them its threads), default_running is used instead when it is 0. A non-zero
+// max_running must match the pool's if another table created it. Call once,
+// after all kernels are registered.
+EbErrorType svt_kernel_dispatcher_attach_shared_pool(SvtKernelDispatcher* dispatcher, uint32_t weight,
+                                                     uint32_t max_running, uint32_t default_running);
+#endif
+
 /**************************************
  * Wrapper: create kernel thread OR register for dispatch.
  *
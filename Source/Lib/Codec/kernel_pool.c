@@ -0,0 +1,493 @@
+/*
+* Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include "kernel_pool.h"
+
+#if CONFIG_KERNEL_POOL
+#include <assert.h>
+#include <string.h>
+#include "svt_threads.h"
+#include "svt_malloc.h"
+#include "svt_time.h"
+#include "utility.h"
+#include "svt_log.h"
+
+// pass advanced by one microsecond of on-CPU time at weight 1
+#define KERNEL_POOL_PASS_SCALE 256
+// workers kept beyond target_running to take over from blocked kernels
+#define KERNEL_POOL_SPARE_THREADS 2
+// yields a worker blocking at max_threads grants woken workers before the pool
+// is treated as stuck
+#define KERNEL_POOL_STUCK_YIELDS 64
+
+// Worker of the pool the calling thread belongs to, NULL for foreign threads.
+static SVT_THREAD_LOCAL SvtKernelWorker* current_worker;
+
+static uint64_t kernel_pool_now_us(void) {
+    uint64_t seconds, useconds;
+    svt_av1_get_time(&seconds, &useconds);
+    return seconds * 1000000 + useconds;
+}
+
+static void deque_push_tail(SvtKernelDeque* dq, uint32_t capacity, SvtKernelSlot* slot) {
+    assert(dq->count < capacity);
+    dq->slots[(dq->head + dq->count++) % capacity] = slot;
+}
+
+static SvtKernelSlot* deque_remove(SvtKernelDeque* dq, uint32_t capacity, uint32_t pos) {
+    SvtKernelSlot* slot = dq->slots[(dq->head + pos) % capacity];
+    if (pos == 0) {
+        dq->head = (dq->head + 1) % capacity;
+    } else {
+        for (uint32_t i = pos + 1; i < dq->count; i++) {
+            dq->slots[(dq->head + i - 1) % capacity] = dq->slots[(dq->head + i) % capacity];
+        }
+    }
+    dq->count--;
+    return slot;
+}
+
+// Newest (tail) or oldest (head) queued slot of the group, NULL if none.
+static SvtKernelSlot* deque_take(SvtKernelDeque* dq, uint32_t capacity, const SvtKernelGroup* group, bool newest) {
+    for (uint32_t n = 0; n < dq->count; n++) {
+        const uint32_t pos = newest ? dq->count - 1 - n : n;
+        if (dq->slots[(dq->head + pos) % capacity]->group == group) {
+            return deque_remove(dq, capacity, pos);
+        }
+    }
+    return NULL;
+}
+
+// Move the queued slots of dq to the start of slots, which takes its place.
+static void deque_move(SvtKernelDeque* dq, uint32_t capacity, SvtKernelSlot** slots) {
+    for (uint32_t i = 0; i < dq->count; i++) {
+        slots[i] = dq->slots[(dq->head + i) % capacity];
+    }
+    EB_FREE_ARRAY(dq->slots);
+    dq->slots = slots;
+    dq->head  = 0;
+}
+
+static void kernel_pool_queue_locked(SvtKernelPool* pool, SvtKernelDeque* dq, SvtKernelSlot* slot) {
+    SvtKernelGroup* group = slot->group;
+    slot->state           = SVT_KERNEL_SLOT_QUEUED;
+    deque_push_tail(dq, pool->capacity, slot);
+    if (!group->num_queued++) {
+        group->pass = MAX(group->pass, pool->virtual_time);
+    }
+    pool->num_queued++;
+}
+
+// The group's queued slot that was registered last, i.e. the one furthest down
+// the pipeline. Blocked kernels mostly wait for a downstream stage to release an
+// object, so draining first keeps the pool from piling up more blocked
+// upstream kernels (and the threads under them).
+static SvtKernelSlot* kernel_pool_take_downstream_locked(SvtKernelPool* pool, const SvtKernelGroup* group) {
+    SvtKernelDeque* best_dq  = NULL;
+    uint32_t        best_pos = 0;
+    SvtKernelSlot*  best     = NULL;
+    for (uint32_t i = 0; i <= pool->num_threads; i++) {
+        SvtKernelDeque* dq = i < pool->num_threads ? &pool->workers[i]->deque : &pool->injector;
+        for (uint32_t pos = 0; pos < dq->count; pos++) {
+            SvtKernelSlot* slot = dq->slots[(dq->head + pos) % pool->capacity];
+            if (slot->group == group && (!best || slot > best)) {
+                best     = slot;
+                best_dq  = dq;
+                best_pos = pos;
+            }
+        }
+    }
+    return best ? deque_remove(best_dq, pool->capacity, best_pos) : NULL;
+}
+
+// Pick the group with queued work that is furthest behind its fair share, then
+// take its most downstream slot while kernels are blocked, else its newest slot
+// from our own deque, else its oldest slot of the other workers, else whatever
+// non-worker threads injected.
+static SvtKernelSlot* kernel_pool_take_locked(SvtKernelPool* pool, SvtKernelWorker* worker) {
+    SvtKernelGroup* group = NULL;
+    for (SvtKernelGroup* g = pool->groups; g; g = g->next) {
+        if (g->num_queued && (!group || g->pass < group->pass)) {
+            group = g;
+        }
+    }
+    if (!group) {
+        return NULL;
+    }
+    SvtKernelSlot* slot = pool->num_blocked ? kernel_pool_take_downstream_locked(pool, group) : NULL;
+    if (!slot) {
+        slot = deque_take(&worker->deque, pool->capacity, group, true);
+    }
+    for (uint32_t i = 1; !slot && i < pool->num_threads; i++) {
+        slot = deque_take(&pool->workers[(worker->index + i) % pool->num_threads]->deque, pool->capacity, group, false);
+    }
+    if (!slot) {
+        slot = deque_take(&pool->injector, pool->capacity, group, false);
+    }
+    assert(slot);
+    group->num_queued--;
+    pool->num_queued--;
+    pool->virtual_time = group->pass;
+    return slot;
+}
+
+static void* kernel_pool_worker(void* arg);
+
+static void kernel_pool_spawn_locked(SvtKernelPool* pool) {
+    const uint32_t   idx = pool->num_threads;
+    SvtKernelWorker* worker;
+    EB_NO_THROW_CALLOC(worker, 1, sizeof(*worker));
+    if (!worker) {
+        return;
+    }
+    EB_NO_THROW_MALLOC(worker->deque.slots, sizeof(*worker->deque.slots) * pool->capacity);
+    if (!worker->deque.slots) {
+        EB_FREE(worker);
+        return;
+    }
+    worker->pool  = pool;
+    worker->index = idx;
+    char name[16];
+    svt_format_thread_name(name, sizeof(name), "svt-pool", idx);
+    pool->workers[idx] = worker;
+    pool->threads[idx] = svt_create_thread(kernel_pool_worker, worker, name);
+    if (pool->threads[idx]) {
+        EB_NO_THROW_ADD_MEM(pool->threads[idx], 1, EB_THREAD);
+        pool->num_threads++;
+        pool->num_starting++;
+    } else {
+        EB_FREE_ARRAY(worker->deque.slots);
+        EB_FREE(worker);
+        pool->workers[idx] = NULL;
+    }
+}
+
+// Hand queued work to a parked worker, or grow the pool when every worker is
+// busy or blocked and a run permit is free. Past max_threads a worker is only
+// added when every existing one is blocked: the queued kernel may be the one
+// they are waiting on, so holding it back could deadlock the pipeline.
+static void kernel_pool_wake_locked(SvtKernelPool* pool) {
+    if (!pool->num_queued || pool->num_running >= pool->target_running) {
+        return;
+    }
+    if (pool->num_starting) {
+        // a new worker looks at the queue before parking
+        return;
+    }
+    if (pool->num_idle) {
+        svt_post_semaphore(pool->work_semaphore);
+    } else if (pool->num_threads < pool->max_slots &&
+               (pool->num_threads < pool->max_threads || !pool->num_running)) {
+        kernel_pool_spawn_locked(pool);
+    }
+}
+
+static void kernel_pool_wait_hook(void* ctx, bool begin) {
+    SvtKernelWorker* worker = (SvtKernelWorker*)ctx;
+    SvtKernelPool*   pool   = worker->pool;
+    // Blocked time is not charged to the group's fair share.
+    const uint64_t now = kernel_pool_now_us();
+    if (begin) {
+        worker->run_time_us += now - worker->run_start_us;
+    } else {
+        worker->run_start_us = now;
+    }
+    svt_block_on_mutex(pool->mutex);
+    // A worker whose wait was already satisfied but that has not been scheduled
+    // yet still counts as blocked. Let it run before the last running worker
+    // blocks and the pool grows past max_threads on its account.
+    for (uint32_t i = 0; begin && i < KERNEL_POOL_STUCK_YIELDS && pool->num_running == 1 && pool->num_queued &&
+         !pool->num_idle && !pool->num_starting && pool->num_threads >= pool->max_threads;
+         i++) {
+        svt_release_mutex(pool->mutex);
+        svt_yield_thread();
+        svt_block_on_mutex(pool->mutex);
+    }
+    if (begin) {
+        pool->num_running--;
+        pool->num_blocked++;
+        kernel_pool_wake_locked(pool);
+    } else {
+        // May exceed target_running until this iteration completes.
+        pool->num_running++;
+        pool->num_blocked--;
+    }
+    svt_release_mutex(pool->mutex);
+}
+
+static void* kernel_pool_worker(void* arg) {
+    SvtKernelWorker* worker = (SvtKernelWorker*)arg;
+    SvtKernelPool*   pool   = worker->pool;
+    current_worker          = worker;
+
+    svt_block_on_mutex(pool->mutex);
+    pool->num_starting--;
+    for (;;) {
+        SvtKernelSlot* slot = pool->num_running < pool->target_running ? kernel_pool_take_locked(pool, worker) : NULL;
+        if (slot) {
+            SvtKernelGroup* group = slot->group;
+            slot->state           = SVT_KERNEL_SLOT_RUNNING;
+            slot->rerun           = false;
+            pool->num_running++;
+            group->num_running++;
+            // Pass the rest of the queue on while run permits are left.
+            kernel_pool_wake_locked(pool);
+            svt_release_mutex(pool->mutex);
+
+            worker->run_time_us  = 0;
+            worker->run_start_us = kernel_pool_now_us();
+            svt_set_thread_wait_hook(kernel_pool_wait_hook, worker);
+            const EbErrorType err = slot->iter_fn(slot->context);
+            svt_set_thread_wait_hook(NULL, NULL);
+            worker->run_time_us += kernel_pool_now_us() - worker->run_start_us;
+            const bool pending = err != EB_NoErrorFifoShutdown && svt_fifo_has_pending(slot->input_fifo);
+
+            svt_block_on_mutex(pool->mutex);
+            pool->num_running--;
+            group->num_running--;
+            group->pass += (worker->run_time_us + 1) * KERNEL_POOL_PASS_SCALE / group->weight;
+            if (err == EB_NoErrorFifoShutdown) {
+                slot->state = SVT_KERNEL_SLOT_DONE;
+            } else if (pending || slot->rerun) {
+                // This worker picks the slot up itself and wakes for the rest
+                // once it has, so the pool is not taken for blocked meanwhile.
+                kernel_pool_queue_locked(pool, &worker->deque, slot);
+            } else {
+                slot->state = SVT_KERNEL_SLOT_IDLE;
+            }
+            if (group->detaching && !group->num_queued && !group->num_running) {
+                svt_post_semaphore(group->drained_semaphore);
+            }
+            continue;
+        }
+        if (pool->shutdown && !pool->num_queued) {
+            break;
+        }
+        pool->num_idle++;
+        svt_release_mutex(pool->mutex);
+        svt_block_on_semaphore(pool->work_semaphore);
+        svt_block_on_mutex(pool->mutex);
+        pool->num_idle--;
+    }
+    svt_release_mutex(pool->mutex);
+    return NULL;
+}
+
+void svt_kernel_pool_notify(SvtKernelSlot* slot) {
+    SvtKernelPool* pool = slot->group->pool;
+    svt_block_on_mutex(pool->mutex);
+    if (slot->state == SVT_KERNEL_SLOT_IDLE) {
+        SvtKernelWorker* worker = current_worker;
+        kernel_pool_queue_locked(pool, worker && worker->pool == pool ? &worker->deque : &pool->injector, slot);
+        kernel_pool_wake_locked(pool);
+    } else if (slot->state == SVT_KERNEL_SLOT_RUNNING) {
+        slot->rerun = true;
+    }
+    svt_release_mutex(pool->mutex);
+}
+
+// Make room for max_slots queued slots on every deque and max_slots workers.
+// Runs under the pool mutex, so nothing here may return without the caller
+// getting to release it: all the arrays are allocated first and the pool is
+// left as it was when one of them fails.
+static EbErrorType kernel_pool_reserve_locked(SvtKernelPool* pool, uint32_t max_slots) {
+    if (max_slots <= pool->capacity) {
+        return EB_ErrorNone;
+    }
+    // One deque per worker, plus the injector
+    const uint32_t    num_deques = pool->num_threads + 1;
+    SvtKernelWorker** workers;
+    EbHandle*         threads;
+    SvtKernelSlot***  slots;
+    EB_NO_THROW_CALLOC(workers, max_slots, sizeof(*workers));
+    EB_NO_THROW_CALLOC(threads, max_slots, sizeof(*threads));
+    EB_NO_THROW_CALLOC(slots, num_deques, sizeof(*slots));
+    bool allocated = workers && threads && slots;
+    for (uint32_t i = 0; allocated && i < num_deques; i++) {
+        EB_NO_THROW_MALLOC(slots[i], sizeof(**slots) * max_slots);
+        allocated = slots[i] != NULL;
+    }
+    if (!allocated) {
+        for (uint32_t i = 0; slots && i < num_deques; i++) {
+            EB_FREE_ARRAY(slots[i]);
+        }
+        EB_FREE_ARRAY(slots);
+        EB_FREE_ARRAY(threads);
+        EB_FREE_ARRAY(workers);
+        return EB_ErrorInsufficientResources;
+    }
+    for (uint32_t i = 0; i < pool->num_threads; i++) {
+        deque_move(&pool->workers[i]->deque, pool->capacity, slots[i]);
+    }
+    deque_move(&pool->injector, pool->capacity, slots[pool->num_threads]);
+    EB_FREE_ARRAY(slots);
+    if (pool->num_threads) {
+        memcpy(workers, pool->workers, sizeof(*workers) * pool->num_threads);
+        memcpy(threads, pool->threads, sizeof(*threads) * pool->num_threads);
+    }
+    EB_FREE_ARRAY(pool->workers);
+    EB_FREE_ARRAY(pool->threads);
+    pool->workers  = workers;
+    pool->threads  = threads;
+    pool->capacity = max_slots;
+    return EB_ErrorNone;
+}
+
+static void svt_kernel_group_dctor(EbPtr p) {
+    SvtKernelGroup* group = (SvtKernelGroup*)p;
+    SvtKernelPool*  pool  = group->pool;
+    if (pool) {
+        svt_block_on_mutex(pool->mutex);
+        group->detaching = true;
+        while (group->num_queued || group->num_running) {
+            svt_release_mutex(pool->mutex);
+            svt_block_on_semaphore(group->drained_semaphore);
+            svt_block_on_mutex(pool->mutex);
+        }
+        for (uint32_t i = 0; i < group->num_slots; i++) {
+            group->slots[i].state = SVT_KERNEL_SLOT_DONE;
+        }
+        SvtKernelGroup** link = &pool->groups;
+        while (*link != group) {
+            link = &(*link)->next;
+        }
+        *link = group->next;
+        pool->max_slots -= group->max_slots;
+        svt_release_mutex(pool->mutex);
+    }
+    EB_FREE_ARRAY(group->slots);
+    EB_DESTROY_SEMAPHORE(group->drained_semaphore);
+}
+
+EbErrorType svt_kernel_group_ctor(SvtKernelGroup* group, SvtKernelPool* pool, uint32_t max_slots, uint32_t weight) {
+    group->dctor     = svt_kernel_group_dctor;
+    group->max_slots = max_slots;
+    group->weight    = MAX(1, weight);
+    EB_CALLOC_ARRAY(group->slots, max_slots);
+    EB_CREATE_SEMAPHORE(group->drained_semaphore, 0, 1);
+
+    svt_block_on_mutex(pool->mutex);
+    EbErrorType err = kernel_pool_reserve_locked(pool, pool->max_slots + max_slots);
+    if (err == EB_ErrorNone) {
+        group->pool  = pool;
+        group->pass  = pool->virtual_time;
+        group->next  = pool->groups;
+        pool->groups = group;
+        pool->max_slots += max_slots;
+    }
+    svt_release_mutex(pool->mutex);
+    return err;
+}
+
+static void svt_kernel_pool_dctor(EbPtr p) {
+    SvtKernelPool* pool = (SvtKernelPool*)p;
+    assert(!pool->groups);
+    if (pool->mutex) {
+        svt_block_on_mutex(pool->mutex);
+        pool->shutdown = true;
+        for (uint32_t i = 0; i < pool->num_threads; i++) {
+            svt_post_semaphore(pool->work_semaphore);
+        }
+        svt_release_mutex(pool->mutex);
+    }
+    EB_DESTROY_THREAD_ARRAY(pool->threads, pool->capacity);
+    for (uint32_t i = 0; i < pool->num_threads; i++) {
+        EB_FREE_ARRAY(pool->workers[i]->deque.slots);
+        EB_FREE(pool->workers[i]);
+    }
+    EB_FREE_ARRAY(pool->workers);
+    EB_FREE_ARRAY(pool->injector.slots);
+    EB_DESTROY_SEMAPHORE(pool->work_semaphore);
+    EB_DESTROY_MUTEX(pool->mutex);
+}
+
+EbErrorType svt_kernel_pool_ctor(SvtKernelPool* pool, uint32_t target_running) {
+    pool->dctor          = svt_kernel_pool_dctor;
+    pool->target_running = MAX(1, target_running);
+    pool->max_threads    = pool->target_running + KERNEL_POOL_SPARE_THREADS;
+    EB_CREATE_MUTEX(pool->mutex);
+    EB_CREATE_SEMAPHORE(pool->work_semaphore, 0, INT32_MAX);
+    return EB_ErrorNone;
+}
+
+EbErrorType svt_kernel_pool_register(SvtKernelGroup* group, SvtKernelIterFn iter_fn, void* context,
+                                     EbFifo* input_fifo, const char* name) {
+    if (group->num_slots >= group->max_slots) {
+        return EB_ErrorInsufficientResources;
+    }
+    SvtKernelSlot* slot = &group->slots[group->num_slots++];
+    slot->iter_fn       = iter_fn;
+    slot->context       = context;
+    slot->input_fifo    = input_fifo;
+    slot->name          = name;
+    slot->group         = group;
+    slot->state         = SVT_KERNEL_SLOT_IDLE;
+    svt_fifo_attach_kernel_slot(input_fifo, slot);
+    return EB_ErrorNone;
+}
+
+EbErrorType svt_kernel_pool_start(SvtKernelPool* pool) {
+    svt_block_on_mutex(pool->mutex);
+    const uint32_t target = MIN(pool->target_running, pool->max_slots);
+    while (pool->num_threads < target) {
+        const uint32_t prev = pool->num_threads;
+        kernel_pool_spawn_locked(pool);
+        if (pool->num_threads == prev) {
+            break;
+        }
+    }
+    const EbErrorType err = pool->num_threads ? EB_ErrorNone : EB_ErrorInsufficientResources;
+    svt_release_mutex(pool->mutex);
+    return err;
+}
+
+DEFINE_ONCE_MUTEX(shared_pool_mutex);
+static SvtKernelPool* shared_pool;
+static uint32_t       shared_pool_refs;
+
+static EbErrorType create_shared_pool(uint32_t target_running) {
+    EB_NEW(shared_pool, svt_kernel_pool_ctor, target_running);
+    return EB_ErrorNone;
+}
+
+EbErrorType svt_kernel_pool_acquire_shared(SvtKernelPool** pool, uint32_t target_running, uint32_t default_running) {
+    RUN_ONCE_MUTEX(shared_pool_mutex);
+    svt_block_on_mutex(shared_pool_mutex);
+    EbErrorType err = EB_ErrorNone;
+    if (!shared_pool) {
+        err = create_shared_pool(target_running ? target_running : default_running);
+    } else if (target_running && target_running != shared_pool->target_running) {
+        SVT_ERROR("shared_pool_threads %u does not match the %u of the shared pool already in use\n",
+                  target_running,
+                  shared_pool->target_running);
+        svt_release_mutex(shared_pool_mutex);
+        return EB_ErrorBadParameter;
+    }
+    if (err == EB_ErrorNone) {
+        shared_pool_refs++;
+        *pool = shared_pool;
+    } else {
+        shared_pool = NULL;
+    }
+    svt_release_mutex(shared_pool_mutex);
+    return err;
+}
+
+void svt_kernel_pool_release_shared(void) {
+    svt_block_on_mutex(shared_pool_mutex);
+    assert(shared_pool_refs);
+    if (!--shared_pool_refs) {
+        EB_DELETE(shared_pool);
+    }
+    svt_release_mutex(shared_pool_mutex);
+}
+
+#endif // CONFIG_KERNEL_POOL
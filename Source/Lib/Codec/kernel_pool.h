@@ -0,0 +1,168 @@
+/*
+* Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbKernelPool_h
+#define EbKernelPool_h
+
+#include "EbConfigMacros.h"
+
+#if CONFIG_KERNEL_POOL
+#include "definitions.h"
+#include "object.h"
+#include "sys_resource_manager.h"
+#include "kernel_dispatch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************
+ * Kernel slot — one per kernel context instance.
+ *
+ * A slot is scheduled when its input FIFO receives an object (or is shut
+ * down) and runs exactly one _iter() per scheduling. A slot is never queued
+ * or run by two workers at the same time, so the per-instance kernel context
+ * keeps the same single-owner guarantee it has with a dedicated thread.
+ **************************************/
+typedef enum SvtKernelSlotState {
+    SVT_KERNEL_SLOT_IDLE, // waiting for its input FIFO
+    SVT_KERNEL_SLOT_QUEUED, // sitting on a worker deque
+    SVT_KERNEL_SLOT_RUNNING, // a worker is inside iter_fn
+    SVT_KERNEL_SLOT_DONE, // iter_fn returned EB_NoErrorFifoShutdown or the group detached
+} SvtKernelSlotState;
+
+struct SvtKernelGroup;
+typedef struct SvtKernelSlot {
+    SvtKernelIterFn        iter_fn;
+    void*                  context;
+    EbFifo*                input_fifo;
+    const char*            name;
+    struct SvtKernelGroup* group;
+    SvtKernelSlotState     state;
+    bool                   rerun; // readiness signaled while RUNNING
+} SvtKernelSlot;
+
+/**************************************
+ * Bounded ring of queued slots. Owners push/pop at the tail (LIFO, keeps the
+ * producer's caches warm), thieves take from the head (oldest work first).
+ **************************************/
+typedef struct SvtKernelDeque {
+    SvtKernelSlot** slots;
+    uint32_t        head;
+    uint32_t        count;
+} SvtKernelDeque;
+
+struct SvtKernelPool;
+typedef struct SvtKernelWorker {
+    struct SvtKernelPool* pool;
+    uint32_t              index;
+    SvtKernelDeque        deque;
+    uint64_t              run_start_us; // start of the current on-CPU stretch
+    uint64_t              run_time_us; // on-CPU time of the current iteration
+} SvtKernelWorker;
+
+/**************************************
+ * Kernel group — the kernel instances of one encoder handle.
+ *
+ * Groups attached to the same pool share its workers by weighted fair share:
+ * the group with queued work and the lowest pass runs next, and pass advances
+ * by the on-CPU time of each iteration divided by the group weight. A group
+ * that was idle re-enters at the pool's current virtual time, so it cannot
+ * bank credit while it has nothing to do.
+ **************************************/
+typedef struct SvtKernelGroup {
+    EbDctor                dctor;
+    struct SvtKernelPool*  pool;
+    struct SvtKernelGroup* next;
+    SvtKernelSlot*         slots;
+    uint32_t               num_slots;
+    uint32_t               max_slots;
+    uint32_t               weight;
+    uint64_t               pass;
+    uint32_t               num_queued; // slots of this group sitting on any deque
+    uint32_t               num_running; // slots of this group inside iter_fn
+    bool                   detaching;
+    // drained_semaphore - posted when a detaching group runs out of work
+    EbHandle drained_semaphore;
+} SvtKernelGroup;
+
+/**************************************
+ * Kernel pool — work-stealing scheduler for pipeline kernels.
+ *
+ * At most target_running workers execute kernels at any time. A worker whose
+ * kernel blocks inside the pipeline (e.g. picture decision waiting on temporal
+ * filtering, or an exhausted empty pool) gives its run permit back through the
+ * thread wait hook, and an idle or newly created worker takes over. Workers
+ * are created on demand up to max_threads; past it, only while every worker
+ * is blocked and work is queued (bounded by the attached slots), so a blocked
+ * kernel can never starve the kernel it is waiting on.
+ **************************************/
+typedef struct SvtKernelPool {
+    EbDctor dctor;
+    // mutex - protects every field below and the scheduling state of the
+    //   attached groups and slots
+    EbHandle mutex;
+    // work_semaphore - parks idle workers; posted when work is queued
+    EbHandle work_semaphore;
+
+    SvtKernelGroup* groups;
+    uint32_t        max_slots; // slots of all attached groups
+    uint32_t        capacity; // size of every deque and of workers/threads
+
+    // injector - fed by non-worker threads
+    SvtKernelDeque    injector;
+    SvtKernelWorker** workers;
+    EbHandle*         threads;
+    uint32_t          num_threads;
+
+    uint32_t target_running; // run permits
+    uint32_t max_threads; // workers created before only full blockage adds more
+    uint32_t num_running; // workers holding a run permit
+    uint32_t num_blocked; // workers whose kernel waits inside the pipeline
+    uint32_t num_idle; // workers parked on work_semaphore
+    uint32_t num_starting; // workers created but not yet in their loop
+    uint32_t num_queued; // slots sitting on any deque
+    uint64_t virtual_time; // pass of the group picked last
+    bool     shutdown;
+} SvtKernelPool;
+
+// target_running: workers allowed to run kernels concurrently (>= 1)
+EbErrorType svt_kernel_pool_ctor(SvtKernelPool* pool, uint32_t target_running);
+
+// Attach a group of max_slots kernel instances to the pool. Deleting the group
+// waits for its queued and running kernels to finish and detaches it.
+EbErrorType svt_kernel_group_ctor(SvtKernelGroup* group, SvtKernelPool* pool, uint32_t max_slots, uint32_t weight);
+
+// Register one kernel instance. The input FIFO is armed so that every object
+// posted to it schedules the slot.
+EbErrorType svt_kernel_pool_register(SvtKernelGroup* group, SvtKernelIterFn iter_fn, void* context,
+                                     EbFifo* input_fifo, const char* name);
+
+// Create workers up to target_running (bounded by the attached slots).
+EbErrorType svt_kernel_pool_start(SvtKernelPool* pool);
+
+// Readiness signal from the resource manager: the input FIFO of the slot got
+// an object or was shut down. Safe to call from any thread.
+void svt_kernel_pool_notify(SvtKernelSlot* slot);
+
+// Process-wide pool shared by every encoder handle that opts in. The first
+// acquire creates it with target_running run permits (default_running if 0);
+// later acquires share it as is, and fail with EB_ErrorBadParameter if they
+// ask for a different non-zero target_running. The last release destroys it.
+EbErrorType svt_kernel_pool_acquire_shared(SvtKernelPool** pool, uint32_t target_running, uint32_t default_running);
+void        svt_kernel_pool_release_shared(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CONFIG_KERNEL_POOL
+#endif // EbKernelPool_h
@@ -98,17 +98,16 @@ static void set_global_motion_field(PictureControlSet* pcs) {
     }
 }
 
-void svt_av1_build_quantizer(PictureParentControlSet* pcs, EbBitDepth bit_depth, int32_t y_dc_delta_q,
-                             int32_t u_dc_delta_q, int32_t u_ac_delta_q, int32_t v_dc_delta_q, int32_t v_ac_delta_q,
-                             Quants* const quants, Dequants* const deq) {
+static void build_quantizer(EbBitDepth bit_depth, int32_t base_q_idx, int32_t sharpness_val, int32_t y_dc_delta_q,
+                            int32_t u_dc_delta_q, int32_t u_ac_delta_q, int32_t v_dc_delta_q, int32_t v_ac_delta_q,
+                            Quants* const quants, Dequants* const deq) {
     int32_t i, q, quant_qtx;
 
     for (q = 0; q < QINDEX_RANGE; q++) {
         int32_t qzbin_factor     = svt_aom_get_qzbin_factor(q, bit_depth);
         int32_t qrounding_factor = q == 0 ? 64 : 48;
         //  diff: q-range diff based on current quantizer
-        int           diff          = q - pcs->frm_hdr.quantization_params.base_q_idx;
-        const int32_t sharpness_val = pcs->scs->static_config.sharpness;
+        int diff = q - base_q_idx;
 
         // cppcheck claims that the second condition is always false, giving the deduction that diff is always < 1.
         // However, it bases it off `q=0` (and I presume it's deduction would also apply to `q=1`) and ignores the loop
@@ -178,6 +177,37 @@ void svt_av1_build_quantizer(PictureParentControlSet* pcs, EbBitDepth bit_depth,
     }
 }
 
+void svt_av1_build_quantizer(PictureParentControlSet* pcs, EbBitDepth bit_depth, int32_t y_dc_delta_q,
+                             int32_t u_dc_delta_q, int32_t u_ac_delta_q, int32_t v_dc_delta_q, int32_t v_ac_delta_q,
+                             Quants* const quants, Dequants* const deq) {
+    build_quantizer(bit_depth,
+                    pcs->frm_hdr.quantization_params.base_q_idx,
+                    pcs->scs->static_config.sharpness,
+                    y_dc_delta_q,
+                    u_dc_delta_q,
+                    u_ac_delta_q,
+                    v_dc_delta_q,
+                    v_ac_delta_q,
+                    quants,
+                    deq);
+}
+
+// Without sharpness the quantizers of qindex offset 0 only depend on the bit
+// depth: [0] 8bit, [1] 10bit, filled at init by svt_av1_init_shared_quantizers()
+static Quants   shared_quants[2];
+static Dequants shared_deq[2];
+
+void svt_av1_init_shared_quantizers(void) {
+    build_quantizer(EB_EIGHT_BIT, 0, 0, 0, 0, 0, 0, 0, &shared_quants[0], &shared_deq[0]);
+    build_quantizer(EB_TEN_BIT, 0, 0, 0, 0, 0, 0, 0, &shared_quants[1], &shared_deq[1]);
+}
+
+void svt_av1_get_shared_quantizer(EbBitDepth bit_depth, const Quants** quants, const Dequants** deq) {
+    const int idx = bit_depth == EB_EIGHT_BIT ? 0 : 1;
+    *quants       = &shared_quants[idx];
+    *deq          = &shared_deq[idx];
+}
+
 // Reduce the large number of quantizers to a smaller number of levels for which
 // different matrices may be defined
 static INLINE int aom_get_qmlevel(int qindex, int first, int last) {
@@ -212,7 +242,10 @@ static INLINE int svt_av1_still_get_qmlevel(int qindex, int min, int max) {
     return CLIP3(min, max, qm_level);
 }
 
-static void svt_av1_qm_init(PictureParentControlSet* pcs) {
+const QmVal* svt_aom_giqmatrix[NUM_QM_LEVELS][3][TX_SIZES_ALL];
+const QmVal* svt_aom_gqmatrix[NUM_QM_LEVELS][3][TX_SIZES_ALL];
+
+void svt_aom_init_qmatrix(void) {
     const uint8_t num_planes = 3; // MAX_PLANES;// NM- No monochroma
     uint8_t       q, c, t;
 #if CONFIG_ENABLE_QUANT_MATRIX
@@ -224,15 +257,15 @@ static void svt_av1_qm_init(PictureParentControlSet* pcs) {
                 const int32_t size       = tx_size_2d[t];
                 const TxSize  qm_tx_size = av1_get_adjusted_tx_size(t);
                 if (q == NUM_QM_LEVELS - 1) {
-                    pcs->gqmatrix[q][c][t]  = NULL;
-                    pcs->giqmatrix[q][c][t] = NULL;
+                    svt_aom_gqmatrix[q][c][t]  = NULL;
+                    svt_aom_giqmatrix[q][c][t] = NULL;
                 } else if (t != qm_tx_size) { // Reuse matrices for 'qm_tx_size'
-                    pcs->gqmatrix[q][c][t]  = pcs->gqmatrix[q][c][qm_tx_size];
-                    pcs->giqmatrix[q][c][t] = pcs->giqmatrix[q][c][qm_tx_size];
+                    svt_aom_gqmatrix[q][c][t]  = svt_aom_gqmatrix[q][c][qm_tx_size];
+                    svt_aom_giqmatrix[q][c][t] = svt_aom_giqmatrix[q][c][qm_tx_size];
                 } else {
                     assert(current + size <= QM_TOTAL_SIZE);
-                    pcs->gqmatrix[q][c][t]  = &wt_matrix_ref[q][c >= 1][current];
-                    pcs->giqmatrix[q][c][t] = &iwt_matrix_ref[q][c >= 1][current];
+                    svt_aom_gqmatrix[q][c][t]  = &wt_matrix_ref[q][c >= 1][current];
+                    svt_aom_giqmatrix[q][c][t] = &iwt_matrix_ref[q][c >= 1][current];
                     current += size;
                 }
             }
@@ -242,13 +275,15 @@ static void svt_av1_qm_init(PictureParentControlSet* pcs) {
     for (q = 0; q < NUM_QM_LEVELS; ++q) {
         for (c = 0; c < num_planes; ++c) {
             for (t = 0; t < TX_SIZES_ALL; ++t) {
-                pcs->gqmatrix[q][c][t]  = NULL;
-                pcs->giqmatrix[q][c][t] = NULL;
+                svt_aom_gqmatrix[q][c][t]  = NULL;
+                svt_aom_giqmatrix[q][c][t] = NULL;
             }
         }
     }
 #endif // CONFIG_ENABLE_QUANT_MATRIX
+}
 
+static void svt_av1_qm_init(PictureParentControlSet* pcs) {
     if (pcs->frm_hdr.quantization_params.using_qmatrix) {
         const int32_t min_qmlevel        = pcs->scs->static_config.min_qm_level;
         const int32_t max_qmlevel        = pcs->scs->static_config.max_qm_level;
@@ -596,7 +631,7 @@ static void generate_ibc_data(PictureControlSet* pcs) {
     for (j = 0; j < 2; j++) {
         EB_MALLOC_ARRAY_NO_CHECK(block_hash_values[j], pic_width * pic_height);
     }
-    svt_aom_rtime_alloc_svt_av1_hash_table_create(&pcs->hash_table);
+    svt_aom_rtime_alloc_svt_av1_hash_table_create(&pcs->hash_table, &pcs->arena);
     Yv12BufferConfig cpi_source;
     svt_aom_link_eb_to_aom_buffer_desc_8bit(pcs->ppcs->enhanced_pic, &cpi_source);
     svt_av1_generate_block_2x2_hash_value(&cpi_source, block_hash_values[0]);
@@ -884,6 +919,7 @@ EbErrorType svt_aom_mode_decision_configuration_kernel_iter(void* context) {
     pcs->min_me_clpx               = 0;
     pcs->max_me_clpx               = 0;
     pcs->avg_me_clpx               = 0;
+    svt_aom_stamp_frame_stage(pcs->ppcs, SVT_AV1_FRAME_STAGE_MD);
     if (pcs->slice_type != I_SLICE) {
         uint32_t b64_idx;
         uint64_t avg_me_clpx = 0;
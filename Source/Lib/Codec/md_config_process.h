@@ -40,6 +40,16 @@ EbErrorType svt_aom_mode_decision_configuration_context_ctor(EbThreadContext*
 void svt_av1_build_quantizer(PictureParentControlSet* pcs, EbBitDepth bit_depth, int32_t y_dc_delta_q,
                              int32_t u_dc_delta_q, int32_t u_ac_delta_q, int32_t v_dc_delta_q, int32_t v_ac_delta_q,
                              Quants* const quants, Dequants* const deq);
+// Quantizers of qindex offset 0 for the streams without sharpness, built once
+// per process and shared read-only by all the encoders
+void svt_av1_init_shared_quantizers(void);
+void svt_av1_get_shared_quantizer(EbBitDepth bit_depth, const Quants** quants, const Dequants** deq);
+
+// Quantization matrices per level, plane and transform size, pointing into the
+// tables of q_matrices.h; filled at init by svt_aom_init_qmatrix()
+extern const QmVal* svt_aom_giqmatrix[NUM_QM_LEVELS][3][TX_SIZES_ALL];
+extern const QmVal* svt_aom_gqmatrix[NUM_QM_LEVELS][3][TX_SIZES_ALL];
+void                svt_aom_init_qmatrix(void);
 
 void* svt_aom_mode_decision_configuration_kernel(void* input_ptr);
 
@@ -327,6 +327,23 @@ typedef struct PreHmeCtrls {
     uint8_t          l1_early_exit;
 } PreHmeCtrls;
 
+/* MvProjCtrls seed HME level 0 with the vector of the co-located 64x64 block in the open-loop motion field of a
+* reference, scaled to the distance of each reference searched. The projected centre is refined over its own search
+* area and replaces the worst HME level-0 centre when it has a lower SAD, so that fast motion is found without
+* growing the HME search area, which can instead be reduced for the blocks that have a projected centre.
+* When TF already searched the same pair of pictures, its HME centre is taken instead of the projected one, without
+* reducing the HME search area.
+*/
+typedef struct MvProjCtrls {
+    bool enabled;
+    // Search area around the projected centre, in 1/16-resolution samples
+    SearchArea sa;
+    // Divide the HME level-0 search area by this factor for blocks that have a projected centre
+    uint8_t hme_l0_sa_divisor;
+    // Take the HME centres TF found for the same pair of pictures, in either direction
+    bool use_tf_mv;
+} MvProjCtrls;
+
 typedef struct SearchResults {
     uint8_t  list_i; // list index of this ref
     uint8_t  ref_i; // ref list index of this ref
@@ -481,6 +498,19 @@ typedef struct MeContext {
     uint32_t b64_height;
     uint8_t  performed_phme[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH][2];
     uint32_t prev_me_stage_based_exit_th;
+    // Motion field projection
+    MvProjCtrls mv_proj_ctrls;
+    const Mv*   mv_proj_field; // 64x64 vectors of the reference projected from, NULL when none
+    int16_t     mv_proj_field_dist; // picture distance spanned by mv_proj_field
+    uint64_t    mv_proj_picture_number; // of the picture being searched
+    bool        mv_proj_tf_available; // at least one reference has TF HME centres
+    // TF HME centres of each reference, NULL when none; a centre is negated when mv_proj_tf_sign is -1
+    const Mv* mv_proj_tf[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+    int8_t    mv_proj_tf_sign[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+    // mv_proj holds the projected centres of the current B64; mv_proj_from_tf is set for the TF HME centres
+    bool mv_proj_valid[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+    bool mv_proj_from_tf[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+    Mv   mv_proj[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
 } MeContext;
 
 typedef uint64_t (*EB_ME_DISTORTION_FUNC)(uint8_t* src, uint32_t src_stride, uint8_t* ref, uint32_t ref_stride,
@@ -91,6 +91,94 @@ EbErrorType svt_aom_motion_estimation_context_ctor(EbThreadContext* thread_ctx,
  * to the prediction structure pattern.  The Motion Analysis process is multithreaded,
  * so pictures can be processed out of order as long as all inputs are available.
  ************************************************/
+// Hand the motion field of a picture whose open-loop ME is complete to the
+// application; the vectors were stored by each B64
+static void export_me_field(PictureParentControlSet* pcs, MeContext* me_ctx, uint32_t pic_width_in_b64,
+                            uint32_t pic_height_in_b64) {
+    EncodeContext* enc_ctx  = pcs->scs->enc_ctx;
+    SvtAv1MeField* field    = pcs->me_field_out;
+    const uint8_t  l0_count = me_ctx->num_of_ref_pic_to_search[REF_LIST_0];
+    field->picture_number   = pcs->picture_number;
+    field->width            = pcs->aligned_width;
+    field->height           = pcs->aligned_height;
+    field->b64_cols         = (uint16_t)pic_width_in_b64;
+    field->b64_rows         = (uint16_t)pic_height_in_b64;
+    field->ref_count        = l0_count + me_ctx->num_of_ref_pic_to_search[REF_LIST_1];
+    memset(field->ref_picture_number, 0, sizeof(field->ref_picture_number));
+    for (uint32_t list_i = REF_LIST_0; list_i < me_ctx->num_of_list_to_search; ++list_i) {
+        for (uint8_t ref_i = 0; ref_i < me_ctx->num_of_ref_pic_to_search[list_i]; ++ref_i) {
+            field->ref_picture_number[(list_i ? l0_count : 0) + ref_i] =
+                me_ctx->me_ds_ref_array[list_i][ref_i].picture_number;
+        }
+    }
+    svt_block_on_mutex(enc_ctx->me_field_sink_mutex);
+    enc_ctx->me_field_sink.write(enc_ctx->me_field_sink.ctx,
+                                 field,
+                                 (uint32_t)SVT_AV1_ME_FIELD_SIZE(
+                                     field->b64_cols, field->b64_rows, field->ref_count, field->block_count));
+    svt_release_mutex(enc_ctx->me_field_sink_mutex);
+}
+
+// Take the open-loop motion field of the nearest reference that has one for the motion field projection of
+// HME. The reference was sent to ME ahead of this picture, so its ME is done or being done by another thread.
+static void set_mv_proj_field(PictureParentControlSet* pcs, MeContext* me_ctx, uint32_t pic_width_in_b64,
+                              uint32_t pic_height_in_b64) {
+    const uint8_t ref_count[MAX_NUM_OF_REF_PIC_LIST] = {pcs->ref_list0_count_try, pcs->ref_list1_count_try};
+    for (int list_i = REF_LIST_0; list_i < MAX_NUM_OF_REF_PIC_LIST; ++list_i) {
+        if (!ref_count[list_i]) {
+            continue;
+        }
+        EbPaReferenceObject* ref_obj = (EbPaReferenceObject*)pcs->ref_pa_pic_ptr_array[list_i][0]->object_ptr;
+        svt_wait_cond_var(&ref_obj->me_mv_field_ready, 0);
+        if (ref_obj->me_mv_field_dist && ref_obj->me_mv_field_cols == pic_width_in_b64 &&
+            ref_obj->me_mv_field_rows == pic_height_in_b64) {
+            me_ctx->mv_proj_field          = ref_obj->me_mv_field;
+            me_ctx->mv_proj_field_dist     = ref_obj->me_mv_field_dist;
+            me_ctx->mv_proj_picture_number = pcs->picture_number;
+            return;
+        }
+    }
+}
+
+// Take the HME centres TF found for each pair of this picture and a reference: from the TF of this picture, or
+// negated from the TF of the reference when it searched this picture. TF of both is done before this picture is
+// sent to ME.
+static void set_mv_proj_tf(PictureParentControlSet* pcs, MeContext* me_ctx) {
+    const uint8_t        ref_count[MAX_NUM_OF_REF_PIC_LIST] = {pcs->ref_list0_count_try, pcs->ref_list1_count_try};
+    EbPaReferenceObject* pa_ref_obj = (EbPaReferenceObject*)pcs->pa_ref_pic_wrapper->object_ptr;
+    for (int list_i = REF_LIST_0; list_i < MAX_NUM_OF_REF_PIC_LIST; ++list_i) {
+        for (uint8_t ref_i = 0; ref_i < ref_count[list_i]; ++ref_i) {
+            EbPaReferenceObject* ref_obj = (EbPaReferenceObject*)pcs->ref_pa_pic_ptr_array[list_i][ref_i]->object_ptr;
+            const uint64_t       ref_num = ref_obj->picture_number;
+            const int64_t        dist    = (int64_t)ref_num - (int64_t)pcs->picture_number;
+            const int32_t        slot    = tf_mv_slot(dist);
+            const int32_t        rev     = tf_mv_slot(-dist);
+            if (slot >= 0 && pa_ref_obj->tf_mv_picture_number[slot] == ref_num) {
+                me_ctx->mv_proj_tf[list_i][ref_i]      = pa_ref_obj->tf_mv + slot * pa_ref_obj->me_mv_field_size;
+                me_ctx->mv_proj_tf_sign[list_i][ref_i] = 1;
+            } else if (rev >= 0 && ref_obj->tf_mv_picture_number[rev] == pcs->picture_number) {
+                me_ctx->mv_proj_tf[list_i][ref_i]      = ref_obj->tf_mv + rev * ref_obj->me_mv_field_size;
+                me_ctx->mv_proj_tf_sign[list_i][ref_i] = -1;
+            } else {
+                continue;
+            }
+            me_ctx->mv_proj_tf_available = true;
+        }
+    }
+}
+
+// Let the pictures that reference this one take its motion field; it has none when ME was skipped or did not
+// keep it
+static void publish_mv_proj_field(PictureParentControlSet* pcs, MeContext* me_ctx, EbPaReferenceObject* pa_ref_obj,
+                                  uint32_t pic_width_in_b64, uint32_t pic_height_in_b64, bool has_field) {
+    pa_ref_obj->me_mv_field_cols = (uint16_t)pic_width_in_b64;
+    pa_ref_obj->me_mv_field_rows = (uint16_t)pic_height_in_b64;
+    pa_ref_obj->me_mv_field_dist = has_field && me_ctx->mv_proj_ctrls.enabled && pcs->ref_list0_count_try
+        ? (int16_t)((int64_t)me_ctx->me_ds_ref_array[REF_LIST_0][0].picture_number - (int64_t)pcs->picture_number)
+        : 0;
+    svt_set_cond_var(&pa_ref_obj->me_mv_field_ready, 1);
+}
+
 EbErrorType svt_aom_motion_estimation_kernel_iter(void* context) {
     MotionEstimationContext_t* me_context_ptr = (MotionEstimationContext_t*)context;
 
@@ -106,6 +194,7 @@ EbErrorType svt_aom_motion_estimation_kernel_iter(void* context) {
         me_context_ptr->me_ctx->me_type = ME_MCTF;
     } else if (in_results_ptr->task_type == TASK_PAME || in_results_ptr->task_type == TASK_SUPERRES_RE_ME) {
         me_context_ptr->me_ctx->me_type = ME_OPEN_LOOP;
+        svt_aom_stamp_frame_stage(pcs, SVT_AV1_FRAME_STAGE_ME);
     } else if (in_results_ptr->task_type == TASK_DG_DETECTOR_HME) {
         me_context_ptr->me_ctx->me_type = ME_DG_DETECTOR;
     }
@@ -120,6 +209,9 @@ EbErrorType svt_aom_motion_estimation_kernel_iter(void* context) {
         svt_aom_sig_deriv_me_tf(pcs, me_context_ptr->me_ctx);
 #endif
     }
+    me_context_ptr->me_ctx->mv_proj_field        = NULL;
+    me_context_ptr->me_ctx->mv_proj_tf_available = false;
+    memset(me_context_ptr->me_ctx->mv_proj_tf, 0, sizeof(me_context_ptr->me_ctx->mv_proj_tf));
 
     if ((in_results_ptr->task_type == TASK_PAME) || (in_results_ptr->task_type == TASK_SUPERRES_RE_ME)) {
         EbPictureBufferDesc* sixteenth_picture_ptr;
@@ -162,6 +254,13 @@ EbErrorType svt_aom_motion_estimation_kernel_iter(void* context) {
                 // Use scaled source references if resolution of the reference is different that of the input
                 svt_aom_use_scaled_source_refs_if_needed(
                     pcs, input_pic, pa_ref_obj_, &input_padded_pic, &quarter_picture_ptr, &sixteenth_picture_ptr);
+                if (me_context_ptr->me_ctx->mv_proj_ctrls.enabled && in_results_ptr->task_type == TASK_PAME &&
+                    !pcs->is_overlay) {
+                    set_mv_proj_field(pcs, me_context_ptr->me_ctx, pic_width_in_b64, picture_height_in_b64);
+                    if (me_context_ptr->me_ctx->mv_proj_ctrls.use_tf_mv) {
+                        set_mv_proj_tf(pcs, me_context_ptr->me_ctx);
+                    }
+                }
 
                 // 64x64 Block Loop
                 for (uint32_t y_b64_index = y_b64_start_index; y_b64_index < y_b64_end_index; ++y_b64_index) {
@@ -261,10 +360,12 @@ EbErrorType svt_aom_motion_estimation_kernel_iter(void* context) {
 
                         if ((in_results_ptr->task_type == TASK_PAME) ||
                             (in_results_ptr->task_type == TASK_SUPERRES_RE_ME)) {
+                            bool me_done = false;
                             svt_block_on_mutex(pcs->me_processed_b64_mutex);
                             pcs->me_processed_b64_count++;
                             // We need to finish ME for all SBs to do GM
                             if (pcs->me_processed_b64_count == pcs->b64_total_count) {
+                                me_done = true;
 #if CONFIG_ENABLE_GLOBAL_MOTION
                                 if (pcs->gm_ctrls.enabled && (!pcs->gm_ctrls.pp_enabled || pcs->gm_pp_detected)) {
                                     svt_aom_global_motion_estimation(pcs, input_pic);
@@ -277,11 +378,27 @@ EbErrorType svt_aom_motion_estimation_kernel_iter(void* context) {
                             }
 
                             svt_release_mutex(pcs->me_processed_b64_mutex);
+                            if (me_done && pcs->me_field_out && in_results_ptr->task_type == TASK_PAME) {
+                                export_me_field(
+                                    pcs, me_context_ptr->me_ctx, pic_width_in_b64, picture_height_in_b64);
+                            }
+                            if (me_done && in_results_ptr->task_type == TASK_PAME) {
+                                publish_mv_proj_field(pcs,
+                                                      me_context_ptr->me_ctx,
+                                                      pa_ref_obj_,
+                                                      pic_width_in_b64,
+                                                      picture_height_in_b64,
+                                                      true);
+                            }
                         }
                     }
                 }
             }
         }
+        if (in_results_ptr->task_type == TASK_PAME && (skip_me || pcs->slice_type == I_SLICE)) {
+            publish_mv_proj_field(
+                pcs, me_context_ptr->me_ctx, pa_ref_obj_, pic_width_in_b64, picture_height_in_b64, false);
+        }
         // Get Empty Results Object
         svt_get_empty_object(me_context_ptr->motion_estimation_results_output_fifo_ptr, &out_results_wrapper);
 
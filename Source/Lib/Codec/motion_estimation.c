@@ -1455,7 +1455,7 @@ static void me_prune_ref(MeContext* me_ctx) {
 
 /* perform  motion search over a given search area*/
 static void prehme_core(MeContext* me_ctx, int16_t org_x, int16_t org_y, uint32_t sb_width, uint32_t sb_height,
-                        EbPictureBufferDesc* sixteenth_ref_pic_ptr, SearchInfo* prehme_data) {
+                        EbPictureBufferDesc* sixteenth_ref_pic_ptr, uint8_t skip_search_line, SearchInfo* prehme_data) {
     int16_t x_top_left_search_region;
     int16_t y_top_left_search_region;
     int32_t search_region_index;
@@ -1522,7 +1522,7 @@ static void prehme_core(MeContext* me_ctx, int16_t org_x, int16_t org_y, uint32_
                         &prehme_data->best_mv.x,
                         &prehme_data->best_mv.y,
                         sixteenth_ref_pic_ptr->y_stride,
-                        me_ctx->prehme_ctrl.skip_search_line,
+                        skip_search_line,
                         search_area_width,
                         search_area_height);
 
@@ -1631,6 +1631,7 @@ static void prehme_b64(PictureParentControlSet* pcs, uint32_t org_x, uint32_t or
                                 block_width >> 2,
                                 block_height >> 2,
                                 sixteenth_ref_pic,
+                                me_ctx->prehme_ctrl.skip_search_line,
                                 prehme_data);
                     me_ctx->performed_phme[list_i][ref_i][sr_i] = 1;
                 }
@@ -1762,6 +1763,57 @@ static void get_worst_quadrant(MeContext* me_ctx, uint32_t list_index, uint32_t
     }
 }
 
+// Keep the HME centre TF found for the B64 against the neighbour searched, when the slot of the neighbour is keyed
+static void store_tf_mv(PictureParentControlSet* pcs, uint32_t b64_index, MeContext* me_ctx) {
+    EbPaReferenceObject* pa_ref_obj = (EbPaReferenceObject*)pcs->pa_ref_pic_wrapper->object_ptr;
+    const uint64_t       ref_num    = me_ctx->me_ds_ref_array[REF_LIST_0][0].picture_number;
+    const int32_t        slot       = tf_mv_slot((int64_t)ref_num - (int64_t)pcs->picture_number);
+    if (slot < 0 || pa_ref_obj->tf_mv_picture_number[slot] != ref_num) {
+        return;
+    }
+    Mv* tf_mv = &pa_ref_obj->tf_mv[slot * pa_ref_obj->me_mv_field_size + b64_index];
+    tf_mv->x  = me_ctx->search_results[REF_LIST_0][0].hme_sc_x;
+    tf_mv->y  = me_ctx->search_results[REF_LIST_0][0].hme_sc_y;
+}
+
+// Project the 64x64 vector of the co-located block in the motion field of a reference to each reference
+// searched, assuming the motion is constant over the distance. A reference that TF already searched against,
+// in either direction, takes the HME centre of TF instead. The projected centres are kept on the padded
+// reference, as check_00_center() does.
+static void project_mv_b64(PictureParentControlSet* pcs, uint32_t org_x, uint32_t org_y, MeContext* me_ctx) {
+    const uint32_t pic_width_in_b64 = (pcs->aligned_width + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64;
+    const uint32_t b64_index        = (org_y / BLOCK_SIZE_64) * pic_width_in_b64 + org_x / BLOCK_SIZE_64;
+    const Mv       field_mv         = me_ctx->mv_proj_field ? me_ctx->mv_proj_field[b64_index]
+                                                            : (Mv){.as_int = INVALID_MV};
+
+    const int16_t pad_width  = (int16_t)BLOCK_SIZE_64 - 1;
+    const int16_t pad_height = (int16_t)BLOCK_SIZE_64 - 1;
+    for (int list_i = REF_LIST_0; list_i < me_ctx->num_of_list_to_search; ++list_i) {
+        for (uint8_t ref_i = 0; ref_i < me_ctx->num_of_ref_pic_to_search[list_i]; ++ref_i) {
+            const EbPictureBufferDesc* ref_pic = me_ctx->me_ds_ref_array[list_i][ref_i].picture_ptr;
+            const Mv* tf_mv = me_ctx->mv_proj_tf[list_i][ref_i] ? &me_ctx->mv_proj_tf[list_i][ref_i][b64_index] : NULL;
+            int32_t   x, y;
+            if (tf_mv && tf_mv->as_int != INVALID_MV) {
+                me_ctx->mv_proj_from_tf[list_i][ref_i] = true;
+                x = tf_mv->x * me_ctx->mv_proj_tf_sign[list_i][ref_i];
+                y = tf_mv->y * me_ctx->mv_proj_tf_sign[list_i][ref_i];
+            } else if (field_mv.as_int != INVALID_MV) {
+                const int64_t ref_num = (int64_t)me_ctx->me_ds_ref_array[list_i][ref_i].picture_number;
+                const int32_t dist    = (int32_t)(ref_num - (int64_t)me_ctx->mv_proj_picture_number);
+                x                     = field_mv.x * dist / me_ctx->mv_proj_field_dist;
+                y                     = field_mv.y * dist / me_ctx->mv_proj_field_dist;
+            } else {
+                continue;
+            }
+            me_ctx->mv_proj[list_i][ref_i].x = (int16_t)CLIP3(
+                -pad_width - (int32_t)org_x, (int32_t)ref_pic->width - 1 - (int32_t)org_x, x);
+            me_ctx->mv_proj[list_i][ref_i].y = (int16_t)CLIP3(
+                -pad_height - (int32_t)org_y, (int32_t)ref_pic->height - 1 - (int32_t)org_y, y);
+            me_ctx->mv_proj_valid[list_i][ref_i] = true;
+        }
+    }
+}
+
 /*******************************************
  * performs hierarchical ME level 0 for one 64x64 block (uni-prediction only)
  *******************************************/
@@ -1836,6 +1888,13 @@ static void hme_level0_b64(PictureParentControlSet* pcs, uint32_t org_x, uint32_
                 // Get the HME L0 search dimensions for the current frame
                 int16_t sa_width = 0, sa_height = 0;
                 get_hme_l0_search_area(me_ctx, list_index, ref_pic_index, dist, &sa_width, &sa_height);
+                // The projected centre covers the motion of the block, so the surrounding area can be smaller. The
+                // TF centre may come from a search area too small for the motion, so it does not reduce the area.
+                if (me_ctx->mv_proj_valid[list_index][ref_pic_index] &&
+                    !me_ctx->mv_proj_from_tf[list_index][ref_pic_index] && me_ctx->mv_proj_ctrls.hme_l0_sa_divisor > 1) {
+                    sa_width  = MAX(8, sa_width / me_ctx->mv_proj_ctrls.hme_l0_sa_divisor);
+                    sa_height = MAX(1, sa_height / me_ctx->mv_proj_ctrls.hme_l0_sa_divisor);
+                }
                 for (uint8_t sr_h = 0; sr_h < me_ctx->num_hme_sa_h; sr_h++) {
                     for (uint8_t sr_w = 0; sr_w < me_ctx->num_hme_sa_w; sr_w++) {
                         hme_level_0(me_ctx,
@@ -1883,6 +1942,29 @@ static void hme_level0_b64(PictureParentControlSet* pcs, uint32_t org_x, uint32_
                             me_ctx->prehme_data[list_index][ref_pic_index][sr_i].best_mv.y;
                     }
                 }
+
+                if (me_ctx->mv_proj_valid[list_index][ref_pic_index]) {
+                    // search around the projected centre, then replace the worst quadrant with it
+                    const Mv   proj      = me_ctx->mv_proj[list_index][ref_pic_index];
+                    SearchInfo proj_data = {.sa = me_ctx->mv_proj_ctrls.sa};
+                    prehme_core(me_ctx,
+                                (((int16_t)org_x) >> 2) + (proj.x >> 2),
+                                (((int16_t)org_y) >> 2) + (proj.y >> 2),
+                                block_width >> 2,
+                                block_height >> 2,
+                                sixteenth_ref_pic,
+                                0,
+                                &proj_data);
+                    uint8_t sr_h_max = 0, sr_w_max = 0;
+                    get_worst_quadrant(me_ctx, list_index, ref_pic_index, &sr_w_max, &sr_h_max);
+                    if (proj_data.sad < me_ctx->hme_level0_sad[list_index][ref_pic_index][sr_w_max][sr_h_max]) {
+                        me_ctx->hme_level0_sad[list_index][ref_pic_index][sr_w_max][sr_h_max] = proj_data.sad;
+                        me_ctx->x_hme_level0_search_center[list_index][ref_pic_index][sr_w_max][sr_h_max] =
+                            proj_data.best_mv.x + ((proj.x >> 2) << 2);
+                        me_ctx->y_hme_level0_search_center[list_index][ref_pic_index][sr_w_max][sr_h_max] =
+                            proj_data.best_mv.y + ((proj.y >> 2) << 2);
+                    }
+                }
             }
         } // End ref pic loop
     } // End list loop
@@ -2242,6 +2324,80 @@ static void init_zz_sad(PictureParentControlSet* pcs, MeContext* me_ctx, uint32_
     }
 }
 
+// Take the HME search centres of the block from the motion field imported with
+// ME_FIELD_EVENT instead of searching for them. The field may come from an
+// encode of the same source at another resolution: the vectors of the field
+// block under the centre of this one are scaled to this picture. Returns false,
+// so that HME runs, when a reference to search has no vector in the field.
+static bool seed_hme_b64(PictureParentControlSet* pcs, uint32_t org_x, uint32_t org_y, MeContext* me_ctx) {
+    const SvtAv1MeField*   field  = pcs->me_field_in;
+    const int32_t          width  = pcs->aligned_width;
+    const int32_t          height = pcs->aligned_height;
+    // Centre of the block in the picture of the field
+    const uint32_t         x      = (org_x + me_ctx->b64_width / 2) * field->width / width;
+    const uint32_t         y      = (org_y + me_ctx->b64_height / 2) * field->height / height;
+    const uint32_t         col    = MIN(x / BLOCK_SIZE_64, field->b64_cols - 1u);
+    const uint32_t         row    = MIN(y / BLOCK_SIZE_64, field->b64_rows - 1u);
+    const SvtAv1MeFieldMv* mvs    = SVT_AV1_ME_FIELD_MVS(field) +
+        (size_t)(row * field->b64_cols + col) * field->ref_count * field->block_count;
+    const SvtAv1MeFieldMv* seed[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+
+    for (int list_i = REF_LIST_0; list_i < me_ctx->num_of_list_to_search; ++list_i) {
+        for (uint8_t ref_i = 0; ref_i < me_ctx->num_of_ref_pic_to_search[list_i]; ++ref_i) {
+            seed[list_i][ref_i] = NULL;
+            if (!me_ctx->search_results[list_i][ref_i].do_ref) {
+                continue;
+            }
+            const uint64_t ref_number = me_ctx->me_ds_ref_array[list_i][ref_i].picture_number;
+            for (uint8_t i = 0; i < field->ref_count; i++) {
+                const SvtAv1MeFieldMv* mv = &mvs[i * field->block_count];
+                if (field->ref_picture_number[i] == ref_number && mv->x != SVT_AV1_ME_FIELD_INVALID_MV) {
+                    seed[list_i][ref_i] = mv;
+                    break;
+                }
+            }
+            if (!seed[list_i][ref_i]) {
+                return false;
+            }
+        }
+    }
+
+    const int16_t pad_width  = (int16_t)BLOCK_SIZE_64 - 1;
+    const int16_t pad_height = (int16_t)BLOCK_SIZE_64 - 1;
+    uint64_t      best_cost  = (uint64_t)~0;
+    for (int list_i = REF_LIST_0; list_i < me_ctx->num_of_list_to_search; ++list_i) {
+        for (uint8_t ref_i = 0; ref_i < me_ctx->num_of_ref_pic_to_search[list_i]; ++ref_i) {
+            if (!seed[list_i][ref_i]) {
+                continue;
+            }
+            EbPictureBufferDesc* ref_pic = me_ctx->me_ds_ref_array[list_i][ref_i].picture_ptr;
+            int16_t sc_x = (int16_t)(seed[list_i][ref_i]->x * width / field->width);
+            int16_t sc_y = (int16_t)(seed[list_i][ref_i]->y * height / field->height);
+            // Keep the block on the padded reference, as check_00_center() does
+            sc_x         = CLIP3(-pad_width - (int16_t)org_x, (int16_t)ref_pic->width - 1 - (int16_t)org_x, sc_x);
+            sc_y         = CLIP3(-pad_height - (int16_t)org_y, (int16_t)ref_pic->height - 1 - (int16_t)org_y, sc_y);
+
+            const int32_t search_region_index = (int32_t)org_x + sc_x + ((int32_t)org_y + sc_y) * ref_pic->y_stride;
+            uint64_t      sad                 = svt_nxm_sad_kernel(me_ctx->b64_src_ptr,
+                                                  me_ctx->b64_src_stride << 1,
+                                                  &(ref_pic->y_buffer[search_region_index]),
+                                                  ref_pic->y_stride << 1,
+                                                  me_ctx->b64_height >> 1,
+                                                  me_ctx->b64_width);
+            sad                               = sad << 1;
+            me_ctx->search_results[list_i][ref_i].hme_sc_x = sc_x;
+            me_ctx->search_results[list_i][ref_i].hme_sc_y = sc_y;
+            me_ctx->search_results[list_i][ref_i].hme_sad  = sad;
+            if (sad < best_cost) {
+                best_cost             = sad;
+                me_ctx->best_list_idx = list_i;
+                me_ctx->best_ref_idx  = ref_i;
+            }
+        }
+    }
+    return true;
+}
+
 /*******************************************
  * performs hierarchical ME for a 64x64 block for every ref frame
  *******************************************/
@@ -2252,11 +2408,21 @@ static void hme_b64(PictureParentControlSet* pcs, uint32_t org_x, uint32_t org_y
         init_zz_sad(pcs, me_ctx, org_x, org_y);
     }
 
+    if (pcs->me_field_in && me_ctx->me_type == ME_OPEN_LOOP && seed_hme_b64(pcs, org_x, org_y, me_ctx)) {
+        return;
+    }
+
     if (me_ctx->prehme_ctrl.enable) {
         // perform pre-HME
         prehme_b64(pcs, org_x, org_y, me_ctx, input_ptr);
     }
 
+    memset(me_ctx->mv_proj_valid, 0, sizeof(me_ctx->mv_proj_valid));
+    memset(me_ctx->mv_proj_from_tf, 0, sizeof(me_ctx->mv_proj_from_tf));
+    if ((me_ctx->mv_proj_field || me_ctx->mv_proj_tf_available) && me_ctx->me_type == ME_OPEN_LOOP) {
+        project_mv_b64(pcs, org_x, org_y, me_ctx);
+    }
+
     if (me_ctx->enable_hme_flag) {
         // perform hierarchical ME level 0
         if (me_ctx->enable_hme_level0_flag) {
@@ -2885,6 +3051,73 @@ static bool me_static_b64_bypass(MeContext* me_ctx, uint32_t b64_origin_x, uint3
     return true;
 }
 
+// Keep the vectors of the block for the ME field sink, before pruning drops
+// the references that lost
+static void store_me_field(PictureParentControlSet* pcs, uint32_t b64_index, MeContext* me_ctx) {
+    const uint8_t    block_count = pcs->me_field_out->block_count;
+    const uint8_t    l0_count    = me_ctx->num_of_ref_pic_to_search[REF_LIST_0];
+    const uint8_t    ref_count   = l0_count + me_ctx->num_of_ref_pic_to_search[REF_LIST_1];
+    SvtAv1MeFieldMv* mvs         = SVT_AV1_ME_FIELD_MVS(pcs->me_field_out) + (size_t)b64_index * ref_count * block_count;
+    for (uint32_t list_i = REF_LIST_0; list_i < me_ctx->num_of_list_to_search; ++list_i) {
+        for (uint8_t ref_i = 0; ref_i < me_ctx->num_of_ref_pic_to_search[list_i]; ++ref_i) {
+            SvtAv1MeFieldMv* mv = &mvs[((list_i ? l0_count : 0) + ref_i) * block_count];
+            for (uint8_t i = 0; i < block_count; i++) {
+                if (me_ctx->search_results[list_i][ref_i].do_ref) {
+                    const uint32_t best_mv = me_ctx->p_sb_best_mv[list_i][ref_i][i];
+                    mv[i].x                = _MVXT(best_mv);
+                    mv[i].y                = _MVYT(best_mv);
+                    mv[i].sad              = me_ctx->p_sb_best_sad[list_i][ref_i][i];
+                } else {
+                    mv[i].x   = SVT_AV1_ME_FIELD_INVALID_MV;
+                    mv[i].y   = SVT_AV1_ME_FIELD_INVALID_MV;
+                    mv[i].sad = MAX_SAD_VALUE;
+                }
+            }
+        }
+    }
+}
+
+// Take the results of the integer search of the block from the motion field
+// imported with ME_FIELD_EVENT, when it holds every block vector of an encode
+// of this picture at this resolution against the same references: a rung of
+// the same ladder at another rate. The references the field has no vector for
+// were pruned by that encode and are dropped here too. Returns false, so that
+// the block is searched, when the field does not fit.
+static bool import_me_b64(PictureParentControlSet* pcs, uint32_t b64_index, MeContext* me_ctx) {
+    const SvtAv1MeField* field    = pcs->me_field_in;
+    const uint8_t        l0_count = me_ctx->num_of_ref_pic_to_search[REF_LIST_0];
+    if (field->block_count != SVT_AV1_ME_FIELD_BLOCKS || field->width != pcs->aligned_width ||
+        field->height != pcs->aligned_height ||
+        field->ref_count != l0_count + me_ctx->num_of_ref_pic_to_search[REF_LIST_1]) {
+        return false;
+    }
+    for (uint32_t list_i = REF_LIST_0; list_i < me_ctx->num_of_list_to_search; ++list_i) {
+        for (uint8_t ref_i = 0; ref_i < me_ctx->num_of_ref_pic_to_search[list_i]; ++ref_i) {
+            if (field->ref_picture_number[(list_i ? l0_count : 0) + ref_i] !=
+                me_ctx->me_ds_ref_array[list_i][ref_i].picture_number) {
+                return false;
+            }
+        }
+    }
+
+    const SvtAv1MeFieldMv* mvs = SVT_AV1_ME_FIELD_MVS(field) +
+        (size_t)b64_index * field->ref_count * SVT_AV1_ME_FIELD_BLOCKS;
+    for (uint32_t list_i = REF_LIST_0; list_i < me_ctx->num_of_list_to_search; ++list_i) {
+        for (uint8_t ref_i = 0; ref_i < me_ctx->num_of_ref_pic_to_search[list_i]; ++ref_i) {
+            const SvtAv1MeFieldMv* mv = &mvs[((list_i ? l0_count : 0) + ref_i) * SVT_AV1_ME_FIELD_BLOCKS];
+            if (mv->x == SVT_AV1_ME_FIELD_INVALID_MV) {
+                me_ctx->search_results[list_i][ref_i].do_ref = 0;
+                continue;
+            }
+            for (uint32_t i = 0; i < SVT_AV1_ME_FIELD_BLOCKS; i++) {
+                me_ctx->p_sb_best_mv[list_i][ref_i][i]  = ((uint32_t)mv[i].y << 16) | ((uint16_t)mv[i].x);
+                me_ctx->p_sb_best_sad[list_i][ref_i][i] = mv[i].sad;
+            }
+        }
+    }
+    return true;
+}
+
 EbErrorType svt_aom_motion_estimation_b64(
     PictureParentControlSet* pcs, // input parameter, Picture Control Set Ptr
     uint32_t                 b64_index, // input parameter, SB Index
@@ -2909,6 +3142,7 @@ EbErrorType svt_aom_motion_estimation_b64(
 
     //pruning of the references is not done for alt-ref / when HMeLevel2 not done
     uint8_t prune_ref = me_ctx->enable_hme_flag && me_ctx->me_type != ME_MCTF;
+    const bool export_field = pcs->me_field_out && me_ctx->me_type == ME_OPEN_LOOP;
     // Initialize ME/HME buffers. This MUST run for every b64, including the static-b64 bypass
     // below: init_me_hme_data zeroes the *entire* p_sb_best_mv across all lists/refs (the
     // "R2R FIX" dirty-MV guard) and resets the per-ref search_results. The bypass only populates
@@ -2916,10 +3150,21 @@ EbErrorType svt_aom_motion_estimation_b64(
     // processed b64, which can drive an out-of-bounds reference fetch in inter prediction
     // (observed as a SIGSEGV in svt_av1_convolve_2d_copy_sr_neon on edge SBs at >=1080p RTC).
     init_me_hme_data(me_ctx);
-    if (!me_static_b64_bypass(me_ctx, b64_origin_x, b64_origin_y)) {
+    const bool static_b64 = me_static_b64_bypass(me_ctx, b64_origin_x, b64_origin_y);
+    if (!static_b64 && pcs->me_field_in && me_ctx->me_type == ME_OPEN_LOOP && import_me_b64(pcs, b64_index, me_ctx)) {
+        if (export_field) {
+            store_me_field(pcs, b64_index, me_ctx);
+        }
+        if (prune_ref && me_ctx->me_hme_prune_ctrls.enable_me_hme_ref_pruning) {
+            me_prune_ref(me_ctx);
+        }
+    } else if (!static_b64) {
         // HME: Perform Hierarchical Motion Estimation for all reference frames for the current 64x64 block.
         hme_b64(pcs, b64_origin_x, b64_origin_y, me_ctx, input_ptr);
 
+        if (me_ctx->me_type == ME_MCTF && me_ctx->enable_hme_flag) {
+            store_tf_mv(pcs, b64_index, me_ctx);
+        }
         if (me_ctx->me_type == ME_MCTF && me_ctx->search_results[0][0].hme_sad < me_ctx->tf_me_exit_th) {
             me_ctx->tf_use_pred_64x64_only_th = (uint8_t)~0;
             return return_error;
@@ -2930,11 +3175,24 @@ EbErrorType svt_aom_motion_estimation_b64(
         }
         // Full pel: Perform the Integer Motion Estimation on the allowed reference frames.
         integer_search_b64(pcs, me_ctx, b64_origin_x, b64_origin_y, input_ptr);
+        if (export_field) {
+            store_me_field(pcs, b64_index, me_ctx);
+        }
 
         // prune the reference frames
         if (prune_ref && me_ctx->me_hme_prune_ctrls.enable_me_hme_ref_pruning) {
             me_prune_ref(me_ctx);
         }
+    } else if (export_field) {
+        store_me_field(pcs, b64_index, me_ctx);
+    }
+    if (me_ctx->mv_proj_ctrls.enabled && me_ctx->me_type == ME_OPEN_LOOP) {
+        // Keep the 64x64 vector against the nearest list 0 reference for the pictures that reference this one
+        EbPaReferenceObject* pa_ref_obj = (EbPaReferenceObject*)pcs->pa_ref_pic_wrapper->object_ptr;
+        pa_ref_obj->me_mv_field[b64_index].as_int = me_ctx->num_of_ref_pic_to_search[REF_LIST_0] &&
+                me_ctx->search_results[REF_LIST_0][0].do_ref
+            ? me_ctx->p_sb_best_mv[REF_LIST_0][0][0]
+            : INVALID_MV;
     }
 
     if (me_ctx->me_type != ME_MCTF) {
@@ -99,7 +99,7 @@ static uint32_t count_frames_in_next_tu(const EncodeContext* enc_ctx, uint32_t*
         }
 
         const EbBufferHeaderType* output_stream_ptr = (EbBufferHeaderType*)wrapper->object_ptr;
-        *data_size += output_stream_ptr->n_filled_len;
+        *data_size += queue_entry_ptr->frame_size;
 
         i++;
         //we have a td when we got a displable frame
@@ -287,85 +287,112 @@ static void collect_frames_info(PacketizationContext* context_ptr, const EncodeC
             finish_time_seconds,
             finish_time_u_seconds);
         output_stream_ptr->p_app_private = (EbBufferHeaderType*)NULL;
+        EbOutputPacket* packet = (EbOutputPacket*)output_stream_ptr;
+        if (packet->has_timing) {
+            packet->timing.stage_us[SVT_AV1_FRAME_STAGE_OUTPUT] = finish_time_seconds * 1000000 + finish_time_u_seconds;
+        }
         if (queue_entry_ptr->is_alt_ref) {
             output_stream_ptr->flags |= (uint32_t)EB_BUFFERFLAG_IS_ALT_REF;
         }
     }
 }
 
-#define TD_SIZE 2
+static void release_packet_buffer(EbObjectWrapper* wrapper, void* release_ctx) {
+    const SvtAv1OutputAllocator* allocator = (const SvtAv1OutputAllocator*)release_ctx;
+    EbBufferHeaderType*          packet    = (EbBufferHeaderType*)wrapper->object_ptr;
+    allocator->release(allocator->ctx, packet->p_buffer);
+    packet->p_buffer = NULL;
+}
+
+// Give the packet a buffer of size bytes, from the output allocator of the application when it has one
+static EbErrorType alloc_packet_buffer(EncodeContext* enc_ctx, EbObjectWrapper* wrapper, uint32_t size) {
+    const SvtAv1OutputAllocator* allocator = &enc_ctx->output_allocator;
+    EbBufferHeaderType*          packet    = (EbBufferHeaderType*)wrapper->object_ptr;
+    packet->p_buffer                       = allocator->alloc ? allocator->alloc(allocator->ctx, size) : NULL;
+    if (packet->p_buffer) {
+        wrapper->release_cb  = release_packet_buffer;
+        wrapper->release_ctx = (void*)allocator;
+    } else {
+        EB_MALLOC(packet->p_buffer, size);
+    }
+    packet->n_alloc_len = size;
+    return EB_ErrorNone;
+}
 
 // a tu start with a td, + 0 more not displable frame, + 1 display frame
 static EbErrorType encode_tu(EncodeContext* enc_ctx, int frames, uint32_t total_bytes,
-                             EbBufferHeaderType* output_stream_ptr) {
+                             EbObjectWrapper* output_stream_wrapper_ptr) {
+    EbBufferHeaderType*        output_stream_ptr = (EbBufferHeaderType*)output_stream_wrapper_ptr->object_ptr;
+    PacketizationReorderEntry* last_entry        = get_reorder_queue_entry(enc_ctx, frames - 1);
+    EbErrorType                return_error      = EB_ErrorNone;
     total_bytes += TD_SIZE;
-    if (total_bytes > output_stream_ptr->n_alloc_len) {
-        uint8_t* pbuff;
-        EB_MALLOC(pbuff, total_bytes);
-        if (!pbuff) {
-            SVT_ERROR("failed to allocate more memory in encode_tu");
-            return EB_ErrorInsufficientResources;
+    if (frames == 1 && !enc_ctx->output_allocator.alloc) {
+        // a single frame is sent from the buffer it was staged in, which has room for the td
+        output_stream_ptr->p_buffer    = last_entry->frame_data;
+        output_stream_ptr->n_alloc_len = last_entry->frame_data_alloc;
+        last_entry->frame_data         = NULL;
+        last_entry->frame_data_alloc   = 0;
+    } else if ((return_error = alloc_packet_buffer(enc_ctx, output_stream_wrapper_ptr, total_bytes)) ==
+               EB_ErrorNone) {
+        uint8_t* dst = output_stream_ptr->p_buffer + TD_SIZE;
+        for (int i = 0; i < frames; i++) {
+            const PacketizationReorderEntry* queue_entry_ptr = get_reorder_queue_entry(enc_ctx, i);
+            svt_memcpy(dst, queue_entry_ptr->frame_data + TD_SIZE, queue_entry_ptr->frame_size);
+            dst += queue_entry_ptr->frame_size;
         }
-        svt_memcpy(pbuff,
-                   output_stream_ptr->p_buffer,
-                   output_stream_ptr->n_alloc_len > total_bytes ? total_bytes : output_stream_ptr->n_alloc_len);
-        EB_FREE(output_stream_ptr->p_buffer);
-        output_stream_ptr->p_buffer    = pbuff;
-        output_stream_ptr->n_alloc_len = total_bytes;
-    }
-    uint8_t* dst = output_stream_ptr->p_buffer + total_bytes;
-    // we use last frame's output_stream_ptr to hold entire tu, so we need copy backward.
-    for (int i = frames - 1; i >= 0; i--) {
+    } else {
+        SVT_ERROR("failed to allocate more memory in encode_tu");
+    }
+    for (int i = 0; i < frames - 1; i++) {
         PacketizationReorderEntry* queue_entry_ptr = get_reorder_queue_entry(enc_ctx, i);
         EbObjectWrapper*           wrapper         = queue_entry_ptr->output_stream_wrapper_ptr;
-        EbBufferHeaderType*        src_stream_ptr  = (EbBufferHeaderType*)wrapper->object_ptr;
-        uint32_t                   size            = src_stream_ptr->n_filled_len;
-        dst -= size;
-        memmove(dst, src_stream_ptr->p_buffer, size);
         // 1. The last frame is a displayable frame, others are undisplayed.
         // 2. We do not push alt ref frame since the overlay frame will carry the pts.
         // 3. Release alt ref stream buffer here for it will not be sent out
-        if (i != frames - 1 && !queue_entry_ptr->is_alt_ref) {
+        if (!queue_entry_ptr->is_alt_ref) {
             push_undisplayed_frame(enc_ctx, wrapper);
-        } else if (queue_entry_ptr->is_alt_ref) {
-            EB_FREE(src_stream_ptr->p_buffer);
+        } else {
             svt_release_object(wrapper);
         }
     }
     if (frames > 1) {
         sort_undisplayed_frame(enc_ctx);
     }
-    dst -= TD_SIZE;
-    svt_aom_encode_td_av1(dst);
+    if (return_error != EB_ErrorNone) {
+        return return_error;
+    }
+    svt_aom_encode_td_av1(output_stream_ptr->p_buffer);
     output_stream_ptr->n_filled_len = total_bytes;
     output_stream_ptr->flags |= EB_BUFFERFLAG_HAS_TD;
     return EB_ErrorNone;
 }
 
-static EbErrorType copy_data_from_bitstream(EncodeContext* enc_ctx, Bitstream* bitstream_ptr,
-                                            EbBufferHeaderType* output_stream_ptr) {
-    EbErrorType return_error = EB_ErrorNone;
-    int         size         = svt_aom_bitstream_get_bytes_count(bitstream_ptr);
-
-    CHECK_REPORT_ERROR((size + output_stream_ptr->n_filled_len < output_stream_ptr->n_alloc_len),
-                       enc_ctx->app_callback_ptr,
-                       EB_ENC_EC_ERROR2);
-
-    void* dest = output_stream_ptr->p_buffer + output_stream_ptr->n_filled_len;
-    svt_aom_bitstream_copy(bitstream_ptr, dest, size);
-    output_stream_ptr->n_filled_len += size;
-
-    return return_error;
+// Keep the coded frame in its reorder queue entry until its temporal unit is complete
+static EbErrorType stage_frame(PacketizationReorderEntry* queue_entry_ptr, Bitstream* bitstream_ptr) {
+    const uint32_t size = svt_aom_bitstream_get_bytes_count(bitstream_ptr);
+    if (size + TD_SIZE > queue_entry_ptr->frame_data_alloc) {
+        EB_FREE(queue_entry_ptr->frame_data);
+        queue_entry_ptr->frame_data_alloc = 0;
+        EB_MALLOC(queue_entry_ptr->frame_data, size + TD_SIZE);
+        queue_entry_ptr->frame_data_alloc = size + TD_SIZE;
+    }
+    svt_aom_bitstream_copy(bitstream_ptr, queue_entry_ptr->frame_data + TD_SIZE, size);
+    queue_entry_ptr->frame_size = size;
+    return EB_ErrorNone;
 }
 
 static void encode_show_existing(EncodeContext* enc_ctx, PacketizationReorderEntry* queue_entry_ptr,
-                                 EbBufferHeaderType* output_stream_ptr) {
-    uint8_t* dst = output_stream_ptr->p_buffer;
-
-    svt_aom_encode_td_av1(dst);
-    output_stream_ptr->n_filled_len = TD_SIZE;
+                                 EbObjectWrapper* output_stream_wrapper_ptr) {
+    EbBufferHeaderType* output_stream_ptr = (EbBufferHeaderType*)output_stream_wrapper_ptr->object_ptr;
+    const uint32_t      size              = svt_aom_bitstream_get_bytes_count(queue_entry_ptr->bitstream_ptr);
 
-    copy_data_from_bitstream(enc_ctx, queue_entry_ptr->bitstream_ptr, output_stream_ptr);
+    if (alloc_packet_buffer(enc_ctx, output_stream_wrapper_ptr, TD_SIZE + size) != EB_ErrorNone) {
+        SVT_ERROR("failed to allocate memory in encode_show_existing");
+        return;
+    }
+    svt_aom_encode_td_av1(output_stream_ptr->p_buffer);
+    svt_aom_bitstream_copy(queue_entry_ptr->bitstream_ptr, output_stream_ptr->p_buffer + TD_SIZE, size);
+    output_stream_ptr->n_filled_len = TD_SIZE + size;
 
     output_stream_ptr->flags |= (EB_BUFFERFLAG_SHOW_EXT | EB_BUFFERFLAG_HAS_TD);
 }
@@ -436,12 +463,6 @@ inline static void set_eos_flag(EbBufferHeaderType* output_stream_ptr) {
     output_stream_ptr->flags |= EB_BUFFERFLAG_EOS;
 }
 
-/* Wrapper function to capture the return of EB_MALLOC */
-static inline EbErrorType malloc_p_buffer(EbBufferHeaderType* output_stream_ptr) {
-    EB_MALLOC(output_stream_ptr->p_buffer, output_stream_ptr->n_alloc_len);
-    return EB_ErrorNone;
-}
-
 void update_firstpass_stats(PictureParentControlSet* pcs, const int frame_number, const double ts_duration,
                             StatStruct* stat_struct);
 void svt_av1_end_first_pass(PictureParentControlSet* pcs);
@@ -470,6 +491,7 @@ EbErrorType svt_aom_packetization_kernel_iter(void* context) {
     Av1Common* const         cm       = pcs->ppcs->av1_cm;
     uint16_t                 tile_cnt = cm->tiles_info.tile_rows * cm->tiles_info.tile_cols;
     PictureParentControlSet* ppcs     = (PictureParentControlSet*)pcs->ppcs;
+    svt_aom_stamp_frame_stage(ppcs, SVT_AV1_FRAME_STAGE_PACKETIZATION);
 
     if (ppcs->superres_total_recode_loop > 0 && ppcs->superres_recode_loop < ppcs->superres_total_recode_loop) {
         // Reset the Bitstream before writing to it
@@ -653,10 +675,8 @@ EbErrorType svt_aom_packetization_kernel_iter(void* context) {
                 }
             }
 
-            //free palette data
-            if (pcs->tile_tok[0][0]) {
-                EB_FREE_ARRAY(pcs->tile_tok[0][0]);
-            }
+            // palette data is held by pcs->arena
+            pcs->tile_tok[0][0] = NULL;
         }
     } else if (!(pcs->ppcs->compute_psnr || pcs->ppcs->compute_ssim)) {
         free_temporal_filtering_buffer(pcs);
@@ -725,6 +745,11 @@ EbErrorType svt_aom_packetization_kernel_iter(void* context) {
         output_stream_ptr->cr_ssim   = 0;
         output_stream_ptr->cb_ssim   = 0;
     }
+    EbOutputPacket* packet = (EbOutputPacket*)output_stream_ptr;
+    packet->has_timing     = pcs->ppcs->record_timing;
+    if (packet->has_timing) {
+        memcpy(packet->timing.stage_us, pcs->ppcs->stage_us, sizeof(pcs->ppcs->stage_us));
+    }
 
     // Get Empty Rate Control Input Tasks
     svt_get_empty_object(context_ptr->rate_control_tasks_output_fifo_ptr, &rate_control_tasks_wrapper_ptr);
@@ -757,8 +782,6 @@ EbErrorType svt_aom_packetization_kernel_iter(void* context) {
     // Reset the Bitstream before writing to it
     svt_aom_bitstream_reset(pcs->bitstream_ptr);
 
-    size_t metadata_sz = 0;
-
     // Code the SPS
     if (frm_hdr->frame_type == KEY_FRAME) {
         svt_aom_encode_sps_av1(pcs->bitstream_ptr, scs);
@@ -779,18 +802,13 @@ EbErrorType svt_aom_packetization_kernel_iter(void* context) {
             enc_ctx->packetization_reorder_queue[current_picture_number % enc_ctx->packetization_reorder_queue_size];
         temp_entry->metadata           = pcs->ppcs->input_ptr->metadata;
         pcs->ppcs->input_ptr->metadata = NULL;
-        metadata_sz                    = svt_metadata_size(temp_entry->metadata, EB_AV1_METADATA_TYPE_ITUT_T35);
     }
 
     svt_aom_write_frame_header_av1(pcs->bitstream_ptr, scs, pcs, 0);
 
-    output_stream_ptr->n_alloc_len = (uint32_t)(svt_aom_bitstream_get_bytes_count(pcs->bitstream_ptr) + TD_SIZE +
-                                                metadata_sz);
-    malloc_p_buffer(output_stream_ptr);
-
-    assert(output_stream_ptr->p_buffer != NULL && "bit-stream memory allocation failure");
+    stage_frame(queue_entry_ptr, pcs->bitstream_ptr);
 
-    copy_data_from_bitstream(enc_ctx, pcs->bitstream_ptr, output_stream_ptr);
+    assert(queue_entry_ptr->frame_data != NULL && "bit-stream memory allocation failure");
 
     if (pcs->ppcs->has_show_existing) {
         uint64_t next_picture_number = pcs->picture_number + 1;
@@ -815,7 +833,7 @@ EbErrorType svt_aom_packetization_kernel_iter(void* context) {
     }
 
     // Send the number of bytes per frame to RC
-    pcs->ppcs->total_num_bits = (uint64_t)output_stream_ptr->n_filled_len << 3;
+    pcs->ppcs->total_num_bits = (uint64_t)queue_entry_ptr->frame_size << 3;
     if (scs->passes == 2 && scs->static_config.pass == ENC_FIRST_PASS) {
         StatStruct stat_struct;
         stat_struct.poc = pcs->picture_number;
@@ -893,7 +911,7 @@ EbErrorType svt_aom_packetization_kernel_iter(void* context) {
         output_stream_wrapper_ptr = queue_entry_ptr->output_stream_wrapper_ptr;
         output_stream_ptr         = (EbBufferHeaderType*)output_stream_wrapper_ptr->object_ptr;
         eos                       = output_stream_ptr->flags & EB_BUFFERFLAG_EOS;
-        encode_tu(enc_ctx, frames, total_bytes, output_stream_ptr);
+        encode_tu(enc_ctx, frames, total_bytes, output_stream_wrapper_ptr);
 
         if (eos && queue_entry_ptr->has_show_existing) {
             clear_eos_flag(output_stream_ptr);
@@ -904,7 +922,7 @@ EbErrorType svt_aom_packetization_kernel_iter(void* context) {
             EbObjectWrapper* existed = pop_undisplayed_frame(enc_ctx);
             if (existed) {
                 EbBufferHeaderType* existed_output_stream_ptr = (EbBufferHeaderType*)existed->object_ptr;
-                encode_show_existing(enc_ctx, queue_entry_ptr, existed_output_stream_ptr);
+                encode_show_existing(enc_ctx, queue_entry_ptr, existed);
                 if (eos) {
                     set_eos_flag(existed_output_stream_ptr);
                 }
@@ -24,6 +24,15 @@ EbErrorType svt_aom_packetization_context_ctor(EbThreadContext* thread_ctx, cons
                                                int rate_control_index, int demux_index, int me_port_index);
 
 void* svt_aom_packetization_kernel(void* input_ptr);
+
+// Object of the output stream buffer pool: the packet returned by
+// svt_av1_enc_get_packet() and what is read back through separate calls, so
+// that EbBufferHeaderType keeps its layout.
+typedef struct EbOutputPacket {
+    EbBufferHeaderType header; // must stay first
+    bool               has_timing; // FRAME_TIMING_EVENT was sent with the picture
+    SvtAv1FrameTiming  timing;
+} EbOutputPacket;
 // Release the pd_dpb and ref_pic_list at the end of the sequence
 void release_references_eos(SequenceControlSet* scs);
 #ifdef __cplusplus
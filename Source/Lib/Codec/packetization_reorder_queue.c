@@ -15,6 +15,7 @@
 static void packetization_reorder_entry_dctor(EbPtr p) {
     PacketizationReorderEntry* obj = (PacketizationReorderEntry*)p;
     EB_DELETE(obj->bitstream_ptr);
+    EB_FREE(obj->frame_data);
 }
 
 EbErrorType svt_aom_packetization_reorder_entry_ctor(PacketizationReorderEntry* entry_ptr, uint32_t picture_number) {
@@ -20,6 +20,9 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+// Size of a temporal delimiter OBU
+#define TD_SIZE 2
+
 /************************************************
      * Packetization Reorder Queue Entry
      ************************************************/
@@ -46,6 +49,11 @@ typedef struct PacketizationReorderEntry {
     uint8_t    show_existing_frame;
     //small size bitstream for show existing frame
     Bitstream* bitstream_ptr;
+    // Coded frame kept until its temporal unit is complete, from byte
+    // TD_SIZE on so that a single frame unit can be sent from this buffer
+    uint8_t* frame_data;
+    uint32_t frame_size;
+    uint32_t frame_data_alloc;
     //valid when has_show_existing is true
     int64_t                  next_pts;
     uint8_t                  is_alt_ref;
@@ -20,6 +20,8 @@
 #include "resource_coordination_process.h"
 #include "md_config_process.h"
 #include "enc_mode_config.h"
+#include "svt_time.h"
+#include "svt_threads.h"
 
 void svt_aom_set_tile_info(PictureParentControlSet* pcs);
 
@@ -137,6 +139,7 @@ static void picture_control_set_dctor(EbPtr p) {
     uint16_t           tile_cnt = obj->tile_row_count * obj->tile_column_count;
     uint8_t            depth;
     svt_av1_hash_table_destroy(&obj->hash_table);
+    svt_arena_destroy(&obj->arena);
     EB_FREE_ALIGNED_ARRAY(obj->tpl_mvs);
     EB_DELETE_PTR_ARRAY(obj->enc_dec_segment_ctrl, tile_cnt);
     EB_DELETE_PTR_ARRAY(obj->ep_luma_recon_na, tile_cnt);
@@ -243,6 +246,7 @@ typedef struct InitData {
 #define DIM(array) (sizeof(array) / sizeof(array[0]))
 
 static EbErrorType create_neighbor_array_units(InitData* data, size_t count) {
+    const SvtMemScope mem_scope = svt_mem_category_enter(SVT_AV1_MEMORY_NEIGHBOR_ARRAYS);
     for (size_t i = 0; i < count; i++) {
         EB_NEW(*data[i].na_unit_dbl_ptr,
                svt_aom_neighbor_array_unit_ctor,
@@ -252,6 +256,7 @@ static EbErrorType create_neighbor_array_units(InitData* data, size_t count) {
                data[i].granularity_normal,
                data[i].type_mask);
     }
+    svt_mem_scope_leave(mem_scope);
     return EB_ErrorNone;
 }
 
@@ -309,9 +314,10 @@ static EbErrorType recon_coef_ctor(EncDecSet* object_ptr, EbPtr object_init_data
     input_pic_buf_desc_init_data.max_width          = init_data_ptr->picture_width;
     input_pic_buf_desc_init_data.max_height         = init_data_ptr->picture_height;
     input_pic_buf_desc_init_data.bit_depth          = init_data_ptr->bit_depth;
-    input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
-    input_pic_buf_desc_init_data.color_format       = init_data_ptr->color_format;
-    uint16_t padding                                = init_data_ptr->sb_size + 32;
+    input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK |
+        svt_aom_huge_page_mask(init_data_ptr->static_config.huge_pages);
+    input_pic_buf_desc_init_data.color_format = init_data_ptr->color_format;
+    uint16_t padding                          = init_data_ptr->sb_size + 32;
     if (init_data_ptr->is_scale) {
         padding += init_data_ptr->sb_size;
     }
@@ -350,7 +356,8 @@ static EbErrorType recon_coef_ctor(EncDecSet* object_ptr, EbPtr object_init_data
     //object_ptr->sb_total_count_pix = all_sb;
 
     EbPictureBufferDescInitData coeff_init_data;
-    coeff_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
+    coeff_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK |
+        svt_aom_huge_page_mask(init_data_ptr->static_config.huge_pages);
     coeff_init_data.max_width          = init_data_ptr->sb_size;
     coeff_init_data.max_height         = init_data_ptr->sb_size;
     coeff_init_data.bit_depth          = EB_THIRTYTWO_BIT;
@@ -535,6 +542,7 @@ static EbErrorType picture_control_set_ctor(PictureControlSet* object_ptr, EbPtr
         EB_NEW(object_ptr->input_frame16bit, svt_picture_buffer_desc_ctor, (EbPtr)&coeff_buffer_desc_init_data);
     }
     // Entropy Coder
+    const SvtMemScope mem_scope = svt_mem_category_enter(SVT_AV1_MEMORY_ENTROPY);
     EB_ALLOC_PTR_ARRAY(object_ptr->ec_info, total_tile_cnt);
     for (tile_idx = 0; tile_idx < total_tile_cnt; tile_idx++) {
         EB_NEW(object_ptr->ec_info[tile_idx], svt_aom_entropy_tile_info_ctor, output_buffer_size / total_tile_cnt);
@@ -542,6 +550,7 @@ static EbErrorType picture_control_set_ctor(PictureControlSet* object_ptr, EbPtr
 
     // Packetization process Bitstream
     EB_NEW(object_ptr->bitstream_ptr, svt_aom_bitstream_ctor, output_buffer_size);
+    svt_mem_scope_leave(mem_scope);
 
     // GOP
     object_ptr->picture_number       = 0;
@@ -1145,6 +1154,9 @@ static void picture_parent_control_set_dctor(EbPtr ptr) {
     }
     EB_FREE_ARRAY(obj->rc_me_distortion);
     EB_FREE_ARRAY(obj->rc_me_allow_gm);
+    if (obj->me_field_out) {
+        EB_FREE(obj->me_field_out);
+    }
     EB_FREE_ARRAY(obj->me_64x64_distortion);
     EB_FREE_ARRAY(obj->me_32x32_distortion);
     EB_FREE_ARRAY(obj->me_16x16_distortion);
@@ -1295,6 +1307,12 @@ static EbErrorType picture_parent_control_set_ctor(PictureParentControlSet* obje
 
     EB_MALLOC_ARRAY(object_ptr->rc_me_distortion, object_ptr->b64_total_count);
     EB_MALLOC_ARRAY(object_ptr->rc_me_allow_gm, object_ptr->b64_total_count);
+    if (init_data_ptr->me_field_blocks) {
+        EB_MALLOC(object_ptr->me_field_out,
+                  SVT_AV1_ME_FIELD_SIZE(
+                      picture_b64_width, picture_b64_height, SVT_AV1_ME_FIELD_MAX_REFS, init_data_ptr->me_field_blocks));
+        object_ptr->me_field_out->block_count = init_data_ptr->me_field_blocks;
+    }
     EB_CALLOC_ARRAY(object_ptr->me_64x64_distortion, object_ptr->b64_total_count);
     EB_MALLOC_ARRAY(object_ptr->me_32x32_distortion, object_ptr->b64_total_count);
     EB_MALLOC_ARRAY(object_ptr->me_16x16_distortion, object_ptr->b64_total_count);
@@ -1312,6 +1330,7 @@ static EbErrorType picture_parent_control_set_ctor(PictureParentControlSet* obje
     EB_CREATE_SEMAPHORE(object_ptr->tpl_disp_done_semaphore, 0, 1);
     EB_CREATE_MUTEX(object_ptr->tpl_disp_mutex);
 
+    const SvtMemScope mem_scope = svt_mem_category_enter(SVT_AV1_MEMORY_TPL);
     EB_MALLOC_ARRAY(object_ptr->tpl_disp_segment_ctrl, 1);
     for (uint32_t tile_idx = 0; tile_idx < 1; tile_idx++) {
         EB_NEW(object_ptr->tpl_disp_segment_ctrl[tile_idx],
@@ -1319,6 +1338,7 @@ static EbErrorType picture_parent_control_set_ctor(PictureParentControlSet* obje
                init_data_ptr->enc_dec_segment_col,
                init_data_ptr->enc_dec_segment_row);
     }
+    svt_mem_scope_leave(mem_scope);
     object_ptr->av1_cm->mi_stride = picture_b64_width * (BLOCK_SIZE_64 / 4);
 
     EB_MALLOC_ARRAY(object_ptr->av1_cm->frame_to_show, 1);
@@ -1462,6 +1482,7 @@ static EbErrorType me_ctor(MotionEstimationData* object_ptr, EbPtr object_init_d
             adaptive_picture_width_in_mb  = (uint16_t)((init_data_ptr->picture_width + 31) / 32);
             adaptive_picture_height_in_mb = (uint16_t)((init_data_ptr->picture_height + 31) / 32);
         }
+        const SvtMemScope mem_scope = svt_mem_category_enter(SVT_AV1_MEMORY_TPL);
         EB_MALLOC_2D(
             object_ptr->tpl_stats, (uint32_t)((adaptive_picture_width_in_mb) * (adaptive_picture_height_in_mb)), 1);
         if (init_data_ptr->tpl_lad_mg > 0) {
@@ -1475,6 +1496,7 @@ static EbErrorType me_ctor(MotionEstimationData* object_ptr, EbPtr object_init_d
                         adaptive_picture_width_in_mb * adaptive_picture_height_in_mb);
         EB_MALLOC_ARRAY(object_ptr->tpl_sb_rdmult_scaling_factors,
                         adaptive_picture_width_in_mb * adaptive_picture_height_in_mb);
+        svt_mem_scope_leave(mem_scope);
     } else {
         object_ptr->tpl_stats                     = NULL;
         object_ptr->tpl_beta                      = NULL;
@@ -1570,3 +1592,15 @@ EbErrorType svt_aom_me_creator(EbPtr* object_dbl_ptr, EbPtr object_init_data_ptr
 
     return EB_ErrorNone;
 }
+
+// Record when the picture entered a stage, for the FRAME_TIMING_EVENT of the
+// picture. Stages split in segments or tiles run on several threads; the first
+// thread to swap in its timestamp wins and the others keep it.
+void svt_aom_stamp_frame_stage(PictureParentControlSet* pcs, SvtAv1FrameStage stage) {
+    if (!pcs->record_timing || svt_atomic_load_u64(&pcs->stage_us[stage])) {
+        return;
+    }
+    uint64_t seconds, useconds;
+    svt_av1_get_time(&seconds, &useconds);
+    svt_atomic_cas_u64(&pcs->stage_us[stage], 0, seconds * 1000000 + useconds);
+}
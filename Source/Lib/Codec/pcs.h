@@ -31,6 +31,7 @@
 
 #include "av1me.h"
 #include "hash_motion.h"
+#include "svt_arena.h"
 #include "firstpass.h"
 
 #ifdef __cplusplus
@@ -351,6 +352,8 @@ typedef struct PictureControlSet {
     InputCoeffLvl    coeff_lvl;
     SearchSiteConfig ss_cfg; // CHKN this might be a seq based
     HashTable        hash_table;
+    // Buffers that live as long as the picture, reset when the PCS is reused
+    SvtArena         arena;
 
     FRAME_CONTEXT*                  ec_ctx_array;
     FRAME_CONTEXT                   md_frame_context;
@@ -830,6 +833,10 @@ typedef struct PictureParentControlSet {
     uint64_t                                start_time_u_seconds;
     bool                                    compute_psnr;
     bool                                    compute_ssim;
+    bool                                    record_timing; // FRAME_TIMING_EVENT
+    uint64_t                                stage_us[SVT_AV1_FRAME_STAGE_COUNT];
+    const SvtAv1MeField*                    me_field_in; // ME_FIELD_EVENT, held by the input private data
+    SvtAv1MeField*                          me_field_out; // exported through the ME field sink
     uint64_t                                luma_sse;
     uint64_t                                cr_sse;
     uint64_t                                cb_sse;
@@ -911,13 +918,10 @@ typedef struct PictureParentControlSet {
     // index of picture in the mg
     uint32_t pic_idx_in_mg;
 
-    // Global quant matrix tables
-    const QmVal* giqmatrix[NUM_QM_LEVELS][3][TX_SIZES_ALL];
-    const QmVal* gqmatrix[NUM_QM_LEVELS][3][TX_SIZES_ALL];
-    int32_t      min_qmlevel;
-    int32_t      max_qmlevel;
-    int32_t      min_chroma_qmlevel;
-    int32_t      max_chroma_qmlevel;
+    int32_t min_qmlevel;
+    int32_t max_qmlevel;
+    int32_t min_chroma_qmlevel;
+    int32_t max_chroma_qmlevel;
     // Encoder
     LoopFilterInfoN lf_info;
 
@@ -1237,6 +1241,7 @@ typedef struct PictureControlSetInitData {
     bool    adaptive_film_grain;
     bool    use_flat_ipp;
     int     hbd_mds;
+    uint8_t me_field_blocks; // vectors per B64 and reference to export, 0 when not exporting
 } PictureControlSetInitData;
 
 /**************************************
@@ -1256,6 +1261,7 @@ EbErrorType pcs_update_param(PictureControlSet* pcs, int8_t enc_mode);
 EbErrorType me_update_param(MotionEstimationData* me_data, struct SequenceControlSet* scs);
 EbErrorType recon_coef_update_param(EncDecSet* recon_coef, struct SequenceControlSet* scs);
 bool        svt_aom_is_pic_skipped(PictureParentControlSet* pcs);
+void        svt_aom_stamp_frame_stage(PictureParentControlSet* pcs, SvtAv1FrameStage stage);
 void svt_aom_get_gm_needed_resolutions(uint8_t ds_lvl, bool* gm_need_full, bool* gm_need_quart, bool* gm_need_sixteen);
 
 EbErrorType b64_geom_init(struct SequenceControlSet* scs, uint16_t width, uint16_t height, B64Geom** b64_geoms);
@@ -4202,6 +4202,31 @@ static void mctf_frame_st(SequenceControlSet* scs, PictureParentControlSet* pcs)
 }
 #endif
 
+/*
+  Key the slots of the TF HME centres of the picture with the neighbours TF searches, so that the open-loop ME of
+  the pictures in the same pairs can start from them
+*/
+static void set_tf_mv_keys(SequenceControlSet* scs, PictureParentControlSet* pcs) {
+    if (!svt_aom_get_mv_proj_level(scs, pcs)) {
+        return;
+    }
+    EbPaReferenceObject* pa_ref_obj = (EbPaReferenceObject*)pcs->pa_ref_pic_wrapper->object_ptr;
+    const uint32_t       b64_count = ((pcs->aligned_width + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64) *
+        ((pcs->aligned_height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64);
+    for (int pic_i = 0; pic_i < pcs->past_altref_nframes + pcs->future_altref_nframes + 1; pic_i++) {
+        const PictureParentControlSet* tf_pcs = pcs->temp_filt_pcs_list[pic_i];
+        const int32_t slot = tf_mv_slot((int64_t)tf_pcs->picture_number - (int64_t)pcs->picture_number);
+        if (slot < 0) {
+            continue;
+        }
+        pa_ref_obj->tf_mv_picture_number[slot] = tf_pcs->picture_number;
+        Mv* tf_mv                              = pa_ref_obj->tf_mv + slot * pa_ref_obj->me_mv_field_size;
+        for (uint32_t i = 0; i < b64_count; i++) {
+            tf_mv[i].as_int = INVALID_MV;
+        }
+    }
+}
+
 /*
   Performs Motion Compensated Temporal Filtering in ME process
 */
@@ -4212,6 +4237,7 @@ static void mctf_frame(SequenceControlSet* scs, PictureParentControlSet* pcs, Pi
     }
     if (pcs->tf_ctrls.enabled) {
         derive_tf_window_params(scs, scs->enc_ctx, pcs, pd_ctx);
+        set_tf_mv_keys(scs, pcs);
         pcs->temp_filt_prep_done = 0;
         pcs->tf_tot_horz_blks = pcs->tf_tot_vert_blks = 0;
 
@@ -5358,6 +5384,7 @@ EbErrorType svt_aom_picture_decision_kernel_iter(void* context) {
     scs                 = pcs->scs;
     enc_ctx             = scs->enc_ctx;
     const bool allintra = scs->allintra;
+    svt_aom_stamp_frame_stage(pcs, SVT_AV1_FRAME_STAGE_DECISION);
     // Input Picture Analysis Results into the Picture Decision Reordering Queue
     // Since the prior Picture Analysis processes stage is multithreaded, inputs to the Picture Decision Process
     // can arrive out-of-display-order, so a the Picture Decision Reordering Queue is used to enforce processing of
@@ -1942,6 +1942,7 @@ EbErrorType svt_aom_picture_analysis_kernel_iter(void* context) {
 
     in_results_ptr = (ResourceCoordinationResults*)in_results_wrapper_ptr->object_ptr;
     pcs            = (PictureParentControlSet*)in_results_ptr->pcs_wrapper->object_ptr;
+    svt_aom_stamp_frame_stage(pcs, SVT_AV1_FRAME_STAGE_ANALYSIS);
 
     pcs->is_luma_dominant_input = false;
 
@@ -14,16 +14,55 @@
 
 #include "pic_buffer_desc.h"
 
+// Allocate the backing of one or more pictures, from huge pages when the mask
+// asks for them and the system has them. Mapped memory is already zeroed.
+static EbErrorType pic_buf_alloc_backing(uint8_t** backing, uint8_t* pages, size_t size, uint32_t mask, bool clear) {
+    *pages = SVT_PAGES_HEAP;
+    if (mask & PICTURE_BUFFER_DESC_HUGE_PAGES_FLAG) {
+        SvtPageKind kind;
+        *backing = svt_huge_page_alloc(size, !!(mask & PICTURE_BUFFER_DESC_HUGETLB_FLAG), &kind);
+        if (*backing) {
+            *pages = (uint8_t)kind;
+            return EB_ErrorNone;
+        }
+    }
+    if (clear) {
+        EB_CALLOC_ALIGNED_ARRAY(*backing, size);
+    } else {
+        EB_MALLOC_ALIGNED_ARRAY(*backing, size);
+    }
+    return EB_ErrorNone;
+}
+
+static void pic_buf_free_backing(uint8_t** backing, uint8_t pages, size_t size) {
+    if (pages != SVT_PAGES_HEAP) {
+        svt_huge_page_free(*backing, size);
+        *backing = NULL;
+    } else {
+        EB_FREE_ALIGNED_ARRAY(*backing);
+    }
+}
+
+uint32_t svt_aom_huge_page_mask(uint8_t huge_pages) {
+    return huge_pages == 2 ? PICTURE_BUFFER_DESC_HUGE_PAGES_FLAG | PICTURE_BUFFER_DESC_HUGETLB_FLAG
+        : huge_pages == 1  ? PICTURE_BUFFER_DESC_HUGE_PAGES_FLAG
+                           : 0;
+}
+
+void svt_picture_buffer_desc_free(EbPictureBufferDesc* pic_buf) {
+    pic_buf_free_backing(&pic_buf->buffer_alloc, pic_buf->buffer_pages, pic_buf->buffer_alloc_sz);
+    pic_buf->buffer_alloc_sz  = 0;
+    pic_buf->buffer_pages     = SVT_PAGES_HEAP;
+    pic_buf->y_buffer         = NULL;
+    pic_buf->u_buffer         = NULL;
+    pic_buf->v_buffer         = NULL;
+    pic_buf->y_buffer_bit_inc = NULL;
+    pic_buf->u_buffer_bit_inc = NULL;
+    pic_buf->v_buffer_bit_inc = NULL;
+}
+
 static void svt_picture_buffer_desc_dctor(EbPtr p) {
-    EbPictureBufferDesc* obj = (EbPictureBufferDesc*)p;
-    EB_FREE_ALIGNED_ARRAY(obj->buffer_alloc);
-    obj->buffer_alloc_sz  = 0;
-    obj->y_buffer         = NULL;
-    obj->u_buffer         = NULL;
-    obj->v_buffer         = NULL;
-    obj->y_buffer_bit_inc = NULL;
-    obj->u_buffer_bit_inc = NULL;
-    obj->v_buffer_bit_inc = NULL;
+    svt_picture_buffer_desc_free((EbPictureBufferDesc*)p);
 }
 
 /*****************************************
@@ -97,7 +136,11 @@ EbErrorType svt_picture_buffer_desc_ctor_noy8b(EbPictureBufferDesc* pic_buf, con
 
     // Allocate the Picture Buffers (luma & chroma)
     if (alloc_sz) {
-        EB_MALLOC_ALIGNED_ARRAY(pic_buf->buffer_alloc, alloc_sz);
+        EbErrorType err = pic_buf_alloc_backing(
+            &pic_buf->buffer_alloc, &pic_buf->buffer_pages, alloc_sz, pic_buf_init_data->buffer_enable_mask, false);
+        if (err != EB_ErrorNone) {
+            return err;
+        }
     } else {
         pic_buf->buffer_alloc = NULL;
     }
@@ -250,25 +293,29 @@ static uint32_t svt_pic_buf_desc_calc(EbPictureBufferDesc* pic_buf, const EbPict
     }
     pic_buf->buffer_enable_mask = d->buffer_enable_mask;
 
-    uint32_t alloc_sz = 0;
+    // Compressed bit increment buffers hold 4 pixels per byte, pixel (0, 0) starting a byte: the first byte of the
+    // padding may be partly used
+    const uint32_t bit_inc_div = pic_buf->compressed_2b ? 4 : 1;
+    const uint32_t bit_inc_pad = pic_buf->compressed_2b ? 1 : 0;
+    uint32_t       alloc_sz    = 0;
     buffer_size[0] = buffer_size[1] = buffer_size[2] = 0;
     buffer_bit_inc_size[0] = buffer_bit_inc_size[1] = buffer_bit_inc_size[2] = 0;
     if (d->buffer_enable_mask & PICTURE_BUFFER_DESC_Y_FLAG) {
         alloc_sz += buffer_size[0] = pic_buf->luma_size * bytes_per_pixel;
         if (d->split_mode) {
-            alloc_sz += buffer_bit_inc_size[0] = pic_buf->luma_size * bytes_per_pixel;
+            alloc_sz += buffer_bit_inc_size[0] = pic_buf->luma_size * bytes_per_pixel / bit_inc_div + bit_inc_pad;
         }
     }
     if (d->buffer_enable_mask & PICTURE_BUFFER_DESC_Cb_FLAG) {
         alloc_sz += buffer_size[1] = pic_buf->chroma_size * bytes_per_pixel;
         if (d->split_mode) {
-            alloc_sz += buffer_bit_inc_size[1] = pic_buf->chroma_size * bytes_per_pixel;
+            alloc_sz += buffer_bit_inc_size[1] = pic_buf->chroma_size * bytes_per_pixel / bit_inc_div + bit_inc_pad;
         }
     }
     if (d->buffer_enable_mask & PICTURE_BUFFER_DESC_Cr_FLAG) {
         alloc_sz += buffer_size[2] = pic_buf->chroma_size * bytes_per_pixel;
         if (d->split_mode) {
-            alloc_sz += buffer_bit_inc_size[2] = pic_buf->chroma_size * bytes_per_pixel;
+            alloc_sz += buffer_bit_inc_size[2] = pic_buf->chroma_size * bytes_per_pixel / bit_inc_div + bit_inc_pad;
         }
     }
     *bytes_per_pixel_out = bytes_per_pixel;
@@ -277,6 +324,12 @@ static uint32_t svt_pic_buf_desc_calc(EbPictureBufferDesc* pic_buf, const EbPict
 
 // Point the descriptor's y/u/v(+bit_inc) into `base` (which the caller either allocated
 // per-descriptor or handed out from a shared pool). Sets buffer_alloc = base.
+// Bit increment offset of pixel (0, 0) from the start of the plane, rounded up for compressed planes so that the
+// pixel starts a byte
+static uint32_t bit_inc_origin(const EbPictureBufferDesc* pic_buf, uint32_t offset) {
+    return pic_buf->compressed_2b ? (offset + 3) / 4 : offset;
+}
+
 static void svt_pic_buf_desc_assign(EbPictureBufferDesc* pic_buf, const EbPictureBufferDescInitData* d, uint8_t* base,
                                     const uint32_t buffer_size[3], const uint32_t buffer_bit_inc_size[3],
                                     uint32_t bytes_per_pixel) {
@@ -291,7 +344,8 @@ static void svt_pic_buf_desc_assign(EbPictureBufferDesc* pic_buf, const EbPictur
         pic_buf->y_buffer_bit_inc = NULL;
         if (d->split_mode) {
             pic_buf->y_buffer_bit_inc = base + assigned_space +
-                (pic_buf->border + (pic_buf->y_stride_bit_inc * pic_buf->border)) * bytes_per_pixel;
+                bit_inc_origin(pic_buf, pic_buf->border + (pic_buf->y_stride_bit_inc * pic_buf->border)) *
+                    bytes_per_pixel;
             assigned_space += buffer_bit_inc_size[0];
         }
     }
@@ -302,7 +356,9 @@ static void svt_pic_buf_desc_assign(EbPictureBufferDesc* pic_buf, const EbPictur
         pic_buf->u_buffer_bit_inc = NULL;
         if (d->split_mode) {
             pic_buf->u_buffer_bit_inc = base + assigned_space +
-                ((pic_buf->border >> ss_x) + (pic_buf->u_stride_bit_inc * (pic_buf->border >> ss_y))) * bytes_per_pixel;
+                bit_inc_origin(pic_buf,
+                               (pic_buf->border >> ss_x) + (pic_buf->u_stride_bit_inc * (pic_buf->border >> ss_y))) *
+                    bytes_per_pixel;
             assigned_space += buffer_bit_inc_size[1];
         }
     }
@@ -313,7 +369,9 @@ static void svt_pic_buf_desc_assign(EbPictureBufferDesc* pic_buf, const EbPictur
         pic_buf->v_buffer_bit_inc = NULL;
         if (d->split_mode) {
             pic_buf->v_buffer_bit_inc = base + assigned_space +
-                ((pic_buf->border >> ss_x) + (pic_buf->v_stride_bit_inc * (pic_buf->border >> ss_y))) * bytes_per_pixel;
+                bit_inc_origin(pic_buf,
+                               (pic_buf->border >> ss_x) + (pic_buf->v_stride_bit_inc * (pic_buf->border >> ss_y))) *
+                    bytes_per_pixel;
             assigned_space += buffer_bit_inc_size[2];
         }
     }
@@ -333,7 +391,11 @@ EbErrorType svt_picture_buffer_desc_ctor(EbPictureBufferDesc* pic_buf, const EbP
 
     // Allocate the Picture Buffers (luma & chroma)
     if (alloc_sz) {
-        EB_MALLOC_ALIGNED_ARRAY(pic_buf->buffer_alloc, alloc_sz);
+        EbErrorType err = pic_buf_alloc_backing(
+            &pic_buf->buffer_alloc, &pic_buf->buffer_pages, alloc_sz, pic_buf_init_data->buffer_enable_mask, false);
+        if (err != EB_ErrorNone) {
+            return err;
+        }
     } else {
         pic_buf->buffer_alloc = NULL;
     }
@@ -344,15 +406,22 @@ EbErrorType svt_picture_buffer_desc_ctor(EbPictureBufferDesc* pic_buf, const EbP
     return EB_ErrorNone;
 }
 
+EbErrorType svt_picture_buffer_desc_ctor_compressed_2b(EbPictureBufferDesc* pic_buf, const EbPtr object_init_data_ptr) {
+    pic_buf->compressed_2b = true;
+    return svt_picture_buffer_desc_ctor(pic_buf, object_init_data_ptr);
+}
+
 // ---- Picture-buffer pool ----
 // `count` EbPictureBufferDesc descriptors backed by ONE aligned buffer, sliced by
 // ALVALUE-aligned offset (borrowed; each desc's dctor stays NULL). The pool owns/frees
 // the backing and the descriptor array.
 static EbErrorType svt_pic_buf_desc_pool_build(SvtPicBufDescPool* pool, const EbPictureBufferDescInitData* base_id,
                                                size_t stride, uint32_t count) {
-    pool->count   = count;
-    pool->backing = NULL;
-    pool->descs   = NULL;
+    pool->count         = count;
+    pool->backing       = NULL;
+    pool->backing_size  = 0;
+    pool->backing_pages = SVT_PAGES_HEAP;
+    pool->descs         = NULL;
     if (count == 0) {
         return EB_ErrorNone;
     }
@@ -366,7 +435,15 @@ static EbErrorType svt_pic_buf_desc_pool_build(SvtPicBufDescPool* pool, const Eb
         uint32_t                           sz = svt_pic_buf_desc_calc(&pool->descs[i], d, bs, bbi, &bpp);
         total += (uint64_t)((sz + (ALVALUE - 1)) & ~(uint32_t)(ALVALUE - 1));
     }
-    EB_MALLOC_ALIGNED_ARRAY(pool->backing, total);
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        mask |= ((const EbPictureBufferDescInitData*)((const char*)base_id + (size_t)i * stride))->buffer_enable_mask;
+    }
+    EbErrorType err = pic_buf_alloc_backing(&pool->backing, &pool->backing_pages, total, mask, false);
+    if (err != EB_ErrorNone) {
+        return err;
+    }
+    pool->backing_size = total;
 
     uint64_t offset = 0;
     for (uint32_t i = 0; i < count; ++i) {
@@ -396,14 +473,14 @@ void svt_aom_pic_buf_desc_pool_dctor(SvtPicBufDescPool* pool) {
     if (!pool) {
         return;
     }
-    EB_FREE_ALIGNED_ARRAY(pool->backing);
+    pic_buf_free_backing(&pool->backing, pool->backing_pages, pool->backing_size);
     EB_FREE_ARRAY(pool->descs);
     pool->count = 0;
 }
 
 static void svt_recon_picture_buffer_desc_dctor(EbPtr p) {
     EbPictureBufferDesc* obj = (EbPictureBufferDesc*)p;
-    EB_FREE_ALIGNED_ARRAY(obj->buffer_alloc);
+    pic_buf_free_backing(&obj->buffer_alloc, obj->buffer_pages, obj->buffer_alloc_sz);
     obj->buffer_alloc_sz = 0;
     obj->y_buffer        = NULL;
     obj->u_buffer        = NULL;
@@ -490,7 +567,11 @@ EbErrorType svt_recon_picture_buffer_desc_ctor(EbPictureBufferDesc* pic_buf, EbP
     }
 
     // Allocate the Picture Buffers (luma & chroma)
-    EB_CALLOC_ALIGNED_ARRAY(pic_buf->buffer_alloc, alloc_sz);
+    EbErrorType err = pic_buf_alloc_backing(
+        &pic_buf->buffer_alloc, &pic_buf->buffer_pages, alloc_sz, pic_buf_init_data->buffer_enable_mask, true);
+    if (err != EB_ErrorNone) {
+        return err;
+    }
     pic_buf->buffer_alloc_sz = alloc_sz;
     uint32_t assigned_space  = 0;
     if (pic_buf_init_data->buffer_enable_mask & PICTURE_BUFFER_DESC_Y_FLAG) {
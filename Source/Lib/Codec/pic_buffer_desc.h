@@ -27,6 +27,10 @@ extern "C" {
 #define PICTURE_BUFFER_DESC_CHROMA_MASK (PICTURE_BUFFER_DESC_Cb_FLAG | PICTURE_BUFFER_DESC_Cr_FLAG)
 #define PICTURE_BUFFER_DESC_FULL_MASK \
     (PICTURE_BUFFER_DESC_Y_FLAG | PICTURE_BUFFER_DESC_Cb_FLAG | PICTURE_BUFFER_DESC_Cr_FLAG)
+// Allocation hints, ignored by the plane checks: back the planes with huge
+// pages when the system has them, from the hugetlbfs pool first with HUGETLB
+#define PICTURE_BUFFER_DESC_HUGE_PAGES_FLAG (1 << 3)
+#define PICTURE_BUFFER_DESC_HUGETLB_FLAG (1 << 4)
 
 /************************************
      * EbPictureBufferDesc
@@ -84,9 +88,13 @@ typedef struct EbPictureBufferDesc {
     // Save the pointer to the actual allocated memory, to use for copies and freeing
     uint8_t* buffer_alloc;
     size_t   buffer_alloc_sz;
+    uint8_t  buffer_pages; // SvtPageKind of buffer_alloc
     uint32_t luma_size; // Allocated size of the luma buffer
     uint32_t chroma_size; // Allocated size of the chroma buffers
     bool     packed_flag; // Indicates if sample buffers are packed or not
+    // The bit increment buffers hold 4 pixels per byte, bits 7:6 first: pixel (x, y) is in byte
+    // y * stride_bit_inc / 4 + floor(x / 4) from buffer_bit_inc. Strides stay in pixels.
+    bool compressed_2b;
 
     // Picture Parameters
     uint16_t      border; // Padding applied to top/left/right/bottom of picture (luma dimensions)
@@ -252,11 +260,18 @@ typedef struct EbPictureBufferDescInitData {
 
 EbErrorType svt_picture_buffer_desc_ctor_noy8b(EbPictureBufferDesc* object_ptr, const EbPtr object_init_data_ptr);
 EbErrorType svt_picture_buffer_desc_ctor(EbPictureBufferDesc* object_ptr, const EbPtr object_init_data_ptr);
+// svt_picture_buffer_desc_ctor() with the bit increment buffers of a split picture compressed
+EbErrorType svt_picture_buffer_desc_ctor_compressed_2b(EbPictureBufferDesc* object_ptr,
+                                                       const EbPtr          object_init_data_ptr);
 
 EbErrorType svt_recon_picture_buffer_desc_ctor(EbPictureBufferDesc* object_ptr, EbPtr object_init_data_ptr);
 EbErrorType svt_picture_buffer_desc_noy8b_update(EbPictureBufferDesc* object_ptr, const EbPtr object_init_data_ptr);
 EbErrorType svt_picture_buffer_desc_update(EbPictureBufferDesc* pictureBufferDescPtr, const EbPtr object_init_data_ptr);
 EbErrorType svt_recon_picture_buffer_desc_update(EbPictureBufferDesc* object_ptr, EbPtr object_init_data_ptr);
+// Free the planes allocated by the ctors, for owners that release them early
+void svt_picture_buffer_desc_free(EbPictureBufferDesc* pic_buf);
+// buffer_enable_mask bits for the huge_pages setting of the configuration
+uint32_t svt_aom_huge_page_mask(uint8_t huge_pages);
 
 // Pooled picture-buffer pool: `count` descriptors backed by ONE aligned allocation,
 // sliced by (ALVALUE-aligned) offset. Replaces `count` separate EbPictureBufferDesc
@@ -264,6 +279,8 @@ EbErrorType svt_recon_picture_buffer_desc_update(EbPictureBufferDesc* object_ptr
 // its buffer_alloc from `backing` (dctor NULL); the pool owns/frees backing + descs.
 typedef struct SvtPicBufDescPool {
     uint8_t*             backing; // single aligned backing buffer for all descriptors
+    size_t               backing_size;
+    uint8_t              backing_pages; // SvtPageKind of backing
     EbPictureBufferDesc* descs; // contiguous array of `count` descriptors
     uint32_t             count;
 } SvtPicBufDescPool;
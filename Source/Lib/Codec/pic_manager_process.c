@@ -50,7 +50,7 @@ static EbErrorType rtime_alloc_palette_tokens(SequenceControlSet* scs, PictureCo
             uint32_t     mb_cols = (mi_cols + 2) >> 2;
             uint32_t     mb_rows = (mi_rows + 2) >> 2;
             unsigned int tokens  = get_token_alloc(mb_rows, mb_cols, MAX_SB_SIZE_LOG2, 2);
-            EB_CALLOC_ARRAY(child_pcs->tile_tok[0][0], tokens);
+            EB_ARENA_CALLOC_ARRAY(&child_pcs->arena, child_pcs->tile_tok[0][0], tokens);
         } else {
             child_pcs->tile_tok[0][0] = NULL;
         }
@@ -649,6 +649,7 @@ EbErrorType svt_aom_picture_manager_kernel_iter(void* context) {
         PictureControlSet* child_pcs = (PictureControlSet*)child_pcs_wrapper->object_ptr;
 
         child_pcs->c_pcs_wrapper_ptr = child_pcs_wrapper;
+        svt_arena_reset(&child_pcs->arena);
 
         // 1.Link The Child PCS to its Parent
         child_pcs->ppcs_wrapper = input_entry->input_object_ptr;
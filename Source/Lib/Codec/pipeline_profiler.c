@@ -0,0 +1,180 @@
+/*
+* Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pipeline_profiler.h"
+#include "sys_resource_manager.h"
+#include "svt_malloc.h"
+#include "svt_time.h"
+#include "utility.h"
+
+// Upper bound of one rendered trace event
+#define PROFILE_TRACE_EVENT_SIZE 160
+
+static uint64_t profiler_now_us(void) {
+    uint64_t seconds, useconds;
+    svt_av1_get_time(&seconds, &useconds);
+    return seconds * 1000000 + useconds;
+}
+
+static uint32_t profile_depth_bin(uint32_t depth) {
+    uint32_t bin = 0;
+    while (depth && bin < SVT_AV1_PROFILE_DEPTH_BINS - 1) {
+        depth >>= 1;
+        bin++;
+    }
+    return bin;
+}
+
+void svt_kernel_profile_begin_wait(SvtKernelProfile* profile, uint32_t depth) {
+    const uint64_t now = profiler_now_us();
+    if (profile->busy_start_us) {
+        const uint64_t dur = now - profile->busy_start_us;
+        profile->busy_us += dur;
+        if (profile->spans) {
+            SvtProfileSpan* span = &profile->spans[profile->span_count % SVT_PROFILE_TRACE_SPANS];
+            span->start_us       = profile->busy_start_us;
+            span->dur_us         = dur;
+            profile->span_count++;
+        }
+        profile->busy_start_us = 0;
+    }
+    profile->depth_histogram[profile_depth_bin(depth)]++;
+    profile->max_depth     = MAX(profile->max_depth, depth);
+    profile->wait_start_us = now;
+}
+
+void svt_kernel_profile_end_wait(SvtKernelProfile* profile, bool got_object) {
+    const uint64_t now = profiler_now_us();
+    profile->wait_us += now - profile->wait_start_us;
+    if (got_object) {
+        profile->objects++;
+        profile->busy_start_us = now;
+    }
+}
+
+static void svt_pipeline_profiler_dctor(EbPtr p) {
+    SvtPipelineProfiler* profiler = (SvtPipelineProfiler*)p;
+    for (uint32_t s = 0; s < profiler->stage_count; s++) {
+        SvtStageProfiler* stage = &profiler->stages[s];
+        for (uint32_t k = 0; k < stage->kernel_count; k++) {
+            EB_FREE_ARRAY(stage->kernels[k].spans);
+        }
+        EB_FREE_ARRAY(stage->kernels);
+    }
+    EB_FREE_ARRAY(profiler->trace_json);
+}
+
+EbErrorType svt_pipeline_profiler_ctor(SvtPipelineProfiler* profiler, bool trace) {
+    profiler->dctor    = svt_pipeline_profiler_dctor;
+    profiler->trace    = trace;
+    profiler->start_us = profiler_now_us();
+    return EB_ErrorNone;
+}
+
+EbErrorType svt_pipeline_profiler_add_stage(SvtPipelineProfiler* profiler, const char* name,
+                                            EbSystemResource* input_resource) {
+    if (profiler->stage_count >= SVT_AV1_PROFILE_MAX_STAGES) {
+        return EB_ErrorInsufficientResources;
+    }
+    SvtStageProfiler* stage = &profiler->stages[profiler->stage_count++];
+    stage->name             = name;
+    stage->kernel_count     = input_resource->full_queue->process_total_count;
+    EB_CALLOC_ARRAY(stage->kernels, stage->kernel_count);
+    for (uint32_t k = 0; k < stage->kernel_count; k++) {
+        if (profiler->trace) {
+            EB_MALLOC_ARRAY(stage->kernels[k].spans, SVT_PROFILE_TRACE_SPANS);
+        }
+        svt_fifo_attach_profile(svt_system_resource_get_consumer_fifo(input_resource, k), &stage->kernels[k]);
+    }
+    return EB_ErrorNone;
+}
+
+void svt_pipeline_profiler_get(const SvtPipelineProfiler* profiler, SvtAv1PipelineProfile* out) {
+    memset(out, 0, sizeof(*out));
+    out->stage_count = profiler->stage_count;
+    for (uint32_t s = 0; s < profiler->stage_count; s++) {
+        const SvtStageProfiler* stage = &profiler->stages[s];
+        SvtAv1StageProfile*     dst   = &out->stages[s];
+        dst->name                     = stage->name;
+        dst->threads                  = stage->kernel_count;
+        for (uint32_t k = 0; k < stage->kernel_count; k++) {
+            const SvtKernelProfile* kernel = &stage->kernels[k];
+            dst->busy_us += kernel->busy_us;
+            dst->wait_us += kernel->wait_us;
+            dst->objects += kernel->objects;
+            dst->max_queue_depth = MAX(dst->max_queue_depth, kernel->max_depth);
+            for (uint32_t b = 0; b < SVT_AV1_PROFILE_DEPTH_BINS; b++) {
+                dst->queue_depth_histogram[b] += kernel->depth_histogram[b];
+            }
+        }
+    }
+}
+
+EbErrorType svt_pipeline_profiler_get_trace(SvtPipelineProfiler* profiler, SvtAv1FixedBuf* out) {
+    if (!profiler->trace) {
+        return EB_ErrorBadParameter;
+    }
+    // One thread-name record per kernel instance plus the retained spans. The
+    // kernels keep recording while this runs, so spans past the size taken
+    // here are dropped.
+    uint32_t kernels = 0;
+    size_t   events  = 0;
+    for (uint32_t s = 0; s < profiler->stage_count; s++) {
+        const SvtStageProfiler* stage = &profiler->stages[s];
+        for (uint32_t k = 0; k < stage->kernel_count; k++) {
+            events += 1 + MIN(stage->kernels[k].span_count, SVT_PROFILE_TRACE_SPANS);
+        }
+        kernels += stage->kernel_count;
+    }
+    const size_t capacity = (events + 1) * PROFILE_TRACE_EVENT_SIZE;
+    EB_FREE_ARRAY(profiler->trace_json);
+    EB_MALLOC_ARRAY(profiler->trace_json, capacity);
+
+    char*    json = profiler->trace_json;
+    size_t   size = snprintf(json, capacity, "{\"traceEvents\":[");
+    uint32_t tid  = 0;
+    for (uint32_t s = 0; s < profiler->stage_count; s++) {
+        const SvtStageProfiler* stage = &profiler->stages[s];
+        for (uint32_t k = 0; k < stage->kernel_count; k++, tid++) {
+            const SvtKernelProfile* kernel = &stage->kernels[k];
+            size += snprintf(json + size,
+                             capacity - size,
+                             "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                             "\"args\":{\"name\":\"%s %u\"}}",
+                             tid ? "," : "",
+                             tid,
+                             stage->name,
+                             k);
+            // Oldest retained span first
+            const uint64_t count = kernel->span_count;
+            const uint64_t first = count > SVT_PROFILE_TRACE_SPANS ? count - SVT_PROFILE_TRACE_SPANS : 0;
+            // Keep room for this span, the thread names left and the closing bracket
+            const size_t limit = capacity - (size_t)(kernels - tid + 1) * PROFILE_TRACE_EVENT_SIZE;
+            for (uint64_t i = first; i < count && size <= limit; i++) {
+                const SvtProfileSpan* span = &kernel->spans[i % SVT_PROFILE_TRACE_SPANS];
+                size += snprintf(json + size,
+                                 capacity - size,
+                                 ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu,\"dur\":%llu}",
+                                 stage->name,
+                                 tid,
+                                 (unsigned long long)(span->start_us - profiler->start_us),
+                                 (unsigned long long)span->dur_us);
+            }
+        }
+    }
+    size += snprintf(json + size, capacity - size, "\n]}\n");
+    out->buf = profiler->trace_json;
+    out->sz  = size;
+    return EB_ErrorNone;
+}
@@ -0,0 +1,87 @@
+/*
+* Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbPipelineProfiler_h
+#define EbPipelineProfiler_h
+
+#include "EbSvtAv1Enc.h"
+#include "definitions.h"
+#include "object.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct EbSystemResource;
+
+// Busy spans kept per kernel instance for the trace; older spans are overwritten
+#define SVT_PROFILE_TRACE_SPANS 8192
+
+typedef struct SvtProfileSpan {
+    uint64_t start_us;
+    uint64_t dur_us;
+} SvtProfileSpan;
+
+/**************************************
+ * Counters of one kernel instance. Only the thread running the instance
+ * writes them, from svt_get_full_object() on its input FIFO: the time
+ * between two calls is busy, the time inside a call is wait.
+ **************************************/
+typedef struct SvtKernelProfile {
+    uint64_t        busy_us;
+    uint64_t        wait_us;
+    uint64_t        objects;
+    uint64_t        depth_histogram[SVT_AV1_PROFILE_DEPTH_BINS];
+    uint32_t        max_depth;
+    uint64_t        wait_start_us;
+    uint64_t        busy_start_us; // 0 while no object is held
+    SvtProfileSpan* spans; // NULL unless tracing
+    uint64_t        span_count;
+} SvtKernelProfile;
+
+typedef struct SvtStageProfiler {
+    const char*       name;
+    uint32_t          kernel_count;
+    SvtKernelProfile* kernels;
+} SvtStageProfiler;
+
+typedef struct SvtPipelineProfiler {
+    EbDctor          dctor;
+    bool             trace;
+    uint64_t         start_us; // time origin of the trace
+    uint32_t         stage_count;
+    SvtStageProfiler stages[SVT_AV1_PROFILE_MAX_STAGES];
+    char*            trace_json;
+} SvtPipelineProfiler;
+
+EbErrorType svt_pipeline_profiler_ctor(SvtPipelineProfiler* profiler, bool trace);
+
+// Profile every consumer of input_resource, the input of the named stage.
+// Must be called before any kernel thread uses the resource.
+EbErrorType svt_pipeline_profiler_add_stage(SvtPipelineProfiler* profiler, const char* name,
+                                            struct EbSystemResource* input_resource);
+
+// Sum the counters of each stage. Safe while the encoder runs; the counters
+// of a running kernel may be one object apart.
+void svt_pipeline_profiler_get(const SvtPipelineProfiler* profiler, SvtAv1PipelineProfile* out);
+
+// Render the recorded busy spans as Chrome trace JSON (chrome://tracing,
+// Perfetto). The buffer is owned by the profiler and valid until the next
+// call or the destruction of the profiler.
+EbErrorType svt_pipeline_profiler_get_trace(SvtPipelineProfiler* profiler, SvtAv1FixedBuf* out);
+
+void svt_kernel_profile_begin_wait(SvtKernelProfile* profile, uint32_t depth);
+void svt_kernel_profile_end_wait(SvtKernelProfile* profile, bool got_object);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbPipelineProfiler_h
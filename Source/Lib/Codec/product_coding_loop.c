@@ -6106,14 +6106,15 @@ static COMPONENT_TYPE chroma_complexity_check(PictureControlSet* pcs, ModeDecisi
             // pack the reference into temp 16bit buffer
             int32_t stride;
 
-            svt_aom_pack_block(ref_pic->y_buffer + src_y_offset,
-                               ref_pic->y_stride << shift,
-                               ref_pic->y_buffer_bit_inc + src_y_offset,
-                               ref_pic->y_stride_bit_inc << shift,
-                               (uint16_t*)packed_buf,
-                               MAX_SB_SIZE,
-                               ctx->blk_geom->bwidth_uv,
-                               ctx->blk_geom->bheight_uv >> shift);
+            svt_aom_pack_ref_block(ref_pic->y_buffer,
+                                   ref_pic->y_buffer_bit_inc,
+                                   ref_pic->compressed_2b,
+                                   ref_pic->y_stride << shift,
+                                   src_y_offset,
+                                   (uint16_t*)packed_buf,
+                                   MAX_SB_SIZE,
+                                   ctx->blk_geom->bwidth_uv,
+                                   ctx->blk_geom->bheight_uv >> shift);
 
             src_10b = (uint16_t*)packed_buf;
             stride  = MAX_SB_SIZE;
@@ -6128,14 +6129,15 @@ static COMPONENT_TYPE chroma_complexity_check(PictureControlSet* pcs, ModeDecisi
 
             // pack the reference into temp 16bit buffer
 
-            svt_aom_pack_block(ref_pic->u_buffer + src_cb_offset,
-                               ref_pic->u_stride << shift,
-                               ref_pic->u_buffer_bit_inc + src_cb_offset,
-                               ref_pic->u_stride_bit_inc << shift,
-                               (uint16_t*)packed_buf,
-                               MAX_SB_SIZE,
-                               ctx->blk_geom->bwidth_uv,
-                               ctx->blk_geom->bheight_uv >> shift);
+            svt_aom_pack_ref_block(ref_pic->u_buffer,
+                                   ref_pic->u_buffer_bit_inc,
+                                   ref_pic->compressed_2b,
+                                   ref_pic->u_stride << shift,
+                                   src_cb_offset,
+                                   (uint16_t*)packed_buf,
+                                   MAX_SB_SIZE,
+                                   ctx->blk_geom->bwidth_uv,
+                                   ctx->blk_geom->bheight_uv >> shift);
 
             src_10b = (uint16_t*)packed_buf;
             stride  = MAX_SB_SIZE;
@@ -6148,14 +6150,15 @@ static COMPONENT_TYPE chroma_complexity_check(PictureControlSet* pcs, ModeDecisi
                                      ctx->blk_geom->bwidth_uv);
 
             // pack the reference into temp 16bit buffer
-            svt_aom_pack_block(ref_pic->v_buffer + src_cr_offset,
-                               ref_pic->v_stride << shift,
-                               ref_pic->v_buffer_bit_inc + src_cr_offset,
-                               ref_pic->v_stride_bit_inc << shift,
-                               (uint16_t*)packed_buf,
-                               MAX_SB_SIZE,
-                               ctx->blk_geom->bwidth_uv,
-                               ctx->blk_geom->bheight_uv >> shift);
+            svt_aom_pack_ref_block(ref_pic->v_buffer,
+                                   ref_pic->v_buffer_bit_inc,
+                                   ref_pic->compressed_2b,
+                                   ref_pic->v_stride << shift,
+                                   src_cr_offset,
+                                   (uint16_t*)packed_buf,
+                                   MAX_SB_SIZE,
+                                   ctx->blk_geom->bwidth_uv,
+                                   ctx->blk_geom->bheight_uv >> shift);
 
             src_10b = (uint16_t*)packed_buf;
             stride  = MAX_SB_SIZE;
@@ -8780,6 +8783,9 @@ static void convert_md_recon_16bit_to_8bit(PictureControlSet* pcs, ModeDecisionC
         pred_buf_y_offest_16bit_uv = 0;
     }
 
+    // The 2 bits of compact references are written with the padding, in pad_ref_and_set_flags()
+    const bool write_nbit = recon_buffer_8bit->y_buffer_bit_inc && !recon_buffer_8bit->compressed_2b;
+
     // Y
     uint16_t* dst_16bit = (uint16_t*)(recon_buffer_16bit->y_buffer) + pred_buf_x_offest_16bit +
         (pred_buf_y_offest_16bit)*recon_buffer_16bit->y_stride;
@@ -8792,9 +8798,9 @@ static void convert_md_recon_16bit_to_8bit(PictureControlSet* pcs, ModeDecisionC
     dst = recon_buffer_8bit->y_buffer + pred_buf_x_offest_8bit + (pred_buf_y_offest_8bit)*recon_buffer_8bit->y_stride;
     dst_stride = recon_buffer_8bit->y_stride;
 
-    uint8_t* dst_nbit        = recon_buffer_8bit->y_buffer_bit_inc ? recon_buffer_8bit->y_buffer_bit_inc +
-            pred_buf_x_offest_8bit + (pred_buf_y_offest_8bit)*recon_buffer_8bit->y_stride
-                                                                   : recon_buffer_8bit->y_buffer_bit_inc;
+    uint8_t* dst_nbit        = write_nbit ? recon_buffer_8bit->y_buffer_bit_inc + pred_buf_x_offest_8bit +
+            (pred_buf_y_offest_8bit)*recon_buffer_8bit->y_stride
+                                          : NULL;
     int32_t  dst_nbit_stride = recon_buffer_8bit->y_stride_bit_inc;
 
     svt_aom_un_pack2d(dst_16bit,
@@ -8814,9 +8820,9 @@ static void convert_md_recon_16bit_to_8bit(PictureControlSet* pcs, ModeDecisionC
         (pred_buf_y_offest_8bit_uv)*recon_buffer_8bit->u_stride;
     dst_stride = recon_buffer_8bit->u_stride;
 
-    dst_nbit = recon_buffer_8bit->u_buffer_bit_inc ? recon_buffer_8bit->u_buffer_bit_inc + pred_buf_x_offest_8bit_uv +
+    dst_nbit = write_nbit ? recon_buffer_8bit->u_buffer_bit_inc + pred_buf_x_offest_8bit_uv +
             (pred_buf_y_offest_8bit_uv)*recon_buffer_8bit->u_stride
-                                                   : recon_buffer_8bit->u_buffer_bit_inc;
+                          : NULL;
     dst_nbit_stride = recon_buffer_8bit->u_stride_bit_inc;
 
     svt_aom_un_pack2d(dst_16bit,
@@ -8837,9 +8843,9 @@ static void convert_md_recon_16bit_to_8bit(PictureControlSet* pcs, ModeDecisionC
         (pred_buf_y_offest_8bit_uv)*recon_buffer_8bit->v_stride;
     dst_stride = recon_buffer_8bit->v_stride;
 
-    dst_nbit = recon_buffer_8bit->v_buffer_bit_inc ? recon_buffer_8bit->v_buffer_bit_inc + pred_buf_x_offest_8bit_uv +
+    dst_nbit = write_nbit ? recon_buffer_8bit->v_buffer_bit_inc + pred_buf_x_offest_8bit_uv +
             (pred_buf_y_offest_8bit_uv)*recon_buffer_8bit->v_stride
-                                                   : recon_buffer_8bit->v_buffer_bit_inc;
+                          : NULL;
     dst_nbit_stride = recon_buffer_8bit->v_stride_bit_inc;
 
     svt_aom_un_pack2d(dst_16bit,
@@ -833,6 +833,7 @@ EbErrorType svt_aom_rate_control_kernel_iter(void* context) {
         pcs  = (PictureControlSet*)rc_tasks->pcs_wrapper->object_ptr;
         ppcs = pcs->ppcs;
         scs  = pcs->scs;
+        svt_aom_stamp_frame_stage(ppcs, SVT_AV1_FRAME_STAGE_RC);
 
         // A superres recode task is only generated for the modes that run the
         // recode loop. Checked here (not in the RC_INPUT_SUPERRES_RECODE label)
@@ -142,9 +142,15 @@ EbErrorType svt_reference_object_ctor(EbReferenceObject* ref_object, EbPtr objec
         // Use 10bit here to use in MD
         picture_buffer_desc_init_data_16bit_ptr.split_mode = true;
         picture_buffer_desc_init_data_16bit_ptr.bit_depth  = EB_TEN_BIT;
-        EB_NEW(ref_object->reference_picture,
-               svt_picture_buffer_desc_ctor,
-               (EbPtr)&picture_buffer_desc_init_data_16bit_ptr);
+        if (ref_init_ptr->static_config->compact_refs) {
+            EB_NEW(ref_object->reference_picture,
+                   svt_picture_buffer_desc_ctor_compressed_2b,
+                   (EbPtr)&picture_buffer_desc_init_data_16bit_ptr);
+        } else {
+            EB_NEW(ref_object->reference_picture,
+                   svt_picture_buffer_desc_ctor,
+                   (EbPtr)&picture_buffer_desc_init_data_16bit_ptr);
+        }
     } else {
         // Hsan: set split_mode to 0 to as 8BIT input
         picture_buffer_desc_init_data_ptr->split_mode = false;
@@ -213,6 +219,8 @@ static void svt_pa_reference_object_dctor(EbPtr p) {
     if (obj->dummy_obj) {
         return;
     }
+    EB_FREE_ARRAY(obj->me_mv_field);
+    EB_FREE_ARRAY(obj->tf_mv);
     EB_DELETE(obj->input_padded_pic);
     EB_DELETE(obj->quarter_downsampled_picture_ptr);
     EB_DELETE(obj->sixteenth_downsampled_picture_ptr);
@@ -284,6 +292,15 @@ EbErrorType svt_pa_reference_param_update(EbPaReferenceObject* pa_ref_obj, Seque
     svt_picture_buffer_desc_update(pa_ref_obj->quarter_downsampled_picture_ptr, (EbPtr)&quart_pic_buf_desc_init_data);
     svt_picture_buffer_desc_update(pa_ref_obj->sixteenth_downsampled_picture_ptr,
                                    (EbPtr)&sixteenth_pic_buf_desc_init_data);
+    const uint32_t b64_count = ((scs->max_input_luma_width + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64) *
+        ((scs->max_input_luma_height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64);
+    if (b64_count > pa_ref_obj->me_mv_field_size) {
+        EB_FREE_ARRAY(pa_ref_obj->me_mv_field);
+        EB_FREE_ARRAY(pa_ref_obj->tf_mv);
+        EB_MALLOC_ARRAY(pa_ref_obj->me_mv_field, b64_count);
+        EB_MALLOC_ARRAY(pa_ref_obj->tf_mv, TF_MV_SLOTS * b64_count);
+        pa_ref_obj->me_mv_field_size = b64_count;
+    }
     return EB_ErrorNone;
 }
 
@@ -328,6 +345,12 @@ EbErrorType svt_pa_reference_object_ctor(EbPaReferenceObject* pa_ref_obj_, EbPtr
             }
         }
     }
+    pa_ref_obj_->me_mv_field_size = ((picture_buffer_desc_init_data_ptr->max_width + BLOCK_SIZE_64 - 1) /
+                                     BLOCK_SIZE_64) *
+        ((picture_buffer_desc_init_data_ptr->max_height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64);
+    EB_MALLOC_ARRAY(pa_ref_obj_->me_mv_field, pa_ref_obj_->me_mv_field_size);
+    EB_MALLOC_ARRAY(pa_ref_obj_->tf_mv, TF_MV_SLOTS * pa_ref_obj_->me_mv_field_size);
+    svt_create_cond_var(&pa_ref_obj_->me_mv_field_ready);
 
     return EB_ErrorNone;
 }
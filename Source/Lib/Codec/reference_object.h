@@ -68,6 +68,10 @@ typedef struct EbReferenceObjectDescInitData {
     EbSvtAv1EncConfiguration*   static_config;
 } EbReferenceObjectDescInitData;
 
+// Number of TF neighbours on each side of a picture whose HME centres are kept
+#define TF_MV_SIDE 2
+#define TF_MV_SLOTS (2 * TF_MV_SIDE)
+
 typedef struct EbPaReferenceObject {
     EbDctor              dctor;
     EbPictureBufferDesc* input_padded_pic;
@@ -84,8 +88,30 @@ typedef struct EbPaReferenceObject {
     uint64_t picture_number;
     uint64_t avg_luma;
     uint8_t  dummy_obj;
+    // Open-loop 64x64 vector of each B64 against the nearest list 0 reference, for the motion field projection
+    // of the pictures that reference this one. me_mv_field_ready is set once open-loop ME of the picture is done;
+    // me_mv_field_dist is 0 when the picture has no field.
+    Mv*      me_mv_field;
+    uint32_t me_mv_field_size; // in B64s
+    uint16_t me_mv_field_cols;
+    uint16_t me_mv_field_rows;
+    int16_t  me_mv_field_dist; // reference picture number minus picture number
+    CondVar  me_mv_field_ready;
+    // HME centre of each B64 found by TF against the neighbours within TF_MV_SIDE pictures, one me_mv_field_size
+    // slot per neighbour (see tf_mv_slot()). A slot is keyed by the picture number of the neighbour, ~0 when unused.
+    // The keys are set before TF starts, and TF is done before the ME of any picture that reads them.
+    Mv*      tf_mv;
+    uint64_t tf_mv_picture_number[TF_MV_SLOTS];
 } EbPaReferenceObject;
 
+// Slot of tf_mv[] for the neighbour at dist (neighbour picture number minus picture number), -1 when none
+static INLINE int32_t tf_mv_slot(int64_t dist) {
+    if (dist < -TF_MV_SIDE || dist > TF_MV_SIDE || dist == 0) {
+        return -1;
+    }
+    return dist < 0 ? (int32_t)(-dist - 1) : (int32_t)(TF_MV_SIDE + dist - 1);
+}
+
 typedef struct EbPaReferenceObjectDescInitData {
     EbPictureBufferDescInitData reference_picture_desc_init_data;
     EbPictureBufferDescInitData quarter_picture_desc_init_data;
@@ -792,6 +792,27 @@ static void pack_highbd_pic_2d(const EbPictureBufferDesc* pic_ptr, uint16_t* buf
                                uint32_t ss_y) {
     uint16_t width  = pic_ptr->y_stride;
     uint16_t height = (uint16_t)(pic_ptr->height + (2 * pic_ptr->border));
+    if (pic_ptr->compressed_2b) {
+        for (int plane = 0; plane < 3; plane++) {
+            if (!buffer_16bit[plane]) {
+                continue;
+            }
+            const uint32_t sx = plane ? ss_x : 0;
+            const uint32_t sy = plane ? ss_y : 0;
+            // Offset of the top left pixel of the padding
+            const int32_t pos = -(int32_t)((pic_ptr->border >> sx) + pic_ptr->stride[plane] * (pic_ptr->border >> sy));
+            svt_aom_pack_ref_block(pic_ptr->buffer[plane],
+                                   pic_ptr->buffer_bit_inc[plane],
+                                   true,
+                                   pic_ptr->stride[plane],
+                                   pos,
+                                   buffer_16bit[plane],
+                                   pic_ptr->stride[plane],
+                                   (width + sx) >> sx,
+                                   (height + sy) >> sy);
+        }
+        return;
+    }
     svt_aom_pack2d_src(pic_ptr->y_buffer - (pic_ptr->border + (pic_ptr->y_stride * pic_ptr->border)),
                        pic_ptr->y_stride,
                        pic_ptr->y_buffer_bit_inc - (pic_ptr->border) - (pic_ptr->y_stride_bit_inc * pic_ptr->border),
@@ -831,6 +852,27 @@ static void svt_aom_unpack_highbd_pic_2d(uint16_t* buffer_highbd[3], EbPictureBu
                                          uint32_t ss_y) {
     uint16_t width  = pic_ptr->y_stride;
     uint16_t height = (uint16_t)(pic_ptr->height + (2 * pic_ptr->border));
+    if (pic_ptr->compressed_2b) {
+        for (int plane = 0; plane < 3; plane++) {
+            if (!buffer_highbd[plane]) {
+                continue;
+            }
+            const uint32_t sx = plane ? ss_x : 0;
+            const uint32_t sy = plane ? ss_y : 0;
+            // Offset of the top left pixel of the padding
+            const int32_t pos = -(int32_t)((pic_ptr->border >> sx) + pic_ptr->stride[plane] * (pic_ptr->border >> sy));
+            svt_aom_unpack_ref_block(buffer_highbd[plane],
+                                     pic_ptr->stride[plane],
+                                     pic_ptr->buffer[plane],
+                                     pic_ptr->buffer_bit_inc[plane],
+                                     true,
+                                     pic_ptr->stride[plane],
+                                     pos,
+                                     (width + sx) >> sx,
+                                     (height + sy) >> sy);
+        }
+        return;
+    }
 
     svt_aom_un_pack2d(buffer_highbd[0],
                       pic_ptr->y_stride,
@@ -1542,7 +1584,14 @@ static EbErrorType allocate_downscaled_reference_pics(EbPictureBufferDesc**    d
         // Use 10bit here to use in MD
         ref_pic_buf_desc_init_data.split_mode = true;
         ref_pic_buf_desc_init_data.bit_depth  = EB_TEN_BIT;
-        EB_NEW(*downscaled_reference_picture_ptr, svt_picture_buffer_desc_ctor, (EbPtr)&ref_pic_buf_desc_init_data);
+        if (picture_ptr_for_reference->compressed_2b) {
+            EB_NEW(*downscaled_reference_picture_ptr,
+                   svt_picture_buffer_desc_ctor_compressed_2b,
+                   (EbPtr)&ref_pic_buf_desc_init_data);
+        } else {
+            EB_NEW(
+                *downscaled_reference_picture_ptr, svt_picture_buffer_desc_ctor, (EbPtr)&ref_pic_buf_desc_init_data);
+        }
     } else {
         // Hsan: set split_mode to 0 to as 8BIT input
         ref_pic_buf_desc_init_data.split_mode = false;
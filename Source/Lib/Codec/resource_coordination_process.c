@@ -880,6 +880,15 @@ static void update_frame_event(PictureParentControlSet* pcs, uint64_t pic_num) {
             SvtAv1ComputeQualityInfo* quality_info = (SvtAv1ComputeQualityInfo*)node->data;
             pcs->compute_psnr                      = pcs->compute_psnr || quality_info->compute_psnr;
             pcs->compute_ssim                      = pcs->compute_ssim || quality_info->compute_ssim;
+        } else if (node->node_type == FRAME_TIMING_EVENT) {
+            svt_aom_assert_err(node->size == sizeof(SvtAv1FrameTimingInfo) && node->data,
+                               "invalid private data of type FRAME_TIMING_EVENT");
+            pcs->record_timing = pcs->record_timing || ((SvtAv1FrameTimingInfo*)node->data)->record_timing;
+        } else if (node->node_type == ME_FIELD_EVENT) {
+            svt_aom_assert_err(node->size >= sizeof(SvtAv1MeField) && node->data,
+                               "invalid private data of type ME_FIELD_EVENT");
+            // Held by the private data list until rate control frees it, after motion estimation
+            pcs->me_field_in = (const SvtAv1MeField*)node->data;
         } else if (node->node_type == REF_STORE_EVENT || node->node_type == REF_CLEAR_EVENT ||
                    node->node_type == REF_USE_EVENT) {
             // Ref-frame management: STORE / CLEAR / USE all share the same
@@ -1225,7 +1234,13 @@ EbErrorType svt_aom_resource_coordination_kernel_iter(void* context) {
         pcs->rc_reset_flag        = false;
         pcs->compute_psnr         = scs->static_config.stat_report;
         pcs->compute_ssim         = scs->static_config.stat_report;
+        pcs->record_timing        = false;
+        pcs->me_field_in          = NULL;
         update_frame_event(pcs, context_ptr->picture_number);
+        if (pcs->record_timing) {
+            memset(pcs->stage_us, 0, sizeof(pcs->stage_us));
+            pcs->stage_us[SVT_AV1_FRAME_STAGE_INPUT] = pcs->start_time_seconds * 1000000 + pcs->start_time_u_seconds;
+        }
         pcs->is_not_scaled = (scs->static_config.superres_mode == SUPERRES_NONE) &&
             scs->static_config.resize_mode == RESIZE_NONE;
         if (loop_index == 1) {
@@ -1318,6 +1333,13 @@ EbErrorType svt_aom_resource_coordination_kernel_iter(void* context) {
         }
         EbPictureBufferDesc* input_padded_pic = (EbPictureBufferDesc*)pa_ref_obj->input_padded_pic;
         input_padded_pic->y_buffer            = buff_y8b;
+        // Published again once the open-loop ME of this picture is done
+        pa_ref_obj->me_mv_field_dist = 0;
+        svt_set_cond_var(&pa_ref_obj->me_mv_field_ready, 0);
+        // Keyed again by picture decision when this picture is temporally filtered
+        for (int i = 0; i < TF_MV_SLOTS; i++) {
+            pa_ref_obj->tf_mv_picture_number[i] = (uint64_t)~0;
+        }
         svt_object_inc_live_count(pcs->pa_ref_pic_wrapper, 1);
         if (pcs->y8b_wrapper) {
             // y8b follows longest life cycle of pa ref and input. so it needs to build on top of live count of pa ref
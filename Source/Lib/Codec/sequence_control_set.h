@@ -137,7 +137,7 @@ typedef struct SequenceControlSet {
     uint16_t picture_height_in_sb;
     uint16_t sb_total_count;
     uint16_t max_block_cnt;
-    // Pointer to block geometry table (owned by EbEncHandle)
+    // Pointer to block geometry table (owned by EbEncHandle, may be shared with clones)
     struct BlockGeom* blk_geom_mds;
     /*!< Restoration Unit parameters set for the stream */
     int32_t rest_units_per_tile;
@@ -170,6 +170,8 @@ typedef struct SequenceControlSet {
     uint32_t me_pool_init_count;
     uint32_t picture_control_set_pool_init_count_child;
     uint32_t enc_dec_pool_init_count;
+    // Ceiling on the child picture control sets set by max_memory_mb, 0 for none
+    uint32_t child_pool_cap;
     uint32_t pa_reference_picture_buffer_init_count;
     uint32_t tpl_reference_picture_buffer_init_count;
     /* ref_buffer_available_semaphore is needed so that all REF pictures
@@ -553,13 +553,13 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext* enc_ctx, SequenceCon
     uint8_t* predictor = predictor8;
 
     MacroblockPlane mb_plane;
-    mb_plane.quant_qtx       = scs->enc_ctx->quants_8bit.y_quant[qIndex];
-    mb_plane.quant_fp_qtx    = scs->enc_ctx->quants_8bit.y_quant_fp[qIndex];
-    mb_plane.round_fp_qtx    = scs->enc_ctx->quants_8bit.y_round_fp[qIndex];
-    mb_plane.quant_shift_qtx = scs->enc_ctx->quants_8bit.y_quant_shift[qIndex];
-    mb_plane.zbin_qtx        = scs->enc_ctx->quants_8bit.y_zbin[qIndex];
-    mb_plane.round_qtx       = scs->enc_ctx->quants_8bit.y_round[qIndex];
-    mb_plane.dequant_qtx     = scs->enc_ctx->deq_8bit.y_dequant_qtx[qIndex];
+    mb_plane.quant_qtx       = scs->enc_ctx->quants_8bit->y_quant[qIndex];
+    mb_plane.quant_fp_qtx    = scs->enc_ctx->quants_8bit->y_quant_fp[qIndex];
+    mb_plane.round_fp_qtx    = scs->enc_ctx->quants_8bit->y_round_fp[qIndex];
+    mb_plane.quant_shift_qtx = scs->enc_ctx->quants_8bit->y_quant_shift[qIndex];
+    mb_plane.zbin_qtx        = scs->enc_ctx->quants_8bit->y_zbin[qIndex];
+    mb_plane.round_qtx       = scs->enc_ctx->quants_8bit->y_round[qIndex];
+    mb_plane.dequant_qtx     = scs->enc_ctx->deq_8bit->y_dequant_qtx[qIndex];
 
     const uint32_t src_stride      = pcs->enhanced_pic->y_stride;
     B64Geom*       b64_geom        = &scs->b64_geom[sb_index];
@@ -815,6 +815,7 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext* enc_ctx, SequenceCon
                     svt_aom_enc_make_inter_predictor(scs,
                                                      ref_pic_ptr->y_buffer,
                                                      NULL, // src_ptr_2b,
+                                                     false, // compressed_2b
                                                      compensated_blk,
                                                      (int16_t)mb_origin_y,
                                                      (int16_t)mb_origin_x,
@@ -903,6 +904,7 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext* enc_ctx, SequenceCon
                         svt_aom_enc_make_inter_predictor(scs,
                                                          ref_pic_ptr->y_buffer,
                                                          NULL, // src_ptr_2b,
+                                                         false, // compressed_2b
                                                          compensated_blk,
                                                          (int16_t)mb_origin_y,
                                                          (int16_t)mb_origin_x,
@@ -1005,6 +1007,7 @@ static void tpl_mc_flow_dispenser_sb_generic(EncodeContext* enc_ctx, SequenceCon
                 svt_aom_enc_make_inter_predictor(scs,
                                                  ref_pic_ptr->y_buffer,
                                                  NULL, // src_ptr_2b,
+                                                 false, // compressed_2b
                                                  dst_buffer,
                                                  (int16_t)mb_origin_y,
                                                  (int16_t)mb_origin_x,
@@ -2007,6 +2010,7 @@ EbErrorType svt_aom_tpl_disp_kernel_iter(void* context) {
     in_results_ptr = (TplDispResults*)in_results_wrapper_ptr->object_ptr;
 
     PictureParentControlSet* pcs = in_results_ptr->pcs;
+    svt_aom_stamp_frame_stage(pcs, SVT_AV1_FRAME_STAGE_TPL);
 
     SequenceControlSet* scs = (SequenceControlSet*)pcs->scs;
 
@@ -0,0 +1,81 @@
+/*
+* Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include "svt_arena.h"
+#include "svt_malloc.h"
+#include "utility.h"
+
+// Smallest block, so that a few small buffers do not each take a block
+#define ARENA_MIN_BLOCK (64 * 1024)
+#define ARENA_ALIGN(x) (((x) + ALVALUE - 1) & ~(size_t)(ALVALUE - 1))
+
+typedef struct SvtArenaBlock {
+    struct SvtArenaBlock* next;
+    size_t                size; // usable bytes after the header
+    size_t                used;
+} SvtArenaBlock;
+
+#define ARENA_HEADER ARENA_ALIGN(sizeof(SvtArenaBlock))
+
+static EbErrorType arena_add_block(SvtArena* arena, size_t size) {
+    uint8_t* mem;
+    EB_MALLOC_ALIGNED(mem, ARENA_HEADER + size);
+    SvtArenaBlock* block = (SvtArenaBlock*)mem;
+    block->next          = arena->head;
+    block->size          = size;
+    block->used          = 0;
+    arena->head          = block;
+    return EB_ErrorNone;
+}
+
+void* svt_arena_alloc(SvtArena* arena, size_t size) {
+    size = ARENA_ALIGN(size);
+    if (!arena->head || arena->head->size - arena->head->used < size) {
+        // Double the blocks so that a picture larger than the last one needs few of them
+        size_t block_size = arena->head ? 2 * arena->head->size : MAX(arena->hint, ARENA_MIN_BLOCK);
+        if (arena_add_block(arena, MAX(block_size, size)) != EB_ErrorNone) {
+            return NULL;
+        }
+    }
+    SvtArenaBlock* block = arena->head;
+    void*          p     = (uint8_t*)block + ARENA_HEADER + block->used;
+    block->used += size;
+    arena->used += size;
+    return p;
+}
+
+void* svt_arena_calloc(SvtArena* arena, size_t size) {
+    void* p = svt_arena_alloc(arena, size);
+    if (p) {
+        memset(p, 0, size);
+    }
+    return p;
+}
+
+void svt_arena_reset(SvtArena* arena) {
+    if (arena->head && arena->head->next) {
+        // The last picture did not fit in one block: start over with one that holds it
+        arena->hint = ARENA_ALIGN(arena->used);
+        svt_arena_destroy(arena);
+    } else if (arena->head) {
+        arena->head->used = 0;
+    }
+    arena->used = 0;
+}
+
+void svt_arena_destroy(SvtArena* arena) {
+    while (arena->head) {
+        uint8_t* mem = (uint8_t*)arena->head;
+        arena->head  = arena->head->next;
+        EB_FREE_ALIGNED(mem);
+    }
+    arena->used = 0;
+}
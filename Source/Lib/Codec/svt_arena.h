@@ -0,0 +1,63 @@
+/*
+* Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbArena_h
+#define EbArena_h
+
+#include <stddef.h>
+#include <string.h>
+
+#include "definitions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct SvtArenaBlock;
+
+/**************************************
+ * Bump allocator for buffers that live as long as one picture. Allocations
+ * are never freed one by one; svt_arena_reset() drops all of them when the
+ * owner is reused. The blocks are kept across resets, and when a picture
+ * needed more than one block the next one starts with a single block of the
+ * size it needed, so a steady stream of pictures allocates nothing.
+ * Not thread safe: one stage at a time may allocate from an arena.
+ **************************************/
+typedef struct SvtArena {
+    struct SvtArenaBlock* head; // block served from, older blocks follow
+    size_t                used; // bytes handed out since the last reset
+    size_t                hint; // size of the next first block
+} SvtArena;
+
+// Aligned to ALVALUE, NULL when out of memory
+void* svt_arena_alloc(SvtArena* arena, size_t size);
+void* svt_arena_calloc(SvtArena* arena, size_t size);
+void  svt_arena_reset(SvtArena* arena);
+void  svt_arena_destroy(SvtArena* arena);
+
+#define EB_ARENA_MALLOC_ARRAY(arena, pa, count)                   \
+    do {                                                          \
+        (pa) = svt_arena_alloc((arena), sizeof(*(pa)) * (count)); \
+        if (!(pa))                                                \
+            return EB_ErrorInsufficientResources;                 \
+    } while (0)
+
+#define EB_ARENA_CALLOC_ARRAY(arena, pa, count)                    \
+    do {                                                           \
+        (pa) = svt_arena_calloc((arena), sizeof(*(pa)) * (count)); \
+        if (!(pa))                                                 \
+            return EB_ErrorInsufficientResources;                  \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbArena_h
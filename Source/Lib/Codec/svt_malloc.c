@@ -10,13 +10,49 @@
 */
 #include "svt_malloc.h"
 
+#include "svt_threads.h"
+
 #define LOG_TAG "SvtMalloc"
 #include "svt_log.h"
 
+#ifdef __linux__
+#include <string.h>
+#include <sys/mman.h>
+#endif
+
 void svt_print_alloc_fail_impl(const char* file, int line) {
     SVT_FATAL("allocate memory failed, at %s:%d\n", file, line);
 }
 
+static SVT_THREAD_LOCAL SvtMemScope mem_scope;
+
+SvtMemScope svt_mem_scope_enter(SvtMemAccount* account, uint8_t category) {
+    const SvtMemScope prev = mem_scope;
+    mem_scope.account      = account;
+    mem_scope.category     = category;
+    return prev;
+}
+
+SvtMemScope svt_mem_category_enter(uint8_t category) {
+    const SvtMemScope prev = mem_scope;
+    mem_scope.category     = category;
+    return prev;
+}
+
+void svt_mem_scope_leave(SvtMemScope prev) {
+    mem_scope = prev;
+}
+
+SvtMemScope svt_mem_scope_get(void) {
+    return mem_scope;
+}
+
+void svt_mem_account_add(size_t size) {
+    if (mem_scope.account) {
+        svt_atomic_fetch_add_u64(&mem_scope.account->bytes[mem_scope.category], size);
+    }
+}
+
 #ifdef DEBUG_MEMORY_USAGE
 #include <stdint.h>
 #include <limits.h>
@@ -330,3 +366,82 @@ void svt_remove_mem_entry(void* ptr, EbPtrType type) {
     }
 }
 #endif
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+// False when transparent huge pages are set to never, madvise() then succeeds
+// without effect
+static bool thp_enabled(void) {
+    FILE* f = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+    if (!f) {
+        return false;
+    }
+    char mode[64] = {0};
+    const bool read = fgets(mode, sizeof(mode), f) != NULL;
+    fclose(f);
+    return read && !strstr(mode, "[never]");
+}
+
+void* svt_huge_page_alloc(size_t size, bool explicit_pages, SvtPageKind* kind) {
+    if (size < SVT_HUGE_PAGE_SIZE) {
+        return NULL;
+    }
+    const size_t len = (size + SVT_HUGE_PAGE_SIZE - 1) & ~(SVT_HUGE_PAGE_SIZE - 1);
+#ifdef MAP_HUGETLB
+    if (explicit_pages) {
+        void* p = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            *kind = SVT_PAGES_EXPLICIT;
+            svt_mem_account_add(len);
+            EB_ADD_MEM_ENTRY(p, EB_A_PTR, len);
+            return p;
+        }
+    }
+#else
+    (void)explicit_pages;
+#endif
+    if (!thp_enabled()) {
+        return NULL;
+    }
+    // Map one huge page more and trim both ends so that the range starts on a
+    // 2 MiB boundary, else the kernel cannot use a huge page for its head
+    uint8_t* map = mmap(NULL, len + SVT_HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED) {
+        return NULL;
+    }
+    uint8_t*     p    = (uint8_t*)(((uintptr_t)map + SVT_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(SVT_HUGE_PAGE_SIZE - 1));
+    const size_t head = p - map;
+    if (head) {
+        munmap(map, head);
+    }
+    if (SVT_HUGE_PAGE_SIZE - head) {
+        munmap(p + len, SVT_HUGE_PAGE_SIZE - head);
+    }
+    if (madvise(p, len, MADV_HUGEPAGE)) {
+        munmap(p, len);
+        return NULL;
+    }
+    *kind = SVT_PAGES_TRANSPARENT;
+    svt_mem_account_add(len);
+    EB_ADD_MEM_ENTRY(p, EB_A_PTR, len);
+    return p;
+}
+
+void svt_huge_page_free(void* p, size_t size) {
+    if (p) {
+        EB_REMOVE_MEM_ENTRY(p, EB_A_PTR);
+        munmap(p, (size + SVT_HUGE_PAGE_SIZE - 1) & ~(SVT_HUGE_PAGE_SIZE - 1));
+    }
+}
+#else
+void* svt_huge_page_alloc(size_t size, bool explicit_pages, SvtPageKind* kind) {
+    (void)size;
+    (void)explicit_pages;
+    (void)kind;
+    return NULL;
+}
+
+void svt_huge_page_free(void* p, size_t size) {
+    (void)p;
+    (void)size;
+}
+#endif
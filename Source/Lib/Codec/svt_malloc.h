@@ -136,12 +136,39 @@ void svt_remove_mem_entry(void* ptr, EbPtrType type);
 
 #endif //DEBUG_MEMORY_USAGE
 
+/**************************************
+ * Memory accounting. While a scope is entered on a thread, every allocation
+ * made through the macros below on that thread adds its size to one category
+ * of the scope's account. Frees are not tracked, so scopes only wrap the
+ * construction of objects that live as long as the encoder. A ctor failing
+ * through EB_NEW may skip its svt_mem_scope_leave(); the outermost scope puts
+ * the thread back.
+ **************************************/
+typedef struct SvtMemAccount {
+    volatile uint64_t bytes[SVT_AV1_MEMORY_CATEGORIES];
+} SvtMemAccount;
+
+typedef struct SvtMemScope {
+    SvtMemAccount* account; // NULL when allocations are not accounted
+    uint8_t        category; // SvtAv1MemoryCategory
+} SvtMemScope;
+
+// Each returns the scope of the thread before the call, for svt_mem_scope_leave()
+SvtMemScope svt_mem_scope_enter(SvtMemAccount* account, uint8_t category);
+// Keep the account of the current scope, only switch the category
+SvtMemScope svt_mem_category_enter(uint8_t category);
+void        svt_mem_scope_leave(SvtMemScope prev);
+SvtMemScope svt_mem_scope_get(void);
+void        svt_mem_account_add(size_t size);
+
 #define EB_NO_THROW_ADD_MEM(p, size, type)                    \
     do {                                                      \
         if (!p)                                               \
             svt_print_alloc_fail_impl(__FILE__, EB_LINE_NUM); \
-        else                                                  \
+        else {                                                \
+            svt_mem_account_add(size);                        \
             EB_ADD_MEM_ENTRY(p, type, size);                  \
+        }                                                     \
     } while (0)
 
 #define EB_CHECK_MEM(p)                           \
@@ -334,6 +361,23 @@ void svt_remove_mem_entry(void* ptr, EbPtrType type);
 
 #define EB_FREE_ALIGNED_ARRAY(pa) EB_FREE_ALIGNED(pa)
 
+#define SVT_HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+// Where the memory of a large buffer comes from, see svt_huge_page_alloc()
+typedef enum SvtPageKind {
+    SVT_PAGES_HEAP, // EB_MALLOC_ALIGNED
+    SVT_PAGES_TRANSPARENT, // mapping advised for transparent huge pages
+    SVT_PAGES_EXPLICIT, // mapping from the hugetlbfs pool
+} SvtPageKind;
+
+// Map size bytes, rounded up to whole 2 MiB pages, from the hugetlbfs pool
+// when explicit_pages is set and the pool has room, else as a 2 MiB aligned
+// mapping advised for transparent huge pages. The memory is zeroed. Returns
+// NULL when neither is available (other systems, THP disabled, size below one
+// huge page); the caller then allocates from the heap.
+void* svt_huge_page_alloc(size_t size, bool explicit_pages, SvtPageKind* kind);
+void  svt_huge_page_free(void* p, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
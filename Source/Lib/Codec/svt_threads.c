@@ -15,6 +15,10 @@
 // and mutexs.  The goal is to eliminiate platform #define
 // in the code.
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+// pthread_{get,set}affinity_np and the CPU_* macros
+#define _GNU_SOURCE
+#endif
 #include "EbSvtAv1.h"
 #if defined(__has_feature)
 #if __has_feature(thread_sanitizer)
@@ -29,6 +33,7 @@
 /****************************************
  * Universal Includes
  ****************************************/
+#include <ctype.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
@@ -36,8 +41,13 @@
 #include "svt_log.h"
 #if SVT_AV1_NVTX
 #include "svt_nvtx.h"
+#endif
+#if SVT_AV1_NVTX || defined(__linux__)
 #include <sys/syscall.h>
 #endif
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
 /****************************************
   * Win32 Includes
   ****************************************/
@@ -94,10 +104,23 @@ static inline void svt_thread_self_setname(const char* name) {
  * itself before it enters user_fn. This makes svt-* names visible in Nsight
  * timelines, /proc/<tid>/comm, and ps/top.
  */
+#ifndef _WIN32
+// Thread handle. The pthread_t comes first, so the handle can be used as a
+// pthread_t* as well.
+typedef struct SvtThread {
+    pthread_t thread;
+    // tid - kernel thread id, published by the thread once it runs (Linux)
+    volatile int32_t tid;
+} SvtThread;
+#endif
+
 typedef struct SvtThreadStart {
     void* (*fn)(void*);
     void* arg;
     char  name[16];
+#ifndef _WIN32
+    SvtThread* self;
+#endif
 } SvtThreadStart;
 
 static void* svt_thread_trampoline(void* p) {
@@ -107,6 +130,9 @@ static void* svt_thread_trampoline(void* p) {
     char  name[16];
     strncpy(name, payload->name, sizeof(name) - 1);
     name[sizeof(name) - 1] = '\0';
+#ifdef __linux__
+    __atomic_store_n(&payload->self->tid, (int32_t)syscall(SYS_gettid), __ATOMIC_RELEASE);
+#endif
     free(payload);
 
     if (name[0]) {
@@ -249,7 +275,7 @@ EbHandle svt_create_thread(void* thread_function(void*), void* thread_context, c
     // We don't care if this fails, it's just a hint for the min size we are expecting.
     (void)pthread_attr_setstacksize(&attr, min_stack_size);
 
-    pthread_t* th = malloc(sizeof(*th));
+    SvtThread* th = malloc(sizeof(*th));
     if (th == NULL) {
         SVT_ERROR("Failed to allocate thread handle\n");
         pthread_attr_destroy(&attr);
@@ -263,8 +289,10 @@ EbHandle svt_create_thread(void* thread_function(void*), void* thread_context, c
         pthread_attr_destroy(&attr);
         return NULL;
     }
-    payload->fn  = thread_function;
-    payload->arg = thread_context;
+    th->tid       = 0;
+    payload->fn   = thread_function;
+    payload->arg  = thread_context;
+    payload->self = th;
     if (name && *name) {
         strncpy(payload->name, name, sizeof(payload->name) - 1);
         payload->name[sizeof(payload->name) - 1] = '\0';
@@ -273,7 +301,7 @@ EbHandle svt_create_thread(void* thread_function(void*), void* thread_context, c
     }
 
     int ret;
-    if ((ret = pthread_create(th, &attr, svt_thread_trampoline, payload))) {
+    if ((ret = pthread_create(&th->thread, &attr, svt_thread_trampoline, payload))) {
         SVT_ERROR("Failed to create thread: %s\n", strerror(ret));
         free(payload);
         free(th);
@@ -356,12 +384,59 @@ EbErrorType svt_post_semaphore(EbHandle semaphore_handle) {
     return return_error;
 }
 
+#if CONFIG_KERNEL_POOL
+static SVT_THREAD_LOCAL SvtThreadWaitHook wait_hook;
+static SVT_THREAD_LOCAL void*             wait_hook_ctx;
+
+void svt_set_thread_wait_hook(SvtThreadWaitHook hook, void* ctx) {
+    wait_hook     = hook;
+    wait_hook_ctx = ctx;
+}
+
+void svt_yield_thread(void) {
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+/***************************************
+ * svt_try_block_on_semaphore
+ *   Decrements the semaphore if it can be done without blocking.
+ ***************************************/
+static bool svt_try_block_on_semaphore(EbHandle semaphore_handle) {
+#ifdef _WIN32
+    return WaitForSingleObject((HANDLE)semaphore_handle, 0) == WAIT_OBJECT_0;
+#elif defined(__APPLE__)
+    return dispatch_semaphore_wait((dispatch_semaphore_t)semaphore_handle, DISPATCH_TIME_NOW) == 0;
+#else
+    int ret;
+    do {
+        ret = sem_trywait((sem_t*)semaphore_handle);
+    } while (ret == -1 && errno == EINTR);
+    return ret == 0;
+#endif
+}
+#endif
+
 /***************************************
  * svt_block_on_semaphore
  ***************************************/
 EbErrorType svt_block_on_semaphore(EbHandle semaphore_handle) {
     EbErrorType return_error;
 
+#if CONFIG_KERNEL_POOL
+    const SvtThreadWaitHook hook     = wait_hook;
+    void* const             hook_ctx = wait_hook_ctx;
+    if (hook) {
+        if (svt_try_block_on_semaphore(semaphore_handle)) {
+            return EB_ErrorNone;
+        }
+        hook(hook_ctx, true);
+    }
+#endif
+
 #ifdef _WIN32
     return_error = WaitForSingleObject((HANDLE)semaphore_handle, INFINITE) ? EB_ErrorSemaphoreUnresponsive
                                                                            : EB_ErrorNone;
@@ -377,6 +452,12 @@ EbErrorType svt_block_on_semaphore(EbHandle semaphore_handle) {
     return_error = ret ? EB_ErrorSemaphoreUnresponsive : EB_ErrorNone;
 #endif
 
+#if CONFIG_KERNEL_POOL
+    if (hook) {
+        hook(hook_ctx, false);
+    }
+#endif
+
     return return_error;
 }
 
@@ -528,10 +609,28 @@ EbErrorType svt_set_cond_var(CondVar* cond_var, int32_t newval) {
 */
 
 EbErrorType svt_wait_cond_var(CondVar* cond_var, int32_t input) {
+#if CONFIG_KERNEL_POOL
+    // The hook is notified with the condition mutex held, only when the wait
+    // actually has to sleep.
+    const SvtThreadWaitHook hook     = wait_hook;
+    void* const             hook_ctx = wait_hook_ctx;
+    bool                    hooked   = false;
+#define SVT_COND_WAIT_HOOK_BEGIN()   \
+    do {                             \
+        if (hook && !hooked) {       \
+            hooked = true;           \
+            hook(hook_ctx, true);    \
+        }                            \
+    } while (0)
+#else
+#define SVT_COND_WAIT_HOOK_BEGIN() ((void)0)
+#endif
+    EbErrorType return_error = EB_ErrorNone;
 #ifdef _WIN32
 
     EnterCriticalSection(&cond_var->cs);
     while (cond_var->val == input) {
+        SVT_COND_WAIT_HOOK_BEGIN();
         SleepConditionVariableCS(&cond_var->cv, &cond_var->cs, INFINITE);
     }
     LeaveCriticalSection(&cond_var->cs);
@@ -540,16 +639,23 @@ EbErrorType svt_wait_cond_var(CondVar* cond_var, int32_t input) {
         return EB_ErrorMutexUnresponsive;
     }
     while (cond_var->val == input) {
+        SVT_COND_WAIT_HOOK_BEGIN();
         if (pthread_cond_wait(&cond_var->m_cond, &cond_var->m_mutex)) {
-            (void)pthread_mutex_unlock(&cond_var->m_mutex);
-            return EB_ErrorMutexUnresponsive;
+            return_error = EB_ErrorMutexUnresponsive;
+            break;
         }
     }
     if (pthread_mutex_unlock(&cond_var->m_mutex)) {
-        return EB_ErrorMutexUnresponsive;
+        return_error = EB_ErrorMutexUnresponsive;
     }
 #endif
-    return EB_ErrorNone;
+#undef SVT_COND_WAIT_HOOK_BEGIN
+#if CONFIG_KERNEL_POOL
+    if (hooked) {
+        hook(hook_ctx, false);
+    }
+#endif
+    return return_error;
 }
 
 void svt_run_once(OnceType* once_control, OnceFn init_routine) {
@@ -559,3 +665,159 @@ void svt_run_once(OnceType* once_control, OnceFn init_routine) {
     pthread_once(once_control, init_routine);
 #endif
 }
+
+/****************************************
+ * CPU affinity
+ ****************************************/
+uint32_t svt_cpu_set_count(const SvtCpuSet* set) {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < SVT_MAX_CPUS / 64; i++) {
+        for (uint64_t bits = set->bits[i]; bits; bits &= bits - 1) {
+            count++;
+        }
+    }
+    return count;
+}
+
+const char* svt_parse_cpu_list(const char* list, SvtCpuSet* set) {
+    memset(set, 0, sizeof(*set));
+    for (;;) {
+        char* end;
+        if (!isdigit((unsigned char)*list)) {
+            return NULL;
+        }
+        const unsigned long first = strtoul(list, &end, 10);
+        unsigned long       last  = first;
+        if (*end == '-') {
+            list = end + 1;
+            if (!isdigit((unsigned char)*list)) {
+                return NULL;
+            }
+            last = strtoul(list, &end, 10);
+        }
+        if (last < first || last >= SVT_MAX_CPUS) {
+            return NULL;
+        }
+        for (unsigned long cpu = first; cpu <= last; cpu++) {
+            set->bits[cpu / 64] |= (uint64_t)1 << (cpu % 64);
+        }
+        if (*end != ',') {
+            return end;
+        }
+        list = end + 1;
+    }
+}
+
+#ifdef __linux__
+
+bool svt_get_numa_node_cpus(uint32_t node, SvtCpuSet* set) {
+    char path[64];
+    char list[4096];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+    const bool read = fgets(list, sizeof(list), file) != NULL;
+    fclose(file);
+    return read && svt_parse_cpu_list(list, set) != NULL;
+}
+
+bool svt_get_thread_affinity(SvtCpuSet* set) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpus), &cpus)) {
+        return false;
+    }
+    memset(set, 0, sizeof(*set));
+    for (uint32_t cpu = 0; cpu < SVT_MAX_CPUS && cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &cpus)) {
+            set->bits[cpu / 64] |= (uint64_t)1 << (cpu % 64);
+        }
+    }
+    return true;
+}
+
+static bool svt_set_pthread_affinity(pthread_t thread, const SvtCpuSet* set) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (uint32_t cpu = 0; cpu < SVT_MAX_CPUS && cpu < CPU_SETSIZE; cpu++) {
+        if (set->bits[cpu / 64] & ((uint64_t)1 << (cpu % 64))) {
+            CPU_SET(cpu, &cpus);
+        }
+    }
+    return pthread_setaffinity_np(thread, sizeof(cpus), &cpus) == 0;
+}
+
+bool svt_set_thread_affinity(const SvtCpuSet* set) {
+    return svt_set_pthread_affinity(pthread_self(), set);
+}
+
+bool svt_set_thread_handle_affinity(EbHandle thread_handle, const SvtCpuSet* set) {
+    return thread_handle && svt_set_pthread_affinity(*(pthread_t*)thread_handle, set);
+}
+#else
+bool svt_get_numa_node_cpus(uint32_t node, SvtCpuSet* set) {
+    (void)node;
+    (void)set;
+    return false;
+}
+
+bool svt_get_thread_affinity(SvtCpuSet* set) {
+    (void)set;
+    return false;
+}
+
+bool svt_set_thread_affinity(const SvtCpuSet* set) {
+    (void)set;
+    return false;
+}
+
+bool svt_set_thread_handle_affinity(EbHandle thread_handle, const SvtCpuSet* set) {
+    (void)thread_handle;
+    (void)set;
+    return false;
+}
+#endif // __linux__
+
+/****************************************
+ * Thread priority
+ ****************************************/
+#ifdef _WIN32
+bool svt_set_thread_handle_priority(EbHandle thread_handle, SvtThreadPriority priority) {
+    static const int win_priority[] = {
+        THREAD_PRIORITY_NORMAL, THREAD_PRIORITY_BELOW_NORMAL, THREAD_PRIORITY_ABOVE_NORMAL, THREAD_PRIORITY_HIGHEST};
+    return thread_handle && SetThreadPriority((HANDLE)thread_handle, win_priority[priority]);
+}
+#else
+bool svt_set_thread_handle_priority(EbHandle thread_handle, SvtThreadPriority priority) {
+    SvtThread* th = (SvtThread*)thread_handle;
+    if (!th) {
+        return false;
+    }
+    if (priority == SVT_THREAD_PRIORITY_REALTIME) {
+        // Lowest SCHED_FIFO level: ahead of every time-shared thread without
+        // competing with system real-time threads
+        struct sched_param param = {.sched_priority = sched_get_priority_min(SCHED_FIFO)};
+        return pthread_setschedparam(th->thread, SCHED_FIFO, &param) == 0;
+    }
+    // Time-shared levels: leave any real-time policy inherited from the
+    // creating thread (see enc_switch_to_real_time), nice has no effect there
+    struct sched_param param = {.sched_priority = 0};
+    if (pthread_setschedparam(th->thread, SCHED_OTHER, &param)) {
+        return false;
+    }
+#ifdef __linux__
+    // Nice values are per kernel thread; the thread publishes its id as soon
+    // as it starts
+    int32_t tid;
+    while (!(tid = __atomic_load_n(&th->tid, __ATOMIC_ACQUIRE))) {
+        sched_yield();
+    }
+    const int nice = priority == SVT_THREAD_PRIORITY_LOW ? 5 : priority == SVT_THREAD_PRIORITY_HIGH ? -5 : 0;
+    return setpriority(PRIO_PROCESS, (id_t)tid, nice) == 0;
+#else
+    return priority == SVT_THREAD_PRIORITY_NORMAL;
+#endif
+}
+#endif // _WIN32
@@ -13,6 +13,7 @@
 #define EbThreads_h
 
 #include "definitions.h"
+#include "EbConfigMacros.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -36,6 +37,48 @@ EbErrorType svt_destroy_thread(EbHandle thread_handle);
 // buffer (typical size 16 to match TASK_COMM_LEN). Used by EB_CREATE_THREAD_ARRAY.
 void svt_format_thread_name(char* buf, size_t size, const char* prefix, uint32_t index);
 
+/**************************************
+     * CPU affinity
+     **************************************/
+#define SVT_MAX_CPUS 1024
+// Set of logical processors, bit i is processor i.
+typedef struct SvtCpuSet {
+    uint64_t bits[SVT_MAX_CPUS / 64];
+} SvtCpuSet;
+
+uint32_t svt_cpu_set_count(const SvtCpuSet* set);
+
+// Parse a cpulist such as "0-15,32-47" (the sysfs and taskset --cpu-list
+// format). Returns the first character after the list, or NULL if it is
+// malformed or names a processor beyond SVT_MAX_CPUS.
+const char* svt_parse_cpu_list(const char* list, SvtCpuSet* set);
+
+// Processors of NUMA node `node`. Returns false when the node does not exist
+// or the platform does not expose the NUMA topology (Linux only for now).
+bool svt_get_numa_node_cpus(uint32_t node, SvtCpuSet* set);
+
+// Affinity of the calling thread. Threads created by the calling thread
+// inherit it, which is how every pipeline thread of a handle gets placed.
+bool svt_get_thread_affinity(SvtCpuSet* set);
+bool svt_set_thread_affinity(const SvtCpuSet* set);
+
+// Affinity of a thread created with svt_create_thread().
+bool svt_set_thread_handle_affinity(EbHandle thread_handle, const SvtCpuSet* set);
+
+/**************************************
+     * Thread priority
+     **************************************/
+typedef enum SvtThreadPriority {
+    SVT_THREAD_PRIORITY_NORMAL,
+    SVT_THREAD_PRIORITY_LOW, // bulk work: nice +5 (below normal on Windows)
+    SVT_THREAD_PRIORITY_HIGH, // latency critical: nice -5 (above normal), usually needs privileges
+    SVT_THREAD_PRIORITY_REALTIME, // latency critical: SCHED_FIFO (highest), needs privileges
+} SvtThreadPriority;
+
+// Scheduler priority of a thread created with svt_create_thread(). Returns
+// false when the OS refuses it, e.g. raising priority without privileges.
+bool svt_set_thread_handle_priority(EbHandle thread_handle, SvtThreadPriority priority);
+
 /**************************************
      * Semaphores
      **************************************/
@@ -54,6 +97,97 @@ EbHandle    svt_create_mutex(void);
 EbErrorType svt_release_mutex(EbHandle mutex_handle);
 EbErrorType svt_block_on_mutex(EbHandle mutex_handle);
 EbErrorType svt_destroy_mutex(EbHandle mutex_handle);
+
+/**************************************
+     * Atomics (sequentially consistent)
+     **************************************/
+#ifdef _MSC_VER
+#include <intrin.h>
+static INLINE uint32_t svt_atomic_load_u32(volatile uint32_t* p) {
+    return (uint32_t)_InterlockedOr((volatile long*)p, 0);
+}
+static INLINE void svt_atomic_store_u32(volatile uint32_t* p, uint32_t v) {
+    _InterlockedExchange((volatile long*)p, (long)v);
+}
+static INLINE uint32_t svt_atomic_fetch_add_u32(volatile uint32_t* p, uint32_t v) {
+    return (uint32_t)_InterlockedExchangeAdd((volatile long*)p, (long)v);
+}
+static INLINE uint64_t svt_atomic_fetch_add_u64(volatile uint64_t* p, uint64_t v) {
+    return (uint64_t)_InterlockedExchangeAdd64((volatile __int64*)p, (__int64)v);
+}
+static INLINE uint64_t svt_atomic_load_u64(volatile uint64_t* p) {
+    return (uint64_t)_InterlockedCompareExchange64((volatile __int64*)p, 0, 0);
+}
+static INLINE bool svt_atomic_cas_u32(volatile uint32_t* p, uint32_t expected, uint32_t desired) {
+    return (uint32_t)_InterlockedCompareExchange((volatile long*)p, (long)desired, (long)expected) == expected;
+}
+static INLINE bool svt_atomic_cas_u64(volatile uint64_t* p, uint64_t expected, uint64_t desired) {
+    return (uint64_t)_InterlockedCompareExchange64((volatile __int64*)p, (__int64)desired, (__int64)expected) ==
+        expected;
+}
+static INLINE void svt_atomic_fence(void) {
+    MemoryBarrier();
+}
+static INLINE void svt_cpu_relax(void) {
+    YieldProcessor();
+}
+#else
+static INLINE uint32_t svt_atomic_load_u32(volatile uint32_t* p) {
+    return __atomic_load_n(p, __ATOMIC_SEQ_CST);
+}
+static INLINE void svt_atomic_store_u32(volatile uint32_t* p, uint32_t v) {
+    __atomic_store_n(p, v, __ATOMIC_SEQ_CST);
+}
+static INLINE uint32_t svt_atomic_fetch_add_u32(volatile uint32_t* p, uint32_t v) {
+    return __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST);
+}
+static INLINE uint64_t svt_atomic_fetch_add_u64(volatile uint64_t* p, uint64_t v) {
+    return __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST);
+}
+static INLINE uint64_t svt_atomic_load_u64(volatile uint64_t* p) {
+    return __atomic_load_n(p, __ATOMIC_SEQ_CST);
+}
+static INLINE bool svt_atomic_cas_u32(volatile uint32_t* p, uint32_t expected, uint32_t desired) {
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+static INLINE bool svt_atomic_cas_u64(volatile uint64_t* p, uint64_t expected, uint64_t desired) {
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+static INLINE void svt_atomic_fence(void) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+static INLINE void svt_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+#else
+    __asm__ __volatile__("" ::: "memory");
+#endif
+}
+#endif
+
+#if CONFIG_KERNEL_POOL
+// Thread-local storage class for per-worker scheduler state.
+#ifdef _MSC_VER
+#define SVT_THREAD_LOCAL __declspec(thread)
+#else
+#define SVT_THREAD_LOCAL __thread
+#endif
+
+/**************************************
+     * Thread wait hook
+     **************************************/
+// Per-thread callback invoked by svt_block_on_semaphore() and svt_wait_cond_var()
+// right before the calling thread goes to sleep (begin = true) and again once it
+// is woken up (begin = false). Waits that complete without sleeping do not call
+// it. Used by the kernel pool to lend the core to another worker while a kernel
+// is blocked. Passing NULL removes the hook from the calling thread.
+typedef void (*SvtThreadWaitHook)(void* ctx, bool begin);
+void svt_set_thread_wait_hook(SvtThreadWaitHook hook, void* ctx);
+// Give the rest of the calling thread's time slice to another runnable thread.
+void svt_yield_thread(void);
+#endif
 #ifndef _WIN32
 #ifndef __USE_GNU
 #define __USE_GNU
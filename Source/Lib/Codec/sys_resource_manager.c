@@ -15,17 +15,23 @@
 #include "sys_resource_manager.h"
 #include "EbConfigMacros.h"
 #include "definitions.h"
+#include "utility.h"
 #include "svt_threads.h"
 #include "svt_nvtx.h"
+#include "pipeline_profiler.h"
 #include "svt_log.h"
 #if CONFIG_SINGLE_THREAD_KERNEL
 #include "kernel_dispatch.h"
 #endif
+#if CONFIG_KERNEL_POOL
+#include "kernel_pool.h"
+#endif
 #if SRM_REPORT
 #include "svt_log.h"
 #endif
 static void svt_fifo_dctor(EbPtr p) {
     EbFifo* obj = (EbFifo*)p;
+    EB_DESTROY_SEMAPHORE(obj->scale_semaphore);
     EB_DESTROY_SEMAPHORE(obj->counting_semaphore);
     EB_DESTROY_MUTEX(obj->lockout_mutex);
 }
@@ -105,10 +111,141 @@ static EbErrorType svt_fifo_shutdown(EbFifo* fifo_ptr) {
     svt_release_mutex(fifo_ptr->lockout_mutex);
     //Wake up the waiting process if any
     svt_post_semaphore(fifo_ptr->counting_semaphore);
+#if CONFIG_KERNEL_POOL
+    if (fifo_ptr->kernel_slot) {
+        svt_kernel_pool_notify(fifo_ptr->kernel_slot);
+    }
+#endif
 
     return return_error;
 }
 
+#if CONFIG_LOCKFREE_FIFO
+// Empty polls before a waiting process parks on the ring semaphore
+#define LOCKFREE_RING_SPIN_COUNT 256
+
+static void svt_lockfree_ring_dctor(EbPtr p) {
+    EbLockFreeRing* obj = (EbLockFreeRing*)p;
+    EB_FREE_ARRAY(obj->cells);
+    EB_DESTROY_SEMAPHORE(obj->park_semaphore);
+}
+
+/**************************************
+ * svt_lockfree_ring_ctor
+ **************************************/
+static EbErrorType svt_lockfree_ring_ctor(EbLockFreeRing* ring, uint32_t object_total_count) {
+    uint32_t capacity = 1;
+    ring->dctor       = svt_lockfree_ring_dctor;
+    while (capacity < object_total_count) {
+        capacity <<= 1;
+    }
+    ring->mask = capacity - 1;
+    EB_MALLOC_ARRAY(ring->cells, capacity);
+    for (uint32_t i = 0; i < capacity; i++) {
+        ring->cells[i].sequence    = i;
+        ring->cells[i].wrapper_ptr = NULL;
+    }
+    EB_CREATE_SEMAPHORE(ring->park_semaphore, 0, INT32_MAX);
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * svt_lockfree_ring_push
+ **************************************/
+static void svt_lockfree_ring_push(EbLockFreeRing* ring, EbObjectWrapper* wrapper_ptr) {
+    uint32_t        pos = svt_atomic_load_u32(&ring->enqueue_pos);
+    EbLockFreeCell* cell;
+    for (;;) {
+        cell              = &ring->cells[pos & ring->mask];
+        const int32_t dif = (int32_t)(svt_atomic_load_u32(&cell->sequence) - pos);
+        if (dif == 0) {
+            if (svt_atomic_cas_u32(&ring->enqueue_pos, pos, pos + 1)) {
+                break;
+            }
+        } else if (dif < 0) {
+            // The ring holds every object of the resource, so the cell can only
+            // be held by a pop that has claimed it but not yet handed it back.
+            svt_cpu_relax();
+        }
+        pos = svt_atomic_load_u32(&ring->enqueue_pos);
+    }
+    cell->wrapper_ptr = wrapper_ptr;
+    svt_atomic_store_u32(&cell->sequence, pos + 1);
+
+    // Publish before checking for parked processes (pairs with the fence in
+    // svt_lockfree_ring_pop_wait)
+    svt_atomic_fence();
+    if (svt_atomic_load_u32(&ring->waiters)) {
+        svt_post_semaphore(ring->park_semaphore);
+    }
+}
+
+/**************************************
+ * svt_lockfree_ring_try_pop
+ **************************************/
+static bool svt_lockfree_ring_try_pop(EbLockFreeRing* ring, EbObjectWrapper** wrapper_dbl_ptr) {
+    uint32_t pos = svt_atomic_load_u32(&ring->dequeue_pos);
+    for (;;) {
+        EbLockFreeCell* cell = &ring->cells[pos & ring->mask];
+        const int32_t   dif  = (int32_t)(svt_atomic_load_u32(&cell->sequence) - (pos + 1));
+        if (dif == 0) {
+            if (svt_atomic_cas_u32(&ring->dequeue_pos, pos, pos + 1)) {
+                *wrapper_dbl_ptr = cell->wrapper_ptr;
+                svt_atomic_store_u32(&cell->sequence, pos + ring->mask + 1);
+                return true;
+            }
+        } else if (dif < 0) {
+            return false;
+        }
+        pos = svt_atomic_load_u32(&ring->dequeue_pos);
+    }
+}
+
+static bool svt_fifo_quit_requested(EbFifo* fifo_ptr) {
+    return fifo_ptr && *(volatile bool*)&fifo_ptr->quit_signal;
+}
+
+/**************************************
+ * svt_lockfree_ring_pop_wait
+ *   Pops the next object, spinning and then parking while the ring is
+ *   empty. Returns false without an object once quit_signal is set on
+ *   fifo_ptr (NULL for queues that are never shut down).
+ **************************************/
+static bool svt_lockfree_ring_pop_wait(EbLockFreeRing* ring, EbFifo* fifo_ptr, EbObjectWrapper** wrapper_dbl_ptr) {
+    if (svt_fifo_quit_requested(fifo_ptr)) {
+        return false;
+    }
+    if (svt_lockfree_ring_try_pop(ring, wrapper_dbl_ptr)) {
+        return true;
+    }
+
+    // NVTX "wait" range covers the spin and the park only, so a stage that
+    // finds work already queued shows no wait at all.
+    SVT_NVTX_RANGE_PUSH("wait");
+    bool     got  = false;
+    bool     quit = false;
+    uint32_t spin = 0;
+    while (!got && !quit) {
+        if (spin++ < LOCKFREE_RING_SPIN_COUNT) {
+            svt_cpu_relax();
+            quit = svt_fifo_quit_requested(fifo_ptr);
+            got  = !quit && svt_lockfree_ring_try_pop(ring, wrapper_dbl_ptr);
+            continue;
+        }
+        svt_atomic_fetch_add_u32(&ring->waiters, 1);
+        svt_atomic_fence();
+        quit = svt_fifo_quit_requested(fifo_ptr);
+        got  = !quit && svt_lockfree_ring_try_pop(ring, wrapper_dbl_ptr);
+        if (!got && !quit) {
+            svt_block_on_semaphore(ring->park_semaphore);
+        }
+        svt_atomic_fetch_add_u32(&ring->waiters, (uint32_t)-1);
+    }
+    SVT_NVTX_RANGE_POP();
+    return got;
+}
+#endif
+
 static void svt_circular_buffer_dctor(EbPtr p) {
     EbCircularBuffer* obj = (EbCircularBuffer*)p;
     EB_FREE(obj->array_ptr);
@@ -196,6 +333,9 @@ static EbErrorType svt_circular_buffer_push_front(EbCircularBuffer* bufferPtr, E
 
 void svt_muxing_queue_dctor(EbPtr p) {
     EbMuxingQueue* obj = (EbMuxingQueue*)p;
+#if CONFIG_LOCKFREE_FIFO
+    EB_DELETE(obj->ring);
+#endif
     EB_DELETE_PTR_ARRAY(obj->process_fifo_ptr_array, obj->process_total_count);
     EB_DELETE(obj->object_queue);
     EB_DELETE(obj->process_queue);
@@ -210,8 +350,9 @@ static EbErrorType svt_muxing_queue_ctor(EbMuxingQueue* queue_ptr, uint32_t obje
     uint32_t    process_index;
     EbErrorType return_error = EB_ErrorNone;
 
-    queue_ptr->dctor               = svt_muxing_queue_dctor;
-    queue_ptr->process_total_count = process_total_count;
+    queue_ptr->dctor                = svt_muxing_queue_dctor;
+    queue_ptr->process_total_count  = process_total_count;
+    queue_ptr->active_process_count = process_total_count;
 
     // Lockout Mutex (skip in single-thread mode)
 #if CONFIG_SINGLE_THREAD_KERNEL
@@ -295,6 +436,11 @@ static EbErrorType svt_muxing_queue_assignation(EbMuxingQueue* queue_ptr) {
 
         // Post the semaphore
         svt_post_semaphore(process_fifo_ptr->counting_semaphore);
+#if CONFIG_KERNEL_POOL
+        if (process_fifo_ptr->kernel_slot) {
+            svt_kernel_pool_notify(process_fifo_ptr->kernel_slot);
+        }
+#endif
     }
 
     return return_error;
@@ -442,6 +588,11 @@ typedef struct DctorAble {
 
 void svt_object_wrapper_dctor(EbPtr p) {
     EbObjectWrapper* wrapper = (EbObjectWrapper*)p;
+    // Objects still in flight when the encoder is torn down
+    if (wrapper->release_cb) {
+        wrapper->release_cb(wrapper, wrapper->release_ctx);
+        wrapper->release_cb = NULL;
+    }
     if (wrapper->object_destroyer) {
         //customized destroyer
         if (wrapper->object_ptr) {
@@ -475,6 +626,9 @@ static void svt_system_resource_dctor(EbPtr p) {
     EB_DELETE(obj->full_queue);
     EB_DELETE(obj->empty_queue);
     EB_DELETE_PTR_ARRAY(obj->wrapper_ptr_pool, obj->object_total_count);
+    if (obj->object_init_data_size) {
+        EB_FREE(obj->object_init_data_ptr);
+    }
 }
 
 /*********************************************************************
@@ -506,17 +660,44 @@ EbErrorType svt_system_resource_ctor(EbSystemResource* resource_ptr, uint32_t ob
                                      uint32_t producer_process_total_count, uint32_t consumer_process_total_count,
                                      EbCreator object_creator, EbPtr object_init_data_ptr, EbDctor object_destroyer,
                                      bool single_thread) {
+    return svt_system_resource_lazy_ctor(resource_ptr,
+                                         object_total_count,
+                                         object_total_count,
+                                         producer_process_total_count,
+                                         consumer_process_total_count,
+                                         object_creator,
+                                         object_init_data_ptr,
+                                         0,
+                                         object_destroyer,
+                                         single_thread);
+}
+
+EbErrorType svt_system_resource_lazy_ctor(EbSystemResource* resource_ptr, uint32_t initial_count,
+                                          uint32_t object_total_count, uint32_t producer_process_total_count,
+                                          uint32_t consumer_process_total_count, EbCreator object_creator,
+                                          EbPtr object_init_data_ptr, size_t object_init_data_size,
+                                          EbDctor object_destroyer, bool single_thread) {
     uint32_t    wrapper_index;
     EbErrorType return_error = EB_ErrorNone;
     resource_ptr->dctor      = svt_system_resource_dctor;
 
-    resource_ptr->object_total_count = object_total_count;
+    resource_ptr->object_total_count   = object_total_count;
+    resource_ptr->object_created_count = MIN(initial_count, object_total_count);
+    resource_ptr->object_creator       = object_creator;
+    resource_ptr->object_init_data_ptr = object_init_data_ptr;
+    resource_ptr->object_destroyer     = object_destroyer;
+    resource_ptr->mem_scope            = svt_mem_scope_get();
+    if (resource_ptr->object_created_count < object_total_count && object_init_data_size) {
+        EB_MALLOC(resource_ptr->object_init_data_ptr, object_init_data_size);
+        resource_ptr->object_init_data_size = object_init_data_size;
+        memcpy(resource_ptr->object_init_data_ptr, object_init_data_ptr, object_init_data_size);
+    }
 
     // Allocate array for wrapper pointers
     EB_ALLOC_PTR_ARRAY(resource_ptr->wrapper_ptr_pool, resource_ptr->object_total_count);
 
     // Initialize each wrapper
-    for (wrapper_index = 0; wrapper_index < resource_ptr->object_total_count; ++wrapper_index) {
+    for (wrapper_index = 0; wrapper_index < resource_ptr->object_created_count; ++wrapper_index) {
         EB_NEW(resource_ptr->wrapper_ptr_pool[wrapper_index],
                svt_object_wrapper_ctor,
                resource_ptr,
@@ -536,13 +717,14 @@ EbErrorType svt_system_resource_ctor(EbSystemResource* resource_ptr, uint32_t ob
            producer_process_total_count,
            single_thread,
            /*is_empty_queue=*/true);
+    resource_ptr->empty_queue->resource_ptr = resource_ptr;
     // Fill the Empty Fifo with every ObjectWrapper
-    for (wrapper_index = 0; wrapper_index < resource_ptr->object_total_count; ++wrapper_index) {
+    for (wrapper_index = 0; wrapper_index < resource_ptr->object_created_count; ++wrapper_index) {
         svt_muxing_queue_object_push_back(resource_ptr->empty_queue, resource_ptr->wrapper_ptr_pool[wrapper_index]);
     }
 #if SRM_REPORT
     //at init time, the SRM is full
-    resource_ptr->empty_queue->curr_count = resource_ptr->object_total_count;
+    resource_ptr->empty_queue->curr_count = resource_ptr->object_created_count;
     resource_ptr->empty_queue->log        = 0;
 #endif
     // Initialize the Full Queue
@@ -560,6 +742,105 @@ EbErrorType svt_system_resource_ctor(EbSystemResource* resource_ptr, uint32_t ob
     return return_error;
 }
 
+// Lock of the object count of a lazy SystemResource: the lockout_mutex of its
+// empty queue, none in single-thread mode
+static void svt_system_resource_lock(EbSystemResource* resource_ptr) {
+#if CONFIG_SINGLE_THREAD_KERNEL
+    if (resource_ptr->empty_queue->single_thread_mode) {
+        return;
+    }
+#endif
+    svt_block_on_mutex(resource_ptr->empty_queue->lockout_mutex);
+}
+
+static void svt_system_resource_unlock(EbSystemResource* resource_ptr) {
+#if CONFIG_SINGLE_THREAD_KERNEL
+    if (resource_ptr->empty_queue->single_thread_mode) {
+        return;
+    }
+#endif
+    svt_release_mutex(resource_ptr->empty_queue->lockout_mutex);
+}
+
+/*********************************************************************
+ * svt_system_resource_grow
+ *   Constructs one more object of a lazy SystemResource, which the caller
+ *   owns as if taken from the empty queue. Called when no empty object is
+ *   left; returns NULL once object_total_count objects exist or when the
+ *   construction fails, in which case the caller waits for a release.
+ *********************************************************************/
+static EbObjectWrapper* svt_system_resource_grow(EbSystemResource* resource_ptr) {
+    EbMuxingQueue* queue_ptr = resource_ptr->empty_queue;
+    bool           reserved  = false;
+
+    if (resource_ptr->object_created_count == resource_ptr->object_total_count) {
+        return NULL;
+    }
+    // Reserve one object of the count; the construction itself runs without
+    // the lock
+    svt_system_resource_lock(resource_ptr);
+    if (svt_circular_buffer_empty_check(queue_ptr->object_queue) &&
+        resource_ptr->object_created_count < resource_ptr->object_total_count) {
+        resource_ptr->object_created_count++;
+        reserved = true;
+    }
+    svt_system_resource_unlock(resource_ptr);
+    if (!reserved) {
+        return NULL;
+    }
+
+    EbObjectWrapper*  wrapper_ptr;
+    const SvtMemScope mem_scope = svt_mem_scope_enter(resource_ptr->mem_scope.account,
+                                                      resource_ptr->mem_scope.category);
+    EB_CALLOC_NO_CHECK(wrapper_ptr, 1, sizeof(*wrapper_ptr));
+    const EbErrorType ctor_error = wrapper_ptr ? svt_object_wrapper_ctor(wrapper_ptr,
+                                                                         resource_ptr,
+                                                                         resource_ptr->object_creator,
+                                                                         resource_ptr->object_init_data_ptr,
+                                                                         resource_ptr->object_destroyer)
+                                               : EB_ErrorInsufficientResources;
+    svt_mem_scope_leave(mem_scope);
+    if (ctor_error != EB_ErrorNone) {
+        EB_DELETE(wrapper_ptr);
+        // Give the reservation back, so that a later grow can retry once
+        // memory is available again
+        svt_system_resource_lock(resource_ptr);
+        resource_ptr->object_created_count--;
+        const uint32_t created_count = resource_ptr->object_created_count;
+        svt_system_resource_unlock(resource_ptr);
+        SVT_WARN("Could not grow a pool past %u objects, waiting for one to be released\n", created_count);
+        return NULL;
+    }
+#if SRM_REPORT
+    wrapper_ptr->pic_number = 99999999;
+#endif
+    // Published for the destruction of the SystemResource only, in the first
+    // free slot: a failed construction gives back its count but not a slot
+    // index, so the slots are assigned here rather than at reservation
+    svt_system_resource_lock(resource_ptr);
+    uint32_t wrapper_index = 0;
+    while (resource_ptr->wrapper_ptr_pool[wrapper_index]) {
+        wrapper_index++;
+    }
+    resource_ptr->wrapper_ptr_pool[wrapper_index] = wrapper_ptr;
+    svt_system_resource_unlock(resource_ptr);
+    return wrapper_ptr;
+}
+
+// Account for an object taken from the empty queue of resource_ptr
+static void svt_system_resource_take(EbSystemResource* resource_ptr) {
+    const uint32_t in_use = svt_atomic_fetch_add_u32(&resource_ptr->in_use_count, 1) + 1;
+    uint32_t       peak   = svt_atomic_load_u32(&resource_ptr->peak_in_use_count);
+    while (in_use > peak && !svt_atomic_cas_u32(&resource_ptr->peak_in_use_count, peak, in_use)) {
+        peak = svt_atomic_load_u32(&resource_ptr->peak_in_use_count);
+    }
+}
+
+// Account for an object going back to the empty queue of resource_ptr
+static void svt_system_resource_put(EbSystemResource* resource_ptr) {
+    svt_atomic_fetch_add_u32(&resource_ptr->in_use_count, (uint32_t)-1);
+}
+
 EbFifo* svt_system_resource_get_producer_fifo(const EbSystemResource* resource_ptr, uint32_t index) {
     return svt_muxing_queue_get_fifo(resource_ptr->empty_queue, index);
 }
@@ -568,6 +849,83 @@ EbFifo* svt_system_resource_get_consumer_fifo(const EbSystemResource* resource_p
     return svt_muxing_queue_get_fifo(resource_ptr->full_queue, index);
 }
 
+/**************************************
+ * svt_fifo_wake_parked
+ *   Resumes the process parked on fifo_ptr, if any. The parked flag is
+ *   claimed with a compare-and-swap so that exactly one of the waker and
+ *   the process itself clears it.
+ **************************************/
+static void svt_fifo_wake_parked(EbFifo* fifo_ptr) {
+    if (fifo_ptr->scale_semaphore && svt_atomic_cas_u32(&fifo_ptr->parked, 1, 0)) {
+        svt_post_semaphore(fifo_ptr->scale_semaphore);
+    }
+}
+
+static bool svt_fifo_is_active(EbFifo* fifo_ptr) {
+    return fifo_ptr->process_index < svt_atomic_load_u32(&fifo_ptr->queue_ptr->active_process_count) ||
+        *(volatile bool*)&fifo_ptr->quit_signal;
+}
+
+/**************************************
+ * svt_fifo_wait_active
+ *   Parks the calling process while its consumer FIFO is scaled out.
+ **************************************/
+static void svt_fifo_wait_active(EbFifo* fifo_ptr) {
+    if (!fifo_ptr->scale_semaphore) {
+        return;
+    }
+    while (!svt_fifo_is_active(fifo_ptr)) {
+        svt_atomic_store_u32(&fifo_ptr->parked, 1);
+        svt_atomic_fence();
+        // Re-check after publishing parked: a waker that changed the count
+        // before seeing the flag would not post
+        if (svt_fifo_is_active(fifo_ptr) && svt_atomic_cas_u32(&fifo_ptr->parked, 1, 0)) {
+            return;
+        }
+        svt_block_on_semaphore(fifo_ptr->scale_semaphore);
+    }
+}
+
+/**************************************
+ * svt_muxing_queue_depth
+ *   Objects posted to the queue and not yet taken by a process. Read
+ *   without the lock, for telemetry only.
+ **************************************/
+static uint32_t svt_muxing_queue_depth(EbMuxingQueue* queue_ptr) {
+#if CONFIG_LOCKFREE_FIFO
+    if (queue_ptr->ring) {
+        return svt_atomic_load_u32(&queue_ptr->ring->enqueue_pos) -
+            svt_atomic_load_u32(&queue_ptr->ring->dequeue_pos);
+    }
+#endif
+    return *(volatile uint32_t*)&queue_ptr->object_queue->current_count;
+}
+
+void svt_fifo_attach_profile(EbFifo* fifo_ptr, struct SvtKernelProfile* profile) {
+    fifo_ptr->profile = profile;
+}
+
+EbErrorType svt_system_resource_enable_scaling(EbSystemResource* resource_ptr) {
+    EbMuxingQueue* queue_ptr = resource_ptr->full_queue;
+    for (uint32_t i = 0; i < queue_ptr->process_total_count; i++) {
+        EbFifo* fifo_ptr         = queue_ptr->process_fifo_ptr_array[i];
+        fifo_ptr->process_index  = i;
+        EB_CREATE_SEMAPHORE(fifo_ptr->scale_semaphore, 0, 1);
+    }
+    return EB_ErrorNone;
+}
+
+uint32_t svt_system_resource_set_active_consumers(EbSystemResource* resource_ptr, uint32_t active_count) {
+    EbMuxingQueue* queue_ptr = resource_ptr->full_queue;
+    active_count             = CLIP3(1, queue_ptr->process_total_count, active_count);
+    svt_atomic_store_u32(&queue_ptr->active_process_count, active_count);
+    svt_atomic_fence();
+    for (uint32_t i = 0; i < active_count; i++) {
+        svt_fifo_wake_parked(queue_ptr->process_fifo_ptr_array[i]);
+    }
+    return active_count;
+}
+
 EbErrorType svt_shutdown_process(const EbSystemResource* resource_ptr) {
     //not fully constructed
     if (!resource_ptr || !resource_ptr->full_queue) {
@@ -586,6 +944,20 @@ EbErrorType svt_shutdown_process(const EbSystemResource* resource_ptr) {
             svt_fifo_shutdown(fifo_ptr);
         }
     }
+#if CONFIG_LOCKFREE_FIFO
+    // Parked consumers share one semaphore, so wake them only once every
+    // quit_signal is set; a woken consumer then cannot park again.
+    if (resource_ptr->full_queue->ring) {
+        for (unsigned int i = 0; i < resource_ptr->full_queue->process_total_count; i++) {
+            svt_post_semaphore(resource_ptr->full_queue->ring->park_semaphore);
+        }
+    }
+#endif
+    // Scaled-out consumers see quit_signal once resumed
+    svt_atomic_fence();
+    for (unsigned int i = 0; i < resource_ptr->full_queue->process_total_count; i++) {
+        svt_fifo_wake_parked(svt_system_resource_get_consumer_fifo(resource_ptr, i));
+    }
     return EB_ErrorNone;
 }
 
@@ -630,6 +1002,12 @@ EbErrorType svt_post_full_object(EbObjectWrapper* object_ptr) {
         return EB_ErrorNone;
     }
 #endif
+#if CONFIG_LOCKFREE_FIFO
+    if (object_ptr->system_resource_ptr->full_queue->ring) {
+        svt_lockfree_ring_push(object_ptr->system_resource_ptr->full_queue->ring, object_ptr);
+        return EB_ErrorNone;
+    }
+#endif
 
     svt_block_on_mutex(object_ptr->system_resource_ptr->full_queue->lockout_mutex);
 
@@ -640,12 +1018,29 @@ EbErrorType svt_post_full_object(EbObjectWrapper* object_ptr) {
     return return_error;
 }
 
+// Queue a released EbObjectWrapper back to its empty queue. Called with the
+// empty queue lockout_mutex held.
+static void release_object_push(EbObjectWrapper* object_ptr) {
+    svt_muxing_queue_object_push_front(object_ptr->system_resource_ptr->empty_queue, object_ptr);
+#if SRM_REPORT
+    object_ptr->pic_number = 99999999;
+    //increment the fullness
+    object_ptr->system_resource_ptr->empty_queue->curr_count++;
+    if (object_ptr->system_resource_ptr->empty_queue->log) {
+        SVT_LOG("SRM fullness+: %i/%i\n",
+                object_ptr->system_resource_ptr->empty_queue->curr_count,
+                object_ptr->system_resource_ptr->object_total_count);
+    }
+#endif
+}
+
 /*********************************************************************
  * EbSystemResourceReleaseObject
  *   Queues an empty EbObjectWrapper to the SystemResource. This
  *   function posts the SystemResource emptyFifo counting_semaphore.
  *   This function is write protected by the SystemResource emptyFifo
- *   lockout_mutex.
+ *   lockout_mutex. A release_cb of the EbObjectWrapper runs between
+ *   the last release and the queuing, without the lockout_mutex.
  *
  *   object_ptr
  *      pointer to EbObjectWrapper to be released.
@@ -660,6 +1055,12 @@ EbErrorType svt_release_object(EbObjectWrapper* object_ptr) {
         object_ptr->live_count = (object_ptr->live_count == 0) ? object_ptr->live_count : object_ptr->live_count - 1;
         if ((object_ptr->release_enable == true) && (object_ptr->live_count == 0)) {
             object_ptr->live_count = EB_ObjectWrapperReleasedValue;
+            svt_system_resource_put(object_ptr->system_resource_ptr);
+            if (object_ptr->release_cb) {
+                void (*release_cb)(EbObjectWrapper*, void*) = object_ptr->release_cb;
+                object_ptr->release_cb                      = NULL;
+                release_cb(object_ptr, object_ptr->release_ctx);
+            }
             svt_circular_buffer_push_front(object_ptr->system_resource_ptr->empty_queue->object_queue, object_ptr);
         }
         return EB_ErrorNone;
@@ -674,25 +1075,30 @@ EbErrorType svt_release_object(EbObjectWrapper* object_ptr) {
     // Decrement live_count
     object_ptr->live_count = (object_ptr->live_count == 0) ? object_ptr->live_count : object_ptr->live_count - 1;
 
+    void (*release_cb)(EbObjectWrapper*, void*) = NULL;
     if ((object_ptr->release_enable == true) && (object_ptr->live_count == 0)) {
         // Set live_count to EB_ObjectWrapperReleasedValue
         object_ptr->live_count = EB_ObjectWrapperReleasedValue;
-
-        svt_muxing_queue_object_push_front(object_ptr->system_resource_ptr->empty_queue, object_ptr);
-#if SRM_REPORT
-        object_ptr->pic_number = 99999999;
-        //increment the fullness
-        object_ptr->system_resource_ptr->empty_queue->curr_count++;
-        if (object_ptr->system_resource_ptr->empty_queue->log) {
-            SVT_LOG("SRM fullness+: %i/%i\n",
-                    object_ptr->system_resource_ptr->empty_queue->curr_count,
-                    object_ptr->system_resource_ptr->object_total_count);
+        svt_system_resource_put(object_ptr->system_resource_ptr);
+
+        // The callback may block or release other objects, so the object
+        // is queued only after it returns
+        release_cb             = object_ptr->release_cb;
+        object_ptr->release_cb = NULL;
+        if (!release_cb) {
+            release_object_push(object_ptr);
         }
-#endif
     }
 
     svt_release_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
+    if (release_cb) {
+        release_cb(object_ptr, object_ptr->release_ctx);
+        svt_block_on_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
+        release_object_push(object_ptr);
+        svt_release_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
+    }
+
     return return_error;
 }
 
@@ -705,6 +1111,7 @@ EbErrorType svt_release_dual_object(EbObjectWrapper* object_ptr, EbObjectWrapper
         if ((object_ptr->release_enable == true) && (object_ptr->live_count == 0)) {
             svt_release_object(sec_object_ptr);
             object_ptr->live_count = EB_ObjectWrapperReleasedValue;
+            svt_system_resource_put(object_ptr->system_resource_ptr);
             svt_circular_buffer_push_front(object_ptr->system_resource_ptr->empty_queue->object_queue, object_ptr);
         }
         return EB_ErrorNone;
@@ -722,6 +1129,7 @@ EbErrorType svt_release_dual_object(EbObjectWrapper* object_ptr, EbObjectWrapper
 
         // Set live_count to EB_ObjectWrapperReleasedValue
         object_ptr->live_count = EB_ObjectWrapperReleasedValue;
+        svt_system_resource_put(object_ptr->system_resource_ptr);
 
         svt_muxing_queue_object_push_front(object_ptr->system_resource_ptr->empty_queue, object_ptr);
 
@@ -779,8 +1187,9 @@ EbErrorType svt_get_empty_object(EbFifo* empty_fifo_ptr, EbObjectWrapper** wrapp
 #if CONFIG_SINGLE_THREAD_KERNEL
     if (empty_fifo_ptr->queue_ptr->single_thread_mode) {
         // Pop directly from the object queue — no semaphore, no mutex.
-        // If pool is empty, pump the dispatcher to free buffers.
-        if (svt_circular_buffer_empty_check(empty_fifo_ptr->queue_ptr->object_queue)) {
+        // If pool is empty, grow a lazy pool or pump the dispatcher to free buffers.
+        *wrapper_dbl_ptr = svt_system_resource_grow(empty_fifo_ptr->queue_ptr->resource_ptr);
+        if (!*wrapper_dbl_ptr && svt_circular_buffer_empty_check(empty_fifo_ptr->queue_ptr->object_queue)) {
             SvtKernelDispatcher* d = (SvtKernelDispatcher*)empty_fifo_ptr->queue_ptr->st_dispatcher;
             if (!d) {
                 SVT_FATAL("ST mode: empty object pool exhausted (no dispatcher to pump)\n");
@@ -792,7 +1201,10 @@ EbErrorType svt_get_empty_object(EbFifo* empty_fifo_ptr, EbObjectWrapper** wrapp
                 return EB_ErrorInsufficientResources;
             }
         }
-        svt_circular_buffer_pop_front(empty_fifo_ptr->queue_ptr->object_queue, (void**)wrapper_dbl_ptr);
+        if (!*wrapper_dbl_ptr) {
+            svt_circular_buffer_pop_front(empty_fifo_ptr->queue_ptr->object_queue, (void**)wrapper_dbl_ptr);
+        }
+        svt_system_resource_take(empty_fifo_ptr->queue_ptr->resource_ptr);
         svt_aom_assert_err(
             (*wrapper_dbl_ptr)->live_count == 0 || (*wrapper_dbl_ptr)->live_count == EB_ObjectWrapperReleasedValue,
             "live_count should be 0 or EB_ObjectWrapperReleasedValue when get");
@@ -801,6 +1213,14 @@ EbErrorType svt_get_empty_object(EbFifo* empty_fifo_ptr, EbObjectWrapper** wrapp
         return EB_ErrorNone;
     }
 #endif
+    // A lazy pool with no empty object left constructs a new one instead
+    *wrapper_dbl_ptr = svt_system_resource_grow(empty_fifo_ptr->queue_ptr->resource_ptr);
+    if (*wrapper_dbl_ptr) {
+        svt_system_resource_take(empty_fifo_ptr->queue_ptr->resource_ptr);
+        (*wrapper_dbl_ptr)->live_count     = 0;
+        (*wrapper_dbl_ptr)->release_enable = true;
+        return EB_ErrorNone;
+    }
 
     // Queue the Fifo requesting the empty fifo
     svt_release_process(empty_fifo_ptr);
@@ -828,6 +1248,8 @@ EbErrorType svt_get_empty_object(EbFifo* empty_fifo_ptr, EbObjectWrapper** wrapp
         (*wrapper_dbl_ptr)->live_count == 0 || (*wrapper_dbl_ptr)->live_count == EB_ObjectWrapperReleasedValue,
         "live_count should be 0 or EB_ObjectWrapperReleasedValue when get");
 
+    svt_system_resource_take(empty_fifo_ptr->queue_ptr->resource_ptr);
+
     // Reset the wrapper's live_count
     (*wrapper_dbl_ptr)->live_count = 0;
 
@@ -870,6 +1292,22 @@ EbErrorType svt_get_full_object(EbFifo* full_fifo_ptr, EbObjectWrapper** wrapper
         return EB_ErrorNone;
     }
 #endif
+    if (full_fifo_ptr->profile) {
+        svt_kernel_profile_begin_wait(full_fifo_ptr->profile, svt_muxing_queue_depth(full_fifo_ptr->queue_ptr));
+    }
+    svt_fifo_wait_active(full_fifo_ptr);
+#if CONFIG_LOCKFREE_FIFO
+    if (full_fifo_ptr->queue_ptr->ring) {
+        if (!svt_lockfree_ring_pop_wait(full_fifo_ptr->queue_ptr->ring, full_fifo_ptr, wrapper_dbl_ptr)) {
+            *wrapper_dbl_ptr = NULL;
+            return_error     = EB_NoErrorFifoShutdown;
+        }
+        if (full_fifo_ptr->profile) {
+            svt_kernel_profile_end_wait(full_fifo_ptr->profile, return_error == EB_ErrorNone);
+        }
+        return return_error;
+    }
+#endif
 
     // NVTX "wait" range covers semaphore + mutex wait. The gap between
     // consecutive "wait" ranges on a stage thread reads as "busy" on the
@@ -897,6 +1335,9 @@ EbErrorType svt_get_full_object(EbFifo* full_fifo_ptr, EbObjectWrapper** wrapper
 
     SVT_NVTX_RANGE_POP();
 
+    if (full_fifo_ptr->profile) {
+        svt_kernel_profile_end_wait(full_fifo_ptr->profile, return_error == EB_ErrorNone);
+    }
     return return_error;
 }
 
@@ -925,6 +1366,15 @@ EbErrorType svt_get_full_object_non_blocking(EbFifo* full_fifo_ptr, EbObjectWrap
         return EB_ErrorNone;
     }
 #endif
+#if CONFIG_LOCKFREE_FIFO
+    if (full_fifo_ptr->queue_ptr->ring) {
+        if (svt_fifo_quit_requested(full_fifo_ptr) ||
+            !svt_lockfree_ring_try_pop(full_fifo_ptr->queue_ptr->ring, wrapper_dbl_ptr)) {
+            *wrapper_dbl_ptr = NULL;
+        }
+        return EB_ErrorNone;
+    }
+#endif
 
     bool fifo_empty;
     // Queue the Fifo requesting the full fifo
@@ -973,3 +1423,43 @@ void svt_system_resource_set_single_thread_mode(EbSystemResource* resource_ptr,
     }
 }
 #endif
+
+#if CONFIG_KERNEL_POOL
+void svt_fifo_attach_kernel_slot(EbFifo* fifo_ptr, struct SvtKernelSlot* slot) {
+    fifo_ptr->kernel_slot = slot;
+    svt_release_process(fifo_ptr);
+}
+
+bool svt_fifo_has_pending(EbFifo* fifo_ptr) {
+    svt_block_on_mutex(fifo_ptr->lockout_mutex);
+    const bool pending = fifo_ptr->first_ptr != NULL || fifo_ptr->quit_signal;
+    svt_release_mutex(fifo_ptr->lockout_mutex);
+    return pending;
+}
+#endif
+
+#if CONFIG_LOCKFREE_FIFO
+static EbErrorType svt_muxing_queue_set_lockfree_mode(EbMuxingQueue* queue_ptr, uint32_t object_total_count) {
+    EbObjectWrapper* wrapper_ptr;
+
+    // Must run before any process waits on the queue
+    assert(svt_circular_buffer_empty_check(queue_ptr->process_queue));
+    EB_NEW(queue_ptr->ring, svt_lockfree_ring_ctor, object_total_count);
+    while (!svt_circular_buffer_empty_check(queue_ptr->object_queue)) {
+        svt_circular_buffer_pop_front(queue_ptr->object_queue, (void**)&wrapper_ptr);
+        svt_lockfree_ring_push(queue_ptr->ring, wrapper_ptr);
+    }
+    return EB_ErrorNone;
+}
+
+// Only the full queue gets a ring. The empty queue stays on the mutex path so
+// released objects keep being recycled LIFO (push_front): the object handed
+// out next is the one touched last and still warm in cache, where a FIFO ring
+// would cycle through the whole pool.
+EbErrorType svt_system_resource_set_lockfree_mode(EbSystemResource* resource_ptr) {
+    if (!resource_ptr || !resource_ptr->full_queue) {
+        return EB_ErrorNone;
+    }
+    return svt_muxing_queue_set_lockfree_mode(resource_ptr->full_queue, resource_ptr->object_total_count);
+}
+#endif
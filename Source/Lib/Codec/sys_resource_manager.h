@@ -53,6 +53,13 @@ typedef struct EbObjectWrapper {
     // next_ptr - a pointer to a different EbObjectWrapper.  Used
     //   only in the implemenation of a single-linked Fifo.
     struct EbObjectWrapper* next_ptr;
+
+    // release_cb - when set, called with release_ctx once the last
+    //   reference is released, before the EbObjectWrapper goes back to
+    //   the empty queue and outside of its lockout_mutex. Cleared before
+    //   the call, so it has to be set again on every reuse.
+    void (*release_cb)(struct EbObjectWrapper* wrapper, void* release_ctx);
+    void* release_ctx;
 #if SRM_REPORT
     uint64_t pic_number;
 #endif
@@ -89,6 +96,20 @@ typedef struct EbFifo {
     // queue_ptr - pointer to MuxingQueue that the EbFifo is
     //   associated with.
     struct EbMuxingQueue* queue_ptr;
+#if CONFIG_KERNEL_POOL
+    // kernel_slot - when set, this kernel pool slot is scheduled every
+    //   time an object is assigned to this EbFifo or the EbFifo is shut down.
+    struct SvtKernelSlot* kernel_slot;
+#endif
+    // scale_semaphore - when set, the process owning this consumer EbFifo
+    //   parks on it whenever process_index is not below the
+    //   active_process_count of its MuxingQueue.
+    EbHandle          scale_semaphore;
+    uint32_t          process_index;
+    volatile uint32_t parked;
+    // profile - when set, the process owning this consumer EbFifo records
+    //   its busy and wait time there on every svt_get_full_object().
+    struct SvtKernelProfile* profile;
 } EbFifo;
 
 /*********************************************************************
@@ -103,6 +124,39 @@ typedef struct EbCircularBuffer {
     uint32_t current_count;
 } EbCircularBuffer;
 
+#if CONFIG_LOCKFREE_FIFO
+/*********************************************************************
+     * LockFreeRing
+     *   Bounded multi-producer multi-consumer ring of EbObjectWrapper
+     *   pointers. Each cell carries a sequence number that tells
+     *   producers and consumers whose turn it is, so push and pop only
+     *   contend on one compare-and-swap of their own position. The
+     *   capacity is a power of two no smaller than the number of objects
+     *   of the SystemResource, so a push can never find the ring full.
+     *   Consumers that find the ring empty spin for a short while, then
+     *   park on park_semaphore; producers post it only when waiters is
+     *   non-zero.
+     *********************************************************************/
+typedef struct EbLockFreeCell {
+    volatile uint32_t sequence;
+    EbObjectWrapper*  wrapper_ptr;
+} EbLockFreeCell;
+
+typedef struct EbLockFreeRing {
+    EbDctor         dctor;
+    EbLockFreeCell* cells;
+    uint32_t        mask;
+    EbHandle        park_semaphore;
+    // Producer and consumer positions on separate cache lines
+    uint8_t           pad0[64];
+    volatile uint32_t enqueue_pos;
+    uint8_t           pad1[64];
+    volatile uint32_t dequeue_pos;
+    uint8_t           pad2[64];
+    volatile uint32_t waiters;
+} EbLockFreeRing;
+#endif
+
 /*********************************************************************
      * MuxingQueue
      *********************************************************************/
@@ -117,6 +171,17 @@ typedef struct EbMuxingQueue {
     bool  single_thread_mode; // bypass semaphores/mutexes at lp=1
     void* st_dispatcher; // SvtKernelDispatcher* for pumping when pool is empty
 #endif
+#if CONFIG_LOCKFREE_FIFO
+    // ring - when set, objects bypass object_queue/process_queue and the
+    //   process FIFOs; any process pops the next object from the ring.
+    EbLockFreeRing* ring;
+#endif
+    // active_process_count - processes allowed to take new objects; only
+    //   enforced on consumer FIFOs that have a scale_semaphore.
+    volatile uint32_t active_process_count;
+    // resource_ptr - the SystemResource this is the empty queue of; NULL
+    //   for full queues.
+    struct EbSystemResource* resource_ptr;
 #if SRM_REPORT
     uint32_t curr_count; //run time fullness
     uint8_t  log; //if set monitor out the queue size
@@ -147,6 +212,23 @@ typedef struct EbSystemResource {
 
     // The full FIFO contains a queue of completed buffers
     EbMuxingQueue* full_queue;
+
+    // object_created_count - A count of the objects constructed so far.
+    //   Below object_total_count only for lazy SystemResources, which
+    //   construct the rest one at a time when no empty object is left.
+    uint32_t object_created_count;
+    EbCreator object_creator;
+    EbPtr     object_init_data_ptr; // owned copy when object_init_data_size
+    size_t    object_init_data_size;
+    EbDctor   object_destroyer;
+    // Memory scope of the ctor thread, the objects constructed later are
+    // accounted to it as well
+    SvtMemScope mem_scope;
+
+    // in_use_count - objects taken from the empty queue and not released
+    //   yet; peak_in_use_count is its high-water mark.
+    volatile uint32_t in_use_count;
+    volatile uint32_t peak_in_use_count;
 } EbSystemResource;
 
 /*********************************************************************
@@ -227,6 +309,24 @@ EbErrorType svt_system_resource_ctor(EbSystemResource* resource_ptr, uint32_t ob
                                      EbCreator object_ctor, EbPtr object_init_data_ptr, EbDctor object_destroyer,
                                      bool single_thread);
 
+/*********************************************************************
+     * svt_system_resource_lazy_ctor
+     *   Constructor for a lazy EbSystemResource. Same as
+     *   svt_system_resource_ctor, except that only initial_count objects
+     *   are constructed up front; svt_get_empty_object() constructs the
+     *   others, up to object_total_count, when it finds no empty object.
+     *
+     *   object_init_data_size
+     *     size of the data block at object_init_data_ptr, which is then
+     *     copied for the later constructions. 0 when the block outlives
+     *     the SystemResource.
+     *********************************************************************/
+EbErrorType svt_system_resource_lazy_ctor(EbSystemResource* resource_ptr, uint32_t initial_count,
+                                          uint32_t object_total_count, uint32_t producer_process_total_count,
+                                          uint32_t consumer_process_total_count, EbCreator object_ctor,
+                                          EbPtr object_init_data_ptr, size_t object_init_data_size,
+                                          EbDctor object_destroyer, bool single_thread);
+
 /*********************************************************************
      * svt_system_resource_get_producer_fifo
      *   get producer fifo
@@ -349,6 +449,39 @@ bool svt_fifo_has_items_st(EbFifo* fifo_ptr);
 void svt_system_resource_set_single_thread_mode(EbSystemResource* resource_ptr, void* dispatcher);
 #endif
 
+#if CONFIG_LOCKFREE_FIFO
+// Switch the full queue of a SystemResource to a lock-free ring. Must be
+// called before any kernel thread uses the resource. The empty queue keeps the
+// mutex path and its LIFO recycling.
+EbErrorType svt_system_resource_set_lockfree_mode(EbSystemResource* resource_ptr);
+#endif
+
+// Let the consumer processes of a SystemResource be parked and resumed at run
+// time. Must be called before any kernel thread uses the resource; all
+// consumers start active.
+EbErrorType svt_system_resource_enable_scaling(EbSystemResource* resource_ptr);
+
+// Allow only the first active_count consumer processes (at least one) to take
+// new objects. A process above the limit finishes the object it holds and
+// parks in its next svt_get_full_object(); resumed processes wake at once.
+// Returns the count applied.
+uint32_t svt_system_resource_set_active_consumers(EbSystemResource* resource_ptr, uint32_t active_count);
+
+// Record the busy and wait time of the process owning a consumer FIFO.
+// Must be called before the process first uses the FIFO.
+void svt_fifo_attach_profile(EbFifo* fifo_ptr, struct SvtKernelProfile* profile);
+
+#if CONFIG_KERNEL_POOL
+// Route the readiness of a consumer FIFO to a kernel pool slot. The FIFO is
+// registered with its muxing queue once here; after that each kernel
+// iteration re-registers it through svt_get_full_object(), so exactly one
+// registration is outstanding whenever the slot is idle.
+void svt_fifo_attach_kernel_slot(EbFifo* fifo_ptr, struct SvtKernelSlot* slot);
+
+// Check if a consumer FIFO holds an object or is shutting down.
+bool svt_fifo_has_pending(EbFifo* fifo_ptr);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
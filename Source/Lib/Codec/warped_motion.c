@@ -826,10 +826,142 @@ void svt_av1_highbd_warp_affine_c(const int32_t* mat, const uint8_t* ref8b, cons
     }
 }
 
-static void highbd_warp_plane(WarpedMotionParams* wm, const uint8_t* const ref8, const uint8_t* const ref_2b, int width,
-                              int height, int stride, const uint8_t* const pred8, int p_col, int p_row, int p_width,
-                              int p_height, int p_stride, int subsampling_x, int subsampling_y, int bd,
-                              ConvolveParams* conv_params) {
+// Integer position of the reference pixel at the center of the 8x8 block at (j, i), as in the warp kernels
+static void warp_block_position(const int32_t* mat, int i, int j, int subsampling_x, int subsampling_y, int* ix4,
+                                int* iy4) {
+    const int32_t src_x = (j + 4) << subsampling_x;
+    const int32_t src_y = (i + 4) << subsampling_y;
+    const int32_t dst_x = mat[2] * src_x + mat[3] * src_y + mat[0];
+    const int32_t dst_y = mat[4] * src_x + mat[5] * src_y + mat[1];
+    *ix4                = (dst_x >> subsampling_x) >> WARPEDMODEL_PREC_BITS;
+    *iy4                = (dst_y >> subsampling_y) >> WARPEDMODEL_PREC_BITS;
+}
+
+/* Warp from a reference whose 2 bit plane is compressed (4 pixels per byte, see
+ * svt_unpack_and_2bcompress()). The warp kernels read the 2 bits one byte per
+ * pixel, so the part of the plane read by the block is first expanded into a
+ * tile. The mapping is affine, hence the 8x8 blocks at the corners bound the
+ * reference area. Rows are clamped to the frame by the kernels; columns are
+ * clamped too, but the SIMD kernels load up to 13 pixels past either edge
+ * before discarding them. Blocks whose area does not fit the tile are split. */
+static void highbd_warp_compressed_2b(const int32_t* mat, const uint8_t* ref8, const uint8_t* ref_2b, int width,
+                                      int height, int stride, uint16_t* pred, int p_col, int p_row, int p_width,
+                                      int p_height, int p_stride, int subsampling_x, int subsampling_y, int bd,
+                                      ConvolveParams* conv_params, int16_t alpha, int16_t beta, int16_t gamma,
+                                      int16_t delta) {
+    int x_min = INT32_MAX, x_max = INT32_MIN, y_min = INT32_MAX, y_max = INT32_MIN;
+    for (int c = 0; c < 4; c++) {
+        int ix4, iy4;
+        warp_block_position(mat,
+                            p_row + (c & 1 ? (p_height - 1) & ~7 : 0),
+                            p_col + (c & 2 ? (p_width - 1) & ~7 : 0),
+                            subsampling_x,
+                            subsampling_y,
+                            &ix4,
+                            &iy4);
+        x_min = AOMMIN(x_min, ix4);
+        x_max = AOMMAX(x_max, ix4);
+        y_min = AOMMIN(y_min, iy4);
+        y_max = AOMMAX(y_max, iy4);
+    }
+    const int left   = clamp(x_min - 7, -13, width - 1);
+    const int right  = clamp(x_max + 8, 0, width + 13);
+    const int top    = clamp(y_min - 7, 0, height - 1);
+    const int bottom = clamp(y_max + 7, 0, height - 1);
+    const int tile_w = right - left + 1;
+    const int tile_h = bottom - top + 1;
+
+    if (tile_w * tile_h > PACKED_BUFFER_SIZE) {
+        // Split the longer side on an 8x8 block boundary
+        const bool           split_rows = p_height > 8 && (p_height >= p_width || p_width <= 8);
+        const int            first      = ((split_rows ? p_height : p_width) >> 1) & ~7;
+        const int            row_offset = split_rows ? first : 0;
+        const int            col_offset = split_rows ? 0 : first;
+        ConvolveParams       second     = *conv_params;
+        ConvolveParams* const second_cp = conv_params->dst ? &second : conv_params;
+        if (conv_params->dst) {
+            second.dst += row_offset * conv_params->dst_stride + col_offset;
+        }
+        assert(first > 0);
+        highbd_warp_compressed_2b(mat,
+                                  ref8,
+                                  ref_2b,
+                                  width,
+                                  height,
+                                  stride,
+                                  pred,
+                                  p_col,
+                                  p_row,
+                                  split_rows ? p_width : first,
+                                  split_rows ? first : p_height,
+                                  p_stride,
+                                  subsampling_x,
+                                  subsampling_y,
+                                  bd,
+                                  conv_params,
+                                  alpha,
+                                  beta,
+                                  gamma,
+                                  delta);
+        highbd_warp_compressed_2b(mat,
+                                  ref8,
+                                  ref_2b,
+                                  width,
+                                  height,
+                                  stride,
+                                  pred + row_offset * p_stride + col_offset,
+                                  p_col + col_offset,
+                                  p_row + row_offset,
+                                  p_width - col_offset,
+                                  p_height - row_offset,
+                                  p_stride,
+                                  subsampling_x,
+                                  subsampling_y,
+                                  bd,
+                                  second_cp,
+                                  alpha,
+                                  beta,
+                                  gamma,
+                                  delta);
+        return;
+    }
+
+    DECLARE_ALIGNED(16, uint8_t, tile[PACKED_BUFFER_SIZE]);
+    for (int y = top; y <= bottom; y++) {
+        const uint8_t* src = ref_2b + y * (stride >> 2);
+        uint8_t*       dst = tile + (y - top) * tile_w;
+        for (int x = left; x <= right; x++) {
+            // x may be left of the frame: round the byte index down
+            dst[x - left] = (src[(x - (x & 3)) / 4] << (2 * (x & 3))) & 0xC0;
+        }
+    }
+    svt_av1_highbd_warp_affine(mat,
+                               ref8,
+                               tile - top * tile_w - left,
+                               width,
+                               height,
+                               stride,
+                               tile_w,
+                               pred,
+                               p_col,
+                               p_row,
+                               p_width,
+                               p_height,
+                               p_stride,
+                               subsampling_x,
+                               subsampling_y,
+                               bd,
+                               conv_params,
+                               alpha,
+                               beta,
+                               gamma,
+                               delta);
+}
+
+static void highbd_warp_plane(WarpedMotionParams* wm, const uint8_t* const ref8, const uint8_t* const ref_2b,
+                              bool compressed_2b, int width, int height, int stride, const uint8_t* const pred8,
+                              int p_col, int p_row, int p_width, int p_height, int p_stride, int subsampling_x,
+                              int subsampling_y, int bd, ConvolveParams* conv_params) {
     assert(wm->wmtype <= AFFINE);
     if (wm->wmtype == ROTZOOM) {
         wm->wmmat[5] = wm->wmmat[2];
@@ -842,6 +974,29 @@ static void highbd_warp_plane(WarpedMotionParams* wm, const uint8_t* const ref8,
     const int16_t        delta = wm->delta;
 
     uint16_t* pred = (uint16_t*)pred8;
+    if (compressed_2b) {
+        highbd_warp_compressed_2b(mat,
+                                  ref8,
+                                  ref_2b,
+                                  width,
+                                  height,
+                                  stride,
+                                  pred,
+                                  p_col,
+                                  p_row,
+                                  p_width,
+                                  p_height,
+                                  p_stride,
+                                  subsampling_x,
+                                  subsampling_y,
+                                  bd,
+                                  conv_params,
+                                  alpha,
+                                  beta,
+                                  gamma,
+                                  delta);
+        return;
+    }
     svt_av1_highbd_warp_affine(mat,
                                ref8,
                                ref_2b,
@@ -866,12 +1021,14 @@ static void highbd_warp_plane(WarpedMotionParams* wm, const uint8_t* const ref8,
 }
 
 void svt_av1_warp_plane(WarpedMotionParams* wm, int use_hbd, int bd, const uint8_t* ref, const uint8_t* ref_2b,
-                        int width, int height, int stride, uint8_t* pred, int p_col, int p_row, int p_width,
-                        int p_height, int p_stride, int subsampling_x, int subsampling_y, ConvolveParams* conv_params) {
+                        bool compressed_2b, int width, int height, int stride, uint8_t* pred, int p_col, int p_row,
+                        int p_width, int p_height, int p_stride, int subsampling_x, int subsampling_y,
+                        ConvolveParams* conv_params) {
     if (use_hbd) {
         highbd_warp_plane(wm,
                           ref,
                           ref_2b,
+                          compressed_2b,
                           width,
                           height,
                           stride,
@@ -71,8 +71,9 @@ static const uint8_t warp_pad_right[14][16] = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10
                                                {0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}};
 
 void svt_av1_warp_plane(WarpedMotionParams* wm, int use_hbd, int bd, const uint8_t* ref, const uint8_t* ref_2b,
-                        int width, int height, int stride, uint8_t* pred, int p_col, int p_row, int p_width,
-                        int p_height, int p_stride, int subsampling_x, int subsampling_y, ConvolveParams* conv_params);
+                        bool compressed_2b, int width, int height, int stride, uint8_t* pred, int p_col, int p_row,
+                        int p_width, int p_height, int p_stride, int subsampling_x, int subsampling_y,
+                        ConvolveParams* conv_params);
 
 bool svt_find_projection(int np, int* pts1, int* pts2, BlockSize bsize, const Mv mv, WarpedMotionParams* wm_params,
                          int mi_row, int mi_col);
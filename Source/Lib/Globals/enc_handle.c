@@ -22,6 +22,7 @@
 #include "svt_threads.h"
 #include "utility.h"
 #include "enc_handle.h"
+#include "kernel_pool.h"
 #include "enc_settings.h"
 #include "pcs.h"
 #include "pic_operators.h"
@@ -169,6 +170,256 @@ static uint32_t get_num_processors() {
 #endif
 }
 
+// Processors the threads of a handle run on: its NUMA node when one is set,
+// otherwise the whole machine, limited to pin_threads
+static uint32_t get_handle_processors(const EbSvtAv1EncConfiguration* config) {
+    uint32_t  count = get_num_processors();
+    SvtCpuSet cpus;
+    if (config->numa_node >= 0 && svt_get_numa_node_cpus((uint32_t)config->numa_node, &cpus)) {
+        count = svt_cpu_set_count(&cpus);
+    }
+    if (config->pin_threads) {
+        count = MIN(count, config->pin_threads);
+    }
+    return count;
+}
+
+static const char* const enc_thread_group_names[ENC_THREAD_GROUP_COUNT] = {
+    "all", "rescoord", "picana", "picdec", "me", "irc", "srcops", "tpl", "picmgr",
+    "rc", "mdcfg", "encdec", "ec", "dlf", "cdef", "rest", "pkt",
+};
+
+// Parse thread_affinity: entries separated by ';', each "[<group>@]<cpulist>".
+// An entry without a group sets the default core set of the handle.
+static EbErrorType parse_thread_affinity(const char* spec, EncThreadAffinity* affinity) {
+    memset(affinity, 0, sizeof(*affinity));
+    while (*spec) {
+        uint32_t    group = ENC_THREAD_GROUP_ALL;
+        const char* at    = strchr(spec, '@');
+        const char* semi  = strchr(spec, ';');
+        if (at && (!semi || at < semi)) {
+            const size_t len = (size_t)(at - spec);
+            for (group = ENC_THREAD_GROUP_COUNT; group > 0; group--) {
+                if (strlen(enc_thread_group_names[group - 1]) == len &&
+                    !strncmp(enc_thread_group_names[group - 1], spec, len)) {
+                    break;
+                }
+            }
+            if (group-- == 0) {
+                SVT_ERROR("thread_affinity: unknown thread group '%.*s'\n", (int)len, spec);
+                return EB_ErrorBadParameter;
+            }
+            spec = at + 1;
+        }
+        const char* end = svt_parse_cpu_list(spec, &affinity->cpus[group]);
+        if (!end || (*end && *end != ';')) {
+            SVT_ERROR("thread_affinity: malformed cpu list in '%s'\n", spec);
+            return EB_ErrorBadParameter;
+        }
+        affinity->is_set[group] = true;
+        spec                    = *end ? end + 1 : end;
+    }
+    return EB_ErrorNone;
+}
+
+// Default core set of the handle, from thread_affinity, numa_node and
+// pin_threads. Returns false when the handle is not placed at all.
+static bool get_handle_cpus(const EbEncHandle* enc_handle_ptr, SvtCpuSet* cpus) {
+    const EbSvtAv1EncConfiguration* config = &enc_handle_ptr->scs_instance->scs->static_config;
+    if (enc_handle_ptr->thread_affinity.is_set[ENC_THREAD_GROUP_ALL]) {
+        *cpus = enc_handle_ptr->thread_affinity.cpus[ENC_THREAD_GROUP_ALL];
+        return true;
+    }
+    if (config->numa_node < 0 && !config->pin_threads) {
+        return false;
+    }
+    if (config->numa_node >= 0 && svt_get_numa_node_cpus((uint32_t)config->numa_node, cpus)) {
+        SVT_INFO("NUMA placement: node %d\n", config->numa_node);
+    } else {
+        if (config->numa_node >= 0) {
+            SVT_WARN("NUMA node %d is not available, ignoring numa_node\n", config->numa_node);
+        }
+        if (!config->pin_threads || !svt_get_thread_affinity(cpus)) {
+            return false;
+        }
+    }
+    // Keep the first pin_threads processors
+    uint32_t kept = 0;
+    for (uint32_t cpu = 0; cpu < SVT_MAX_CPUS; cpu++) {
+        const uint64_t bit = (uint64_t)1 << (cpu % 64);
+        if (cpus->bits[cpu / 64] & bit) {
+            if (config->pin_threads && kept == config->pin_threads) {
+                cpus->bits[cpu / 64] &= ~bit;
+            } else {
+                kept++;
+            }
+        }
+    }
+    return true;
+}
+
+// Stages on the frame latency path: serial kernels every picture goes
+// through one at a time
+static const bool enc_thread_group_latency_critical[ENC_THREAD_GROUP_COUNT] = {
+    [ENC_THREAD_GROUP_RESOURCE_COORDINATION] = true,
+    [ENC_THREAD_GROUP_PICTURE_DECISION]      = true,
+    [ENC_THREAD_GROUP_INITIAL_RATE_CONTROL]  = true,
+    [ENC_THREAD_GROUP_PICTURE_MANAGER]       = true,
+    [ENC_THREAD_GROUP_RATE_CONTROL]          = true,
+    [ENC_THREAD_GROUP_ENTROPY_CODING]        = true,
+    [ENC_THREAD_GROUP_PACKETIZATION]         = true,
+};
+
+static SvtThreadPriority get_thread_group_priority(uint8_t thread_qos, EncThreadGroup group) {
+    if (!thread_qos) {
+        return SVT_THREAD_PRIORITY_NORMAL;
+    }
+    if (!enc_thread_group_latency_critical[group]) {
+        return SVT_THREAD_PRIORITY_LOW;
+    }
+    return thread_qos == 2 ? SVT_THREAD_PRIORITY_REALTIME : SVT_THREAD_PRIORITY_HIGH;
+}
+
+// Apply the core set (thread_affinity) and the scheduler priority (thread_qos)
+// of each thread group to the per-stage threads
+static void setup_thread_groups(EbEncHandle* enc_handle_ptr) {
+    const SequenceControlSet* scs      = enc_handle_ptr->scs_instance->scs;
+    const EncThreadAffinity*  affinity = &enc_handle_ptr->thread_affinity;
+    const struct {
+        EncThreadGroup group;
+        EbHandle*      threads;
+        uint32_t       count;
+    } groups[] = {
+        {ENC_THREAD_GROUP_RESOURCE_COORDINATION, &enc_handle_ptr->resource_coordination_thread_handle, 1},
+        {ENC_THREAD_GROUP_PICTURE_ANALYSIS,
+         enc_handle_ptr->picture_analysis_thread_handle_array,
+         scs->picture_analysis_process_init_count},
+        {ENC_THREAD_GROUP_PICTURE_DECISION, &enc_handle_ptr->picture_decision_thread_handle, 1},
+        {ENC_THREAD_GROUP_MOTION_ESTIMATION,
+         enc_handle_ptr->motion_estimation_thread_handle_array,
+         scs->motion_estimation_process_init_count},
+        {ENC_THREAD_GROUP_INITIAL_RATE_CONTROL, &enc_handle_ptr->initial_rate_control_thread_handle, 1},
+        {ENC_THREAD_GROUP_SOURCE_BASED_OPERATIONS,
+         enc_handle_ptr->source_based_operations_thread_handle_array,
+         scs->source_based_operations_process_init_count},
+        {ENC_THREAD_GROUP_TPL_DISP, enc_handle_ptr->tpl_disp_thread_handle_array, scs->tpl_disp_process_init_count},
+        {ENC_THREAD_GROUP_PICTURE_MANAGER, &enc_handle_ptr->picture_manager_thread_handle, 1},
+        {ENC_THREAD_GROUP_RATE_CONTROL, &enc_handle_ptr->rate_control_thread_handle, 1},
+        {ENC_THREAD_GROUP_MODE_DECISION_CONFIGURATION,
+         enc_handle_ptr->mode_decision_configuration_thread_handle_array,
+         scs->mode_decision_configuration_process_init_count},
+        {ENC_THREAD_GROUP_ENC_DEC, enc_handle_ptr->enc_dec_thread_handle_array, scs->enc_dec_process_init_count},
+        {ENC_THREAD_GROUP_ENTROPY_CODING,
+         enc_handle_ptr->entropy_coding_thread_handle_array,
+         scs->entropy_coding_process_init_count},
+        {ENC_THREAD_GROUP_DLF, enc_handle_ptr->dlf_thread_handle_array, scs->dlf_process_init_count},
+        {ENC_THREAD_GROUP_CDEF, enc_handle_ptr->cdef_thread_handle_array, scs->cdef_process_init_count},
+        {ENC_THREAD_GROUP_REST, enc_handle_ptr->rest_thread_handle_array, scs->rest_process_init_count},
+        {ENC_THREAD_GROUP_PACKETIZATION, &enc_handle_ptr->packetization_thread_handle, 1},
+    };
+    bool raise_refused = false;
+
+    for (size_t i = 0; i < sizeof(groups) / sizeof(groups[0]); i++) {
+        const EncThreadGroup    group    = groups[i].group;
+        const SvtThreadPriority priority = get_thread_group_priority(scs->static_config.thread_qos, group);
+        bool                    pinned   = affinity->is_set[group];
+        for (uint32_t t = 0; t < groups[i].count; t++) {
+            const EbHandle thread = groups[i].threads[t];
+            if (pinned && !svt_set_thread_handle_affinity(thread, &affinity->cpus[group])) {
+                SVT_WARN("Failed to set the affinity of the %s threads\n", enc_thread_group_names[group]);
+                pinned = false;
+            }
+            if (priority != SVT_THREAD_PRIORITY_NORMAL && !svt_set_thread_handle_priority(thread, priority)) {
+                // Raising needs privileges: step down to the next level
+                if (priority != SVT_THREAD_PRIORITY_REALTIME ||
+                    !svt_set_thread_handle_priority(thread, SVT_THREAD_PRIORITY_HIGH)) {
+                    raise_refused = true;
+                }
+            }
+        }
+    }
+    if (raise_refused) {
+        SVT_INFO("thread_qos: raising latency-critical stages is not permitted, only bulk stages are lowered\n");
+    }
+}
+
+// Group core sets and thread_qos only apply to dedicated per-stage threads
+static void check_thread_group_settings_unused(const EbEncHandle* enc_handle_ptr) {
+    if (enc_handle_ptr->scs_instance->scs->static_config.thread_qos) {
+        SVT_WARN("thread_qos needs per-stage threads and is ignored\n");
+    }
+    if (enc_handle_ptr->scs_instance->scs->static_config.pipeline_profile) {
+        SVT_WARN("pipeline_profile needs per-stage threads and is ignored\n");
+    }
+    for (uint32_t group = ENC_THREAD_GROUP_ALL + 1; group < ENC_THREAD_GROUP_COUNT; group++) {
+        if (enc_handle_ptr->thread_affinity.is_set[group]) {
+            SVT_WARN("thread_affinity: per-group core sets need per-stage threads, only the default set is used\n");
+            return;
+        }
+    }
+}
+
+// Profile every stage on the consumers of its input resource
+static EbErrorType setup_pipeline_profiler(EbEncHandle* enc_handle_ptr) {
+    const struct {
+        EncThreadGroup    group;
+        EbSystemResource* input;
+    } stages[] = {
+        {ENC_THREAD_GROUP_RESOURCE_COORDINATION, enc_handle_ptr->input_cmd_resource_ptr},
+        {ENC_THREAD_GROUP_PICTURE_ANALYSIS, enc_handle_ptr->resource_coordination_results_resource_ptr},
+        {ENC_THREAD_GROUP_PICTURE_DECISION, enc_handle_ptr->picture_analysis_results_resource_ptr},
+        {ENC_THREAD_GROUP_MOTION_ESTIMATION, enc_handle_ptr->picture_decision_results_resource_ptr},
+        {ENC_THREAD_GROUP_INITIAL_RATE_CONTROL, enc_handle_ptr->motion_estimation_results_resource_ptr},
+        {ENC_THREAD_GROUP_SOURCE_BASED_OPERATIONS, enc_handle_ptr->initial_rate_control_results_resource_ptr},
+        {ENC_THREAD_GROUP_TPL_DISP, enc_handle_ptr->tpl_disp_res_srm},
+        {ENC_THREAD_GROUP_PICTURE_MANAGER, enc_handle_ptr->picture_demux_results_resource_ptr},
+        {ENC_THREAD_GROUP_RATE_CONTROL, enc_handle_ptr->rate_control_tasks_resource_ptr},
+        {ENC_THREAD_GROUP_MODE_DECISION_CONFIGURATION, enc_handle_ptr->rate_control_results_resource_ptr},
+        {ENC_THREAD_GROUP_ENC_DEC, enc_handle_ptr->enc_dec_tasks_resource_ptr},
+        {ENC_THREAD_GROUP_DLF, enc_handle_ptr->enc_dec_results_resource_ptr},
+        {ENC_THREAD_GROUP_CDEF, enc_handle_ptr->dlf_results_resource_ptr},
+        {ENC_THREAD_GROUP_REST, enc_handle_ptr->cdef_results_resource_ptr},
+        {ENC_THREAD_GROUP_ENTROPY_CODING, enc_handle_ptr->rest_results_resource_ptr},
+        {ENC_THREAD_GROUP_PACKETIZATION, enc_handle_ptr->entropy_coding_results_resource_ptr},
+    };
+    const uint8_t level = enc_handle_ptr->scs_instance->scs->static_config.pipeline_profile;
+    EB_NEW(enc_handle_ptr->profiler, svt_pipeline_profiler_ctor, level == 2);
+    for (size_t i = 0; i < sizeof(stages) / sizeof(stages[0]); i++) {
+        EbErrorType return_error = svt_pipeline_profiler_add_stage(
+            enc_handle_ptr->profiler, enc_thread_group_names[stages[i].group], stages[i].input);
+        if (return_error != EB_ErrorNone) {
+            return return_error;
+        }
+    }
+    return EB_ErrorNone;
+}
+
+// Consumer resource and process count of each stage that runs several
+// worker threads; THREAD_SCALE_EVENT parks and resumes these workers
+#define ENC_HANDLE_SCALABLE_STAGES(X)                                                         \
+    X(resource_coordination_results_resource_ptr, picture_analysis_process_init_count);       \
+    X(picture_decision_results_resource_ptr, motion_estimation_process_init_count);           \
+    X(initial_rate_control_results_resource_ptr, source_based_operations_process_init_count); \
+    X(tpl_disp_res_srm, tpl_disp_process_init_count);                                         \
+    X(rate_control_results_resource_ptr, mode_decision_configuration_process_init_count);     \
+    X(enc_dec_tasks_resource_ptr, enc_dec_process_init_count);                                \
+    X(enc_dec_results_resource_ptr, dlf_process_init_count);                                  \
+    X(dlf_results_resource_ptr, cdef_process_init_count);                                     \
+    X(cdef_results_resource_ptr, rest_process_init_count);                                    \
+    X(rest_results_resource_ptr, entropy_coding_process_init_count);
+
+// Keep active_percent of the workers created for each multi-threaded stage
+static void set_active_worker_percent(EbEncHandle* enc_handle_ptr, uint32_t active_percent) {
+    const SequenceControlSet* scs = enc_handle_ptr->scs_instance->scs;
+#define SRM_SET_ACTIVE(member, count)                                                       \
+    if (scs->count > 1) {                                                                   \
+        svt_system_resource_set_active_consumers(enc_handle_ptr->member,                    \
+                                                 (scs->count * active_percent + 99) / 100); \
+    }
+    ENC_HANDLE_SCALABLE_STAGES(SRM_SET_ACTIVE);
+#undef SRM_SET_ACTIVE
+}
+
 void    svt_aom_asm_set_convolve_asm_table(void);
 void    svt_aom_asm_set_convolve_hbd_asm_table(void);
 void    svt_aom_init_intra_dc_predictors_c_internal(void);
@@ -222,6 +473,24 @@ static uint32_t get_default_level_of_parallelism(uint32_t core_count) {
     return PARALLEL_LEVEL_6;
 }
 
+#if CONFIG_KERNEL_POOL
+// Workers allowed to run kernels concurrently in kernel pool mode: the largest
+// core count that maps to this lp by default, capped by the available cores.
+static uint32_t get_kernel_pool_workers(uint32_t lp, uint32_t core_count) {
+    static const uint32_t lp_cores[PARALLEL_LEVEL_COUNT] = {0,
+                                                            PARALLEL_LEVEL_1_RANGE,
+                                                            PARALLEL_LEVEL_2_RANGE,
+                                                            PARALLEL_LEVEL_3_RANGE,
+                                                            PARALLEL_LEVEL_4_RANGE,
+                                                            PARALLEL_LEVEL_5_RANGE,
+                                                            PARALLEL_LEVEL_6_RANGE};
+    if (lp >= PARALLEL_LEVEL_6) {
+        return core_count;
+    }
+    return MAX(MIN(lp_cores[lp], core_count), 1);
+}
+#endif
+
 //return max wavefronts in a given picture
 static uint32_t get_max_wavefronts(uint32_t width, uint32_t height, uint32_t blk_size) {
     assert(width > 0 && height > 0);
@@ -310,7 +579,7 @@ void set_segments_numbers(SequenceControlSet* scs) {
 
 static EbErrorType load_default_buffer_configuration_settings(SequenceControlSet* scs) {
     EbErrorType return_error = EB_ErrorNone;
-    uint32_t    core_count   = get_num_processors();
+    uint32_t    core_count   = get_handle_processors(&scs->static_config);
 
     uint32_t lp = scs->static_config.level_of_parallelism;
     if (lp == 0) {
@@ -455,6 +724,16 @@ static EbErrorType load_default_buffer_configuration_settings(SequenceControlSet
     max_paref        = min_paref + (1 + mg_size) * n_extra_mg;
     max_me           = min_me + (1 + mg_size) * n_extra_mg;
     max_recon        = max_ref;
+    // pool_headroom keeps only part of the pictures in flight on top of the minimum
+    if (scs->static_config.pool_headroom < 100) {
+        const uint32_t headroom = scs->static_config.pool_headroom;
+        max_input               = min_input + (max_input - min_input) * headroom / 100;
+        max_parent              = max_input;
+        max_ref                 = min_ref + (max_ref - min_ref) * headroom / 100;
+        max_paref               = min_paref + (max_paref - min_paref) * headroom / 100;
+        max_me                  = min_me + (max_me - min_me) * headroom / 100;
+        max_recon               = max_ref;
+    }
     // if tpl_la is disabled when super-res fix/random, input speed is much faster than recon output speed,
     // recon_output_fifo might be full and freeze at svt_aom_recon_output()
     if (!scs->tpl && scs->static_config.recon_enabled) {
@@ -515,6 +794,11 @@ static EbErrorType load_default_buffer_configuration_settings(SequenceControlSet
             clamp(pcs_processes, min_child, max_child) + superres_count;
     }
 
+    if (scs->child_pool_cap) {
+        scs->picture_control_set_pool_init_count_child = scs->enc_dec_pool_init_count = MIN(
+            scs->picture_control_set_pool_init_count_child, scs->child_pool_cap);
+    }
+
     if (scs->static_config.avif) {
         scs->input_buffer_fifo_init_count              = 4;
         scs->picture_control_set_pool_init_count       = 4;
@@ -713,9 +997,37 @@ static EbErrorType load_default_buffer_configuration_settings(SequenceControlSet
         scs->total_process_init_count += (scs->rest_process_init_count = clamp(10, 1, max_rest_proc));
     }
 #undef WORKERS_COUNT
+#if CONFIG_KERNEL_POOL
+    // Dispatch-workers mode: no stage needs more instances than there are workers
+    // to run them, which also bounds the per-instance context memory.
+    if (lp > PARALLEL_LEVEL_1 && scs->static_config.dispatch_workers) {
+        const uint32_t n = scs->static_config.dispatch_workers;
+        scs->total_process_init_count = 0;
+        scs->total_process_init_count += (scs->picture_analysis_process_init_count = MIN(
+                                              scs->picture_analysis_process_init_count, n));
+        scs->total_process_init_count += (scs->motion_estimation_process_init_count = MIN(
+                                              scs->motion_estimation_process_init_count, n));
+        scs->total_process_init_count += (scs->source_based_operations_process_init_count = MIN(
+                                              scs->source_based_operations_process_init_count, n));
+        scs->total_process_init_count += (scs->tpl_disp_process_init_count = MIN(scs->tpl_disp_process_init_count,
+                                                                                  n));
+        scs->total_process_init_count += (scs->mode_decision_configuration_process_init_count = MIN(
+                                              scs->mode_decision_configuration_process_init_count, n));
+        scs->total_process_init_count += (scs->enc_dec_process_init_count = MIN(scs->enc_dec_process_init_count, n));
+        scs->total_process_init_count += (scs->entropy_coding_process_init_count = MIN(
+                                              scs->entropy_coding_process_init_count, n));
+        scs->total_process_init_count += (scs->dlf_process_init_count = MIN(scs->dlf_process_init_count, n));
+        scs->total_process_init_count += (scs->cdef_process_init_count = MIN(scs->cdef_process_init_count, n));
+        scs->total_process_init_count += (scs->rest_process_init_count = MIN(scs->rest_process_init_count, n));
+    }
+#endif
     scs->total_process_init_count += 6; // single processes count
+    return return_error;
+}
+
+static void print_buffer_configuration(SequenceControlSet* scs) {
     if (scs->static_config.pass == 0 || scs->static_config.pass == 2) {
-        SVT_INFO("Level of Parallelism: %u\n", lp);
+        SVT_INFO("Level of Parallelism: %u\n", scs->lp);
         SVT_INFO("Number of PPCS %u\n", scs->picture_control_set_pool_init_count);
 
         /******************************************************************
@@ -733,7 +1045,180 @@ static EbErrorType load_default_buffer_configuration_settings(SequenceControlSet
         SVT_INFO("[asm level selected : up to %s]\n", get_asm_level_name_str(scs->static_config.use_cpu_flags));
 #endif
     }
-    return return_error;
+}
+
+// Single-threaded and low delay encodes start and encode the pictures in
+// decode order
+static void set_dec_order(SequenceControlSet* scs) {
+    // Enforce starting frame in decode order (at PicMgr)
+    // Does not wait for feedback from PKT
+    if (scs->static_config.level_of_parallelism == 1 || scs->static_config.pred_structure == LOW_DELAY) {
+        scs->enable_pic_mgr_dec_order = 1;
+    } else {
+        scs->enable_pic_mgr_dec_order = 0;
+    }
+    // Enforce encoding frame in decode order
+    // Wait for feedback from PKT
+#if RC_NO_R2R
+    scs->enable_dec_order = 1;
+#else
+    if (scs->static_config.level_of_parallelism == 1 || scs->static_config.pred_structure == LOW_DELAY) {
+        scs->enable_dec_order = 1;
+    } else {
+        scs->enable_dec_order = 0;
+    }
+#endif
+}
+
+/*
+ * Approximate size of the picture pools, from the per-picture sizes of each pool
+ * measured from 480p to 4K and expressed in sixteenths of a padded luma plane.
+ * The child picture control set and ME buffers grow with the search depth of
+ * the slower presets.
+ */
+static uint64_t estimate_pool_memory(const SequenceControlSet* scs) {
+    const uint64_t luma    = (uint64_t)(scs->max_input_luma_width + 160) * (scs->max_input_luma_height + 160);
+    const uint64_t bytes   = scs->static_config.encoder_bit_depth > EB_EIGHT_BIT ? 2 : 1;
+    const EncMode  mode    = scs->static_config.enc_mode;
+    const uint64_t input   = 8 * bytes; // luma lives in the y8b pool
+    const uint64_t y8b     = 16;
+    const uint64_t pa_ref  = 5;
+    // Compact references keep their 2 bit planes in a quarter of the size
+    const uint64_t ref     = 26 * bytes + 2 - (bytes > 1 && scs->static_config.compact_refs ? 18 : 0);
+    const uint64_t tpl_ref = 14;
+    const uint64_t me      = mode <= ENC_M4 ? 23 : 12;
+    const uint64_t ppcs    = 1;
+    const uint64_t pcs     = mode <= ENC_M2 ? 288 : mode <= ENC_M4 ? 160 : 100;
+    const uint64_t enc_dec = 56 + 56 * bytes;
+
+    const uint64_t units = input * (scs->input_buffer_fifo_init_count + scs->overlay_input_picture_buffer_init_count) +
+        y8b * MAX(scs->input_buffer_fifo_init_count, scs->pa_reference_picture_buffer_init_count) +
+        pa_ref * scs->pa_reference_picture_buffer_init_count + ref * scs->reference_picture_buffer_init_count +
+        tpl_ref * scs->tpl_reference_picture_buffer_init_count + me * scs->me_pool_init_count +
+        ppcs * scs->picture_control_set_pool_init_count + pcs * scs->picture_control_set_pool_init_count_child +
+        enc_dec * scs->enc_dec_pool_init_count;
+    return units * luma / 16;
+}
+
+/*
+ * Approximate size of the per-thread contexts. Each encode-decode instance owns
+ * a mode decision context sized for a superblock, which dominates them: measured
+ * in bytes per superblock pixel, it depends on the preset and bit depth but not
+ * on the resolution. The contexts of the other stages are a few hundred KiB.
+ */
+static uint64_t estimate_context_memory(const SequenceControlSet* scs) {
+    const EncMode  mode   = scs->static_config.enc_mode;
+    const uint64_t sb_px  = (uint64_t)scs->super_block_size * scs->super_block_size;
+    const uint64_t md_ctx = (mode <= ENC_M0 ? 4300
+                             : mode <= ENC_M3 ? 2500
+                             : mode <= ENC_M5 ? 2150
+                             : mode <= ENC_M8 ? 1100
+                             : mode <= ENC_M9 ? 870
+                                              : 560) +
+        (scs->static_config.encoder_bit_depth > EB_EIGHT_BIT ? 140 : 0);
+    return scs->enc_dec_process_init_count * sb_px * md_ctx;
+}
+
+static uint64_t estimate_encoder_memory(const SequenceControlSet* scs) {
+    return estimate_pool_memory(scs) + estimate_context_memory(scs);
+}
+
+static uint32_t to_mib(uint64_t bytes) {
+    return (uint32_t)((bytes + (1 << 20) - 1) >> 20);
+}
+
+/*
+ * Shrink the picture pools and the thread contexts until their estimated size
+ * fits max_memory_mb. Each step gives up more than the one before: extra
+ * pictures in flight, pictures encoded in parallel, the level of parallelism,
+ * the look-ahead beyond the TPL window and finally the TPL window beyond the
+ * current mini-GOP, as done for 8K inputs. Fails when the shortest pipeline
+ * still does not fit. Against what svt_av1_enc_init() allocates, the estimates
+ * run up to 5% short from 240p to 1080p, so the pipeline is fit to 15/16 of
+ * the budget; check_memory_budget() holds init to the whole of it.
+ */
+static EbErrorType fit_memory_budget(SequenceControlSet* scs) {
+    EbSvtAv1EncConfiguration* config  = &scs->static_config;
+    const uint64_t            budget  = ((uint64_t)config->max_memory_mb << 20) / 16 * 15;
+    const uint32_t            mg_size = 1 << config->hierarchical_levels;
+    EbErrorType               ret     = EB_ErrorNone;
+    uint64_t                  size    = estimate_encoder_memory(scs);
+
+    if (size <= budget) {
+        return EB_ErrorNone;
+    }
+    const uint32_t requested = to_mib(size);
+
+    const uint8_t headroom = config->pool_headroom;
+    while (config->pool_headroom && size > budget && ret == EB_ErrorNone) {
+        config->pool_headroom = config->pool_headroom > 10 ? config->pool_headroom - 10 : 0;
+        ret                   = load_default_buffer_configuration_settings(scs);
+        size                  = estimate_encoder_memory(scs);
+    }
+    if (to_mib(size) == requested) {
+        // The level of parallelism keeps no extra pictures in flight
+        config->pool_headroom = headroom;
+        ret                   = load_default_buffer_configuration_settings(scs);
+    } else if (config->pool_headroom != headroom) {
+        SVT_WARN("max_memory_mb: pool_headroom lowered from %u to %u\n", headroom, config->pool_headroom);
+    }
+
+    // Keep two so that a superres recode still has a picture control set to use
+    const uint32_t child = scs->picture_control_set_pool_init_count_child;
+    while (scs->picture_control_set_pool_init_count_child > 2 && size > budget && ret == EB_ErrorNone) {
+        scs->child_pool_cap = scs->picture_control_set_pool_init_count_child - 1;
+        ret                 = load_default_buffer_configuration_settings(scs);
+        size                = estimate_encoder_memory(scs);
+    }
+    if (scs->picture_control_set_pool_init_count_child != child) {
+        SVT_WARN("max_memory_mb: %u pictures encoded in parallel instead of %u\n",
+                 scs->picture_control_set_pool_init_count_child,
+                 child);
+    }
+
+    // Fewer threads: every encode-decode instance holds a mode decision context
+    const uint32_t lp = scs->lp;
+    while (scs->lp > PARALLEL_LEVEL_1 && size > budget && ret == EB_ErrorNone) {
+        config->level_of_parallelism = scs->lp - 1;
+        set_dec_order(scs);
+        ret  = load_default_buffer_configuration_settings(scs);
+        size = estimate_encoder_memory(scs);
+    }
+    if (scs->lp != lp) {
+        SVT_WARN("max_memory_mb: level_of_parallelism lowered from %u to %u\n", lp, scs->lp);
+    }
+
+    if (scs->lad_mg > scs->tpl_lad_mg && size > budget && ret == EB_ErrorNone) {
+        const uint32_t look_ahead   = config->look_ahead_distance;
+        scs->lad_mg                 = scs->tpl_lad_mg;
+        config->look_ahead_distance = (1 + mg_size) * (scs->lad_mg + 1) + scs->scd_delay + 1;
+        ret                         = load_default_buffer_configuration_settings(scs);
+        size                        = estimate_encoder_memory(scs);
+        SVT_WARN("max_memory_mb: look_ahead_distance lowered from %u to %u\n", look_ahead, config->look_ahead_distance);
+    }
+
+    if (scs->tpl_lad_mg && size > budget && ret == EB_ErrorNone) {
+        scs->lad_mg = scs->tpl_lad_mg = 0;
+        config->look_ahead_distance   = (1 + mg_size) + scs->scd_delay + 1;
+        ret                           = load_default_buffer_configuration_settings(scs);
+        size                          = estimate_encoder_memory(scs);
+        SVT_WARN("max_memory_mb: TPL limited to the current mini-GOP, look_ahead_distance lowered to %u\n",
+                 config->look_ahead_distance);
+    }
+
+    if (ret != EB_ErrorNone) {
+        return ret;
+    }
+    if (size > budget) {
+        SVT_ERROR("max_memory_mb: the pools and thread contexts need about %u MiB, above the budget of %u MiB\n",
+                  to_mib(size),
+                  config->max_memory_mb);
+        return EB_ErrorBadParameter;
+    }
+    SVT_INFO("max_memory_mb: picture pools and thread contexts lowered from about %u MiB to %u MiB\n",
+             requested,
+             to_mib(size));
+    return EB_ErrorNone;
 }
 
 typedef struct {
@@ -845,6 +1330,9 @@ static void lib_svt_encoder_send_error_exit(EbPtr hComponent, uint32_t error_cod
 
 static void svt_enc_handle_stop_threads(EbEncHandle* enc_handle_ptr) {
     SequenceControlSet* scs = enc_handle_ptr->scs_instance->scs;
+#if CONFIG_SINGLE_THREAD_KERNEL
+    svt_kernel_dispatcher_deinit(&enc_handle_ptr->kernel_dispatcher);
+#endif
     // Resource Coordination
     EB_DESTROY_THREAD(enc_handle_ptr->resource_coordination_thread_handle);
     EB_DESTROY_THREAD_ARRAY(enc_handle_ptr->picture_analysis_thread_handle_array,
@@ -896,12 +1384,37 @@ static void svt_enc_handle_stop_threads(EbEncHandle* enc_handle_ptr) {
     EB_DESTROY_THREAD(enc_handle_ptr->packetization_thread_handle);
 }
 
+// Block geometry table, read-only once built. A handle shares it with the
+// handles cloned from it; the last one to release it frees it.
+typedef struct SharedBlkGeom {
+    volatile uint32_t refs;
+    uint32_t          geom_idx;
+    uint16_t          block_cnt;
+    BlockGeom*        table;
+} SharedBlkGeom;
+
+static SharedBlkGeom* blk_geom_acquire(SharedBlkGeom* shared) {
+    svt_atomic_fetch_add_u32(&shared->refs, 1);
+    return shared;
+}
+
+static void blk_geom_release(SharedBlkGeom** shared) {
+    if (*shared && svt_atomic_fetch_add_u32(&(*shared)->refs, (uint32_t)-1) == 1) {
+        EB_FREE_ARRAY((*shared)->table);
+        EB_FREE(*shared);
+    }
+    *shared = NULL;
+}
+
 /**********************************
 * Encoder Library Handle Deonstructor
 **********************************/
 static void svt_enc_handle_dctor(EbPtr p) {
     EbEncHandle* enc_handle_ptr = (EbEncHandle*)p;
     svt_enc_handle_stop_threads(enc_handle_ptr);
+    EB_DELETE(enc_handle_ptr->profiler);
+    blk_geom_release(&enc_handle_ptr->blk_geom);
+    blk_geom_release(&enc_handle_ptr->clone_blk_geom);
     EB_FREE(enc_handle_ptr->app_callback_ptr);
     EB_DELETE(enc_handle_ptr->scs_pool_ptr);
     EB_DELETE(enc_handle_ptr->picture_parent_control_set_pool_ptr);
@@ -919,7 +1432,10 @@ static void svt_enc_handle_dctor(EbPtr p) {
     //to prevent releasing twice, we need to reset the buffer back to NULL
     if (enc_handle_ptr->input_buffer_resource_ptr) {
         for (uint32_t w_i = 0; w_i < enc_handle_ptr->input_buffer_resource_ptr->object_total_count; ++w_i) {
-            EbObjectWrapper*     wrp  = enc_handle_ptr->input_buffer_resource_ptr->wrapper_ptr_pool[w_i];
+            EbObjectWrapper* wrp = enc_handle_ptr->input_buffer_resource_ptr->wrapper_ptr_pool[w_i];
+            if (!wrp) {
+                continue; // never constructed by a lazy pool
+            }
             EbBufferHeaderType*  obj  = (EbBufferHeaderType*)wrp->object_ptr;
             EbPictureBufferDesc* desc = (EbPictureBufferDesc*)obj->p_buffer;
             desc->y_buffer            = 0;
@@ -1098,6 +1614,11 @@ static EbErrorType rest_results_creator(EbPtr* object_dbl_ptr, EbPtr object_init
     return EB_ErrorNone;
 }
 
+// Objects a picture pool is created with: all of them, or one with lazy_pool_alloc
+static uint32_t pool_initial_count(const SequenceControlSet* scs, uint32_t count) {
+    return scs->static_config.lazy_pool_alloc ? MIN(count, 1) : count;
+}
+
 static int create_pa_ref_buf_descs(EbEncHandle* enc_handle_ptr) {
     SequenceControlSet*             scs = enc_handle_ptr->scs_instance->scs;
     EbPaReferenceObjectDescInitData eb_pa_ref_obj_ect_desc_init_data_structure;
@@ -1152,12 +1673,14 @@ static int create_pa_ref_buf_descs(EbEncHandle* enc_handle_ptr) {
     eb_pa_ref_obj_ect_desc_init_data_structure.static_config                    = &scs->static_config;
     // Reference Picture Buffers
     EB_NEW(enc_handle_ptr->pa_reference_picture_pool_ptr,
-           svt_system_resource_ctor,
+           svt_system_resource_lazy_ctor,
+           pool_initial_count(scs, scs->pa_reference_picture_buffer_init_count),
            scs->pa_reference_picture_buffer_init_count,
            EB_PictureDecisionProcessInitCount,
            0,
            svt_pa_reference_object_creator,
            &(eb_pa_ref_obj_ect_desc_init_data_structure),
+           sizeof(eb_pa_ref_obj_ect_desc_init_data_structure),
            NULL,
            (scs->lp == 1));
     // Set the SequenceControlSet Picture Pool Fifo Ptrs
@@ -1181,7 +1704,8 @@ static int create_tpl_ref_buf_descs(EbEncHandle* enc_handle_ptr) {
     ref_pic_buf_desc_init_data.color_format = EB_YUV420; //use 420 for picture analysis
 
     // Allocate one ref pic to be used in TPL
-    ref_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_Y_FLAG;
+    ref_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_Y_FLAG |
+        svt_aom_huge_page_mask(scs->static_config.huge_pages);
 
     ref_pic_buf_desc_init_data.border            = TPL_PAD;
     ref_pic_buf_desc_init_data.split_mode        = false;
@@ -1222,7 +1746,8 @@ static int create_ref_buf_descs(EbEncHandle* enc_handle_ptr) {
     ref_pic_buf_desc_init_data.max_height          = scs->max_input_luma_height;
     ref_pic_buf_desc_init_data.bit_depth           = scs->encoder_bit_depth;
     ref_pic_buf_desc_init_data.color_format        = scs->static_config.encoder_color_format;
-    ref_pic_buf_desc_init_data.buffer_enable_mask  = PICTURE_BUFFER_DESC_FULL_MASK;
+    ref_pic_buf_desc_init_data.buffer_enable_mask  = PICTURE_BUFFER_DESC_FULL_MASK |
+        svt_aom_huge_page_mask(scs->static_config.huge_pages);
     ref_pic_buf_desc_init_data.rest_units_per_tile = scs->rest_units_per_tile;
     ref_pic_buf_desc_init_data.sb_total_count      = scs->b64_total_count;
     uint16_t padding                               = scs->super_block_size + 32;
@@ -1245,12 +1770,14 @@ static int create_ref_buf_descs(EbEncHandle* enc_handle_ptr) {
     eb_ref_obj_ect_desc_init_data_structure.static_config                    = &scs->static_config;
     // Reference Picture Buffers
     EB_NEW(enc_handle_ptr->reference_picture_pool_ptr,
-           svt_system_resource_ctor,
+           svt_system_resource_lazy_ctor,
+           pool_initial_count(scs, scs->reference_picture_buffer_init_count),
            scs->reference_picture_buffer_init_count,
            EB_PictureManagerProcessInitCount,
            0,
            svt_reference_object_creator,
            &(eb_ref_obj_ect_desc_init_data_structure),
+           sizeof(eb_ref_obj_ect_desc_init_data_structure),
            NULL,
            (scs->lp == 1));
 
@@ -1299,6 +1826,8 @@ static ONCE_ROUTINE(init_global_tables) {
     init_fn_ptr();
     svt_aom_init_iscan();
     svt_aom_build_tx_org();
+    svt_aom_init_qmatrix();
+    svt_av1_init_shared_quantizers();
 #if CONFIG_ENABLE_INTER_COMPOUND
     svt_av1_init_wedge_masks();
 #endif
@@ -1311,13 +1840,155 @@ static ONCE_ROUTINE(init_global_tables) {
 
 DEFINE_ONCE(global_tables_once);
 
+#if CONFIG_SINGLE_THREAD_KERNEL
+/*
+* Register every kernel instance with the dispatcher in pipeline order instead of
+* creating per-stage threads. Each instance consumes the consumer FIFO with the
+* same index as its context, exactly as its dedicated thread would.
+*/
+static void register_dispatch_kernels(EbEncHandle* enc_handle_ptr) {
+    SequenceControlSet*  scs = enc_handle_ptr->scs_instance->scs;
+    SvtKernelDispatcher* d   = &enc_handle_ptr->kernel_dispatcher;
+
+#define DISPATCH_REGISTER(iter_fn, contexts, count, res, name)                                                     \
+    for (uint32_t i = 0; i < (count); i++) {                                                                       \
+        svt_kernel_dispatcher_register(                                                                            \
+            d, iter_fn, (contexts)[i]->priv, svt_system_resource_get_consumer_fifo(enc_handle_ptr->res, i), name); \
+    }
+    DISPATCH_REGISTER(svt_aom_resource_coordination_kernel_iter,
+                      &enc_handle_ptr->resource_coordination_context_ptr,
+                      1,
+                      input_cmd_resource_ptr,
+                      "ResCoord");
+    DISPATCH_REGISTER(svt_aom_picture_analysis_kernel_iter,
+                      enc_handle_ptr->picture_analysis_context_ptr_array,
+                      scs->picture_analysis_process_init_count,
+                      resource_coordination_results_resource_ptr,
+                      "PicAnalysis");
+    DISPATCH_REGISTER(svt_aom_picture_decision_kernel_iter,
+                      &enc_handle_ptr->picture_decision_context_ptr,
+                      1,
+                      picture_analysis_results_resource_ptr,
+                      "PicDecision");
+    DISPATCH_REGISTER(svt_aom_motion_estimation_kernel_iter,
+                      enc_handle_ptr->motion_estimation_context_ptr_array,
+                      scs->motion_estimation_process_init_count,
+                      picture_decision_results_resource_ptr,
+                      "ME");
+    DISPATCH_REGISTER(svt_aom_initial_rate_control_kernel_iter,
+                      &enc_handle_ptr->initial_rate_control_context_ptr,
+                      1,
+                      motion_estimation_results_resource_ptr,
+                      "InitRC");
+    DISPATCH_REGISTER(svt_aom_source_based_operations_kernel_iter,
+                      enc_handle_ptr->source_based_operations_context_ptr_array,
+                      scs->source_based_operations_process_init_count,
+                      initial_rate_control_results_resource_ptr,
+                      "SrcOps");
+    DISPATCH_REGISTER(svt_aom_tpl_disp_kernel_iter,
+                      enc_handle_ptr->tpl_disp_context_ptr_array,
+                      scs->tpl_disp_process_init_count,
+                      tpl_disp_res_srm,
+                      "TPL");
+    DISPATCH_REGISTER(svt_aom_picture_manager_kernel_iter,
+                      &enc_handle_ptr->picture_manager_context_ptr,
+                      1,
+                      picture_demux_results_resource_ptr,
+                      "PicMgr");
+    DISPATCH_REGISTER(svt_aom_rate_control_kernel_iter,
+                      &enc_handle_ptr->rate_control_context_ptr,
+                      1,
+                      rate_control_tasks_resource_ptr,
+                      "RC");
+    DISPATCH_REGISTER(svt_aom_mode_decision_configuration_kernel_iter,
+                      enc_handle_ptr->mode_decision_configuration_context_ptr_array,
+                      scs->mode_decision_configuration_process_init_count,
+                      rate_control_results_resource_ptr,
+                      "MDConfig");
+    DISPATCH_REGISTER(svt_aom_mode_decision_kernel_iter,
+                      enc_handle_ptr->enc_dec_context_ptr_array,
+                      scs->enc_dec_process_init_count,
+                      enc_dec_tasks_resource_ptr,
+                      "EncDec");
+    DISPATCH_REGISTER(svt_aom_dlf_kernel_iter,
+                      enc_handle_ptr->dlf_context_ptr_array,
+                      scs->dlf_process_init_count,
+                      enc_dec_results_resource_ptr,
+                      "DLF");
+    DISPATCH_REGISTER(svt_aom_cdef_kernel_iter,
+                      enc_handle_ptr->cdef_context_ptr_array,
+                      scs->cdef_process_init_count,
+                      dlf_results_resource_ptr,
+                      "CDEF");
+    DISPATCH_REGISTER(svt_aom_rest_kernel_iter,
+                      enc_handle_ptr->rest_context_ptr_array,
+                      scs->rest_process_init_count,
+                      cdef_results_resource_ptr,
+                      "Rest");
+    DISPATCH_REGISTER(svt_aom_entropy_coding_kernel_iter,
+                      enc_handle_ptr->entropy_coding_context_ptr_array,
+                      scs->entropy_coding_process_init_count,
+                      rest_results_resource_ptr,
+                      "EC");
+    DISPATCH_REGISTER(svt_aom_packetization_kernel_iter,
+                      &enc_handle_ptr->packetization_context_ptr,
+                      1,
+                      entropy_coding_results_resource_ptr,
+                      "Pack");
+#undef DISPATCH_REGISTER
+}
+#endif
+
+// Use the table of the handle this one was cloned from when it has the
+// geometry of this configuration, else build one
+static EbErrorType blk_geom_init(EbEncHandle* enc_handle_ptr) {
+    SequenceControlSet* scs   = enc_handle_ptr->scs_instance->scs;
+    SharedBlkGeom*      clone = enc_handle_ptr->clone_blk_geom;
+    blk_geom_release(&enc_handle_ptr->blk_geom);
+    if (clone && clone->geom_idx == scs->svt_aom_geom_idx && clone->block_cnt == scs->max_block_cnt) {
+        enc_handle_ptr->blk_geom       = clone;
+        enc_handle_ptr->clone_blk_geom = NULL;
+    } else {
+        blk_geom_release(&enc_handle_ptr->clone_blk_geom);
+        SharedBlkGeom* shared;
+        EB_MALLOC(shared, sizeof(*shared));
+        EB_MALLOC_ARRAY(shared->table, scs->max_block_cnt);
+        svt_aom_build_blk_geom(scs->svt_aom_geom_idx, shared->table);
+        shared->refs             = 1;
+        shared->geom_idx         = scs->svt_aom_geom_idx;
+        shared->block_cnt        = scs->max_block_cnt;
+        enc_handle_ptr->blk_geom = shared;
+    }
+    scs->blk_geom_mds = enc_handle_ptr->blk_geom->table;
+    return EB_ErrorNone;
+}
+
+// The shared quantizers, or storage for the ones sharpness makes depend on
+// the first picture, built by initial rate control
+static EbErrorType init_quantizers(SequenceControlSet* scs) {
+    EncodeContext* enc_ctx  = scs->enc_ctx;
+    const bool     ten_bit  = SVT_EFFECTIVE_BIT_DEPTH(scs->static_config.encoder_bit_depth) == EB_TEN_BIT;
+    const int      bd_index = ten_bit ? 1 : 0;
+    EB_FREE_ALIGNED_ARRAY(enc_ctx->stream_quants);
+    EB_FREE_ALIGNED_ARRAY(enc_ctx->stream_deq);
+    if (scs->static_config.sharpness) {
+        EB_MALLOC_ALIGNED_ARRAY(enc_ctx->stream_quants, 2);
+        EB_MALLOC_ALIGNED_ARRAY(enc_ctx->stream_deq, 2);
+        enc_ctx->quants_8bit = &enc_ctx->stream_quants[0];
+        enc_ctx->deq_8bit    = &enc_ctx->stream_deq[0];
+        enc_ctx->quants_bd   = &enc_ctx->stream_quants[bd_index];
+        enc_ctx->deq_bd      = &enc_ctx->stream_deq[bd_index];
+    } else {
+        svt_av1_get_shared_quantizer(EB_EIGHT_BIT, &enc_ctx->quants_8bit, &enc_ctx->deq_8bit);
+        svt_av1_get_shared_quantizer(ten_bit ? EB_TEN_BIT : EB_EIGHT_BIT, &enc_ctx->quants_bd, &enc_ctx->deq_bd);
+    }
+    return EB_ErrorNone;
+}
+
 /**********************************
 * Initialize Encoder Library
 **********************************/
-EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
-    if (svt_enc_component == NULL) {
-        return EB_ErrorBadParameter;
-    }
+static EbErrorType init_encoder_pipeline(EbComponentType* svt_enc_component) {
     EbEncHandle*        enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
     EbErrorType         return_error   = EB_ErrorNone;
     SequenceControlSet* scs            = enc_handle_ptr->scs_instance->scs;
@@ -1328,9 +1999,15 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
     svt_aom_setup_rtcd_internal(scs->static_config.use_cpu_flags);
     svt_run_once(&global_tables_once, init_global_tables);
 
-    // Per-instance block geometry table allocation
-    EB_MALLOC_ARRAY(scs->blk_geom_mds, scs->max_block_cnt);
-    svt_aom_build_blk_geom(scs->svt_aom_geom_idx, scs->blk_geom_mds);
+    // Per-instance block geometry table, shared with the source of a clone
+    return_error = blk_geom_init(enc_handle_ptr);
+    if (return_error != EB_ErrorNone) {
+        return return_error;
+    }
+    return_error = init_quantizers(scs);
+    if (return_error != EB_ErrorNone) {
+        return return_error;
+    }
     /************************************
      * Sequence Control Set
      ************************************/
@@ -1391,18 +2068,26 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         input_data.static_config       = scs->static_config;
         input_data.allintra            = scs->allintra;
         input_data.use_flat_ipp        = scs->static_config.rtc && scs->static_config.hierarchical_levels == 0;
+        input_data.me_field_blocks     = 0;
+        if (scs->enc_ctx->me_field_sink.write) {
+            input_data.me_field_blocks = scs->enc_ctx->me_field_sink.all_blocks ? SVT_AV1_ME_FIELD_BLOCKS : 1;
+        }
+        svt_mem_category_enter(SVT_AV1_MEMORY_PICTURES);
         EB_NEW(enc_handle_ptr->picture_parent_control_set_pool_ptr,
-               svt_system_resource_ctor,
+               svt_system_resource_lazy_ctor,
+               pool_initial_count(scs, scs->picture_control_set_pool_init_count),
                scs->picture_control_set_pool_init_count, //enc_handle_ptr->pcs_pool_total_count,
                1,
                0,
                svt_aom_picture_parent_control_set_creator,
                &input_data,
+               sizeof(input_data),
                NULL,
                single_thread);
 #if SRM_REPORT
         enc_handle_ptr->picture_parent_control_set_pool_ptr->empty_queue->log = 0;
 #endif
+        svt_mem_category_enter(SVT_AV1_MEMORY_ME_CONTEXTS);
         EB_NEW(enc_handle_ptr->me_pool_ptr,
                svt_system_resource_ctor,
                scs->me_pool_init_count,
@@ -1453,6 +2138,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         input_data.rtc_tune     = scs->static_config.rtc;
         input_data.allintra     = scs->allintra;
         input_data.use_flat_ipp = scs->static_config.rtc && scs->static_config.hierarchical_levels == 0;
+        svt_mem_category_enter(SVT_AV1_MEMORY_PICTURES);
         EB_NEW(enc_handle_ptr->enc_dec_pool_ptr,
                svt_system_resource_ctor,
                scs->enc_dec_pool_init_count, //EB_PictureControlSetPoolInitCountChild,
@@ -1500,12 +2186,14 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         input_data.allintra     = scs->allintra;
         input_data.use_flat_ipp = scs->static_config.rtc && scs->static_config.hierarchical_levels == 0;
         EB_NEW(enc_handle_ptr->picture_control_set_pool_ptr,
-               svt_system_resource_ctor,
+               svt_system_resource_lazy_ctor,
+               pool_initial_count(scs, scs->picture_control_set_pool_init_count_child),
                scs->picture_control_set_pool_init_count_child, //EB_PictureControlSetPoolInitCountChild,
                1,
                0,
                svt_aom_picture_control_set_creator,
                &input_data,
+               sizeof(input_data),
                NULL,
                single_thread);
     }
@@ -1547,6 +2235,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
             (PictureControlSet*)enc_handle_ptr->picture_control_set_pool_ptr->wrapper_ptr_pool[0]->object_ptr;
         scs->rest_units_per_tile = pcs->rst_info[0 /*Y-plane*/].units_per_tile;
         scs->b64_total_count     = pcs->b64_total_count;
+        svt_mem_category_enter(SVT_AV1_MEMORY_REFERENCES);
         create_ref_buf_descs(enc_handle_ptr);
         if (scs->tpl) {
             create_tpl_ref_buf_descs(enc_handle_ptr);
@@ -1556,6 +2245,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
 
         if (scs->static_config.enable_overlays) {
             // Overlay Input Picture Buffers
+            svt_mem_category_enter(SVT_AV1_MEMORY_PICTURES);
             EB_NEW(enc_handle_ptr->overlay_input_picture_pool_ptr,
                    svt_system_resource_ctor,
                    scs->overlay_input_picture_buffer_init_count,
@@ -1574,6 +2264,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
     * System Resource Managers & Fifos
     ************************************/
     //SRM to link App to Ress-Coordination via Input commands. an Input Command holds 2 picture buffers: y8bit and rest(uv8b + yuv2b)
+    svt_mem_category_enter(SVT_AV1_MEMORY_OTHER);
     EB_NEW(enc_handle_ptr->input_cmd_resource_ptr,
            svt_system_resource_ctor,
            scs->resource_coordination_fifo_init_count,
@@ -1586,14 +2277,17 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
     enc_handle_ptr->input_cmd_producer_fifo_ptr = svt_system_resource_get_producer_fifo(
         enc_handle_ptr->input_cmd_resource_ptr, 0);
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_PICTURES);
     //Picture Buffer SRM to hold (uv8b + yuv2b)
     EB_NEW(enc_handle_ptr->input_buffer_resource_ptr,
-           svt_system_resource_ctor,
+           svt_system_resource_lazy_ctor,
+           pool_initial_count(scs, scs->input_buffer_fifo_init_count),
            scs->input_buffer_fifo_init_count,
            1,
            0, //1/2 SRM; no consumer FIFO
            svt_input_buffer_header_creator,
            scs,
+           0,
            svt_input_buffer_header_destroyer,
            single_thread);
     enc_handle_ptr->input_buffer_producer_fifo_ptr = svt_system_resource_get_producer_fifo(
@@ -1601,12 +2295,14 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
 
     //Picture Buffer SRM to hold y8b to be shared by Pcs->enhanced and Pa_ref
     EB_NEW(enc_handle_ptr->input_y8b_buffer_resource_ptr,
-           svt_system_resource_ctor,
+           svt_system_resource_lazy_ctor,
+           pool_initial_count(scs, MAX(scs->input_buffer_fifo_init_count, scs->pa_reference_picture_buffer_init_count)),
            MAX(scs->input_buffer_fifo_init_count, scs->pa_reference_picture_buffer_init_count),
            1,
            0, //1/2 SRM; no consumer FIFO
            svt_input_y8b_creator,
            scs,
+           0,
            svt_input_y8b_destroyer,
            single_thread);
 
@@ -1616,6 +2312,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
     enc_handle_ptr->input_y8b_buffer_producer_fifo_ptr = svt_system_resource_get_producer_fifo(
         enc_handle_ptr->input_y8b_buffer_resource_ptr, 0);
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_ENTROPY);
     // EbBufferHeaderType Output Stream
     {
         EB_NEW(enc_handle_ptr->output_stream_buffer_resource_ptr,
@@ -1630,6 +2327,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
     }
     enc_handle_ptr->output_stream_buffer_consumer_fifo_ptr = svt_system_resource_get_consumer_fifo(
         enc_handle_ptr->output_stream_buffer_resource_ptr, 0);
+    svt_mem_category_enter(SVT_AV1_MEMORY_PICTURES);
     if (scs->static_config.recon_enabled) {
         // EbBufferHeaderType Output Recon
         {
@@ -1647,6 +2345,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
             enc_handle_ptr->output_recon_buffer_resource_ptr, 0);
     }
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_OTHER);
     // Resource Coordination Results
     {
         ResourceCoordinationResultInitData resource_coordination_result_init_data;
@@ -1914,6 +2613,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
            enc_handle_ptr,
            scs->calc_hist);
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_ME_CONTEXTS);
     // Motion Analysis Context
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->motion_estimation_context_ptr_array, scs->motion_estimation_process_init_count);
     for (uint32_t process_index = 0; process_index < scs->motion_estimation_process_init_count; process_index++) {
@@ -1923,6 +2623,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                process_index);
     }
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_OTHER);
     // Initial Rate Control Context
     EB_NEW(enc_handle_ptr->initial_rate_control_context_ptr,
            svt_aom_initial_rate_control_context_ctor,
@@ -1940,6 +2641,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                pic_mgr_port_lookup(pic_mgr_ports, PIC_MGR_INPUT_PORT_SOP, process_index));
     }
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_TPL);
     // TPL dispenser
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->tpl_disp_context_ptr_array, scs->tpl_disp_process_init_count);
     for (uint32_t process_index = 0; process_index < scs->tpl_disp_process_init_count; process_index++) {
@@ -1950,6 +2652,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                tpl_port_lookup(tpl_ports, TPL_INPUT_PORT_TPL, process_index));
     }
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_OTHER);
     // Picture Manager Context
     EB_NEW(enc_handle_ptr->picture_manager_context_ptr,
            svt_aom_picture_manager_context_ctor,
@@ -1963,6 +2666,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
            enc_handle_ptr,
            EB_PictureDecisionProcessInitCount); // me_port_index
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_MD_CONTEXTS);
     // Mode Decision Configuration Contexts
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->mode_decision_configuration_context_ptr_array,
                        scs->mode_decision_configuration_process_init_count);
@@ -1985,6 +2689,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                enc_dec_port_lookup(enc_dec_ports, ENCDEC_INPUT_PORT_ENCDEC, process_index));
     }
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_OTHER);
     // Dlf Contexts
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->dlf_context_ptr_array, scs->dlf_process_init_count);
     for (uint32_t process_index = 0; process_index < scs->dlf_process_init_count; process_index++) {
@@ -2013,6 +2718,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                pic_mgr_port_lookup(pic_mgr_ports, PIC_MGR_INPUT_PORT_REST, process_index));
     }
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_ENTROPY);
     // Entropy Coding Contexts
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->entropy_coding_context_ptr_array, scs->entropy_coding_process_init_count);
     for (uint32_t process_index = 0; process_index < scs->entropy_coding_process_init_count; process_index++) {
@@ -2022,6 +2728,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                process_index);
     }
 
+    svt_mem_category_enter(SVT_AV1_MEMORY_OTHER);
     // Packetization Context
     EB_NEW(enc_handle_ptr->packetization_context_ptr,
            svt_aom_packetization_context_ctor,
@@ -2033,141 +2740,129 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
     /************************************
     * Thread Handles
     ************************************/
+    // Every system resource of the handle, for the FIFO mode switches below
+#define ENC_HANDLE_SYSTEM_RESOURCES(X)             \
+    X(scs_pool_ptr);                               \
+    X(picture_parent_control_set_pool_ptr);        \
+    X(me_pool_ptr);                                \
+    X(picture_control_set_pool_ptr);               \
+    X(enc_dec_pool_ptr);                           \
+    X(reference_picture_pool_ptr);                 \
+    X(tpl_reference_picture_pool_ptr);             \
+    X(pa_reference_picture_pool_ptr);              \
+    X(overlay_input_picture_pool_ptr);             \
+    X(input_buffer_resource_ptr);                  \
+    X(input_y8b_buffer_resource_ptr);              \
+    X(input_cmd_resource_ptr);                     \
+    X(output_stream_buffer_resource_ptr);          \
+    X(output_recon_buffer_resource_ptr);           \
+    X(resource_coordination_results_resource_ptr); \
+    X(picture_analysis_results_resource_ptr);      \
+    X(picture_decision_results_resource_ptr);      \
+    X(motion_estimation_results_resource_ptr);     \
+    X(initial_rate_control_results_resource_ptr);  \
+    X(picture_demux_results_resource_ptr);         \
+    X(tpl_disp_res_srm);                           \
+    X(rate_control_tasks_resource_ptr);            \
+    X(rate_control_results_resource_ptr);          \
+    X(enc_dec_tasks_resource_ptr);                 \
+    X(enc_dec_results_resource_ptr);               \
+    X(entropy_coding_results_resource_ptr);        \
+    X(dlf_results_resource_ptr);                   \
+    X(cdef_results_resource_ptr);                  \
+    X(rest_results_resource_ptr);
 #if CONFIG_SINGLE_THREAD_KERNEL
     // Single-thread kernel dispatch: at lp=1, register all kernels for
     // cooperative dispatch instead of creating 16 OS threads.
-    svt_kernel_dispatcher_init(&enc_handle_ptr->kernel_dispatcher);
+    return_error = svt_kernel_dispatcher_init(&enc_handle_ptr->kernel_dispatcher, scs->total_process_init_count);
+    if (return_error != EB_ErrorNone) {
+        return return_error;
+    }
     if (scs->lp == 1) {
         enc_handle_ptr->kernel_dispatcher.active = true;
+        check_thread_group_settings_unused(enc_handle_ptr);
 
         // Enable non-blocking FIFO mode on all system resources
 #define SRM_SET_ST(member) \
     svt_system_resource_set_single_thread_mode(enc_handle_ptr->member, &enc_handle_ptr->kernel_dispatcher)
-        SRM_SET_ST(scs_pool_ptr);
-        SRM_SET_ST(picture_parent_control_set_pool_ptr);
-        SRM_SET_ST(me_pool_ptr);
-        SRM_SET_ST(picture_control_set_pool_ptr);
-        SRM_SET_ST(enc_dec_pool_ptr);
-        SRM_SET_ST(reference_picture_pool_ptr);
-        SRM_SET_ST(tpl_reference_picture_pool_ptr);
-        SRM_SET_ST(pa_reference_picture_pool_ptr);
-        SRM_SET_ST(overlay_input_picture_pool_ptr);
-        SRM_SET_ST(input_buffer_resource_ptr);
-        SRM_SET_ST(input_y8b_buffer_resource_ptr);
-        SRM_SET_ST(input_cmd_resource_ptr);
-        SRM_SET_ST(output_stream_buffer_resource_ptr);
-        if (enc_handle_ptr->output_recon_buffer_resource_ptr) {
-            SRM_SET_ST(output_recon_buffer_resource_ptr);
-        }
-        SRM_SET_ST(resource_coordination_results_resource_ptr);
-        SRM_SET_ST(picture_analysis_results_resource_ptr);
-        SRM_SET_ST(picture_decision_results_resource_ptr);
-        SRM_SET_ST(motion_estimation_results_resource_ptr);
-        SRM_SET_ST(initial_rate_control_results_resource_ptr);
-        SRM_SET_ST(picture_demux_results_resource_ptr);
-        SRM_SET_ST(tpl_disp_res_srm);
-        SRM_SET_ST(rate_control_tasks_resource_ptr);
-        SRM_SET_ST(rate_control_results_resource_ptr);
-        SRM_SET_ST(enc_dec_tasks_resource_ptr);
-        SRM_SET_ST(enc_dec_results_resource_ptr);
-        SRM_SET_ST(entropy_coding_results_resource_ptr);
-        SRM_SET_ST(dlf_results_resource_ptr);
-        SRM_SET_ST(cdef_results_resource_ptr);
-        SRM_SET_ST(rest_results_resource_ptr);
+        ENC_HANDLE_SYSTEM_RESOURCES(SRM_SET_ST);
 #undef SRM_SET_ST
 
-        // Register all 16 pipeline kernels in stage order
-        SvtKernelDispatcher* d = &enc_handle_ptr->kernel_dispatcher;
-#define CONSUMER_FIFO(res) svt_system_resource_get_consumer_fifo(enc_handle_ptr->res, 0)
-
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_resource_coordination_kernel_iter,
-                                       enc_handle_ptr->resource_coordination_context_ptr->priv,
-                                       CONSUMER_FIFO(input_cmd_resource_ptr),
-                                       "ResCoord");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_picture_analysis_kernel_iter,
-                                       enc_handle_ptr->picture_analysis_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(resource_coordination_results_resource_ptr),
-                                       "PicAnalysis");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_picture_decision_kernel_iter,
-                                       enc_handle_ptr->picture_decision_context_ptr->priv,
-                                       CONSUMER_FIFO(picture_analysis_results_resource_ptr),
-                                       "PicDecision");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_motion_estimation_kernel_iter,
-                                       enc_handle_ptr->motion_estimation_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(picture_decision_results_resource_ptr),
-                                       "ME");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_initial_rate_control_kernel_iter,
-                                       enc_handle_ptr->initial_rate_control_context_ptr->priv,
-                                       CONSUMER_FIFO(motion_estimation_results_resource_ptr),
-                                       "InitRC");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_source_based_operations_kernel_iter,
-                                       enc_handle_ptr->source_based_operations_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(initial_rate_control_results_resource_ptr),
-                                       "SrcOps");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_tpl_disp_kernel_iter,
-                                       enc_handle_ptr->tpl_disp_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(tpl_disp_res_srm),
-                                       "TPL");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_picture_manager_kernel_iter,
-                                       enc_handle_ptr->picture_manager_context_ptr->priv,
-                                       CONSUMER_FIFO(picture_demux_results_resource_ptr),
-                                       "PicMgr");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_rate_control_kernel_iter,
-                                       enc_handle_ptr->rate_control_context_ptr->priv,
-                                       CONSUMER_FIFO(rate_control_tasks_resource_ptr),
-                                       "RC");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_mode_decision_configuration_kernel_iter,
-                                       enc_handle_ptr->mode_decision_configuration_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(rate_control_results_resource_ptr),
-                                       "MDConfig");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_mode_decision_kernel_iter,
-                                       enc_handle_ptr->enc_dec_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(enc_dec_tasks_resource_ptr),
-                                       "EncDec");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_dlf_kernel_iter,
-                                       enc_handle_ptr->dlf_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(enc_dec_results_resource_ptr),
-                                       "DLF");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_cdef_kernel_iter,
-                                       enc_handle_ptr->cdef_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(dlf_results_resource_ptr),
-                                       "CDEF");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_rest_kernel_iter,
-                                       enc_handle_ptr->rest_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(cdef_results_resource_ptr),
-                                       "Rest");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_entropy_coding_kernel_iter,
-                                       enc_handle_ptr->entropy_coding_context_ptr_array[0]->priv,
-                                       CONSUMER_FIFO(rest_results_resource_ptr),
-                                       "EC");
-        svt_kernel_dispatcher_register(d,
-                                       svt_aom_packetization_kernel_iter,
-                                       enc_handle_ptr->packetization_context_ptr->priv,
-                                       CONSUMER_FIFO(entropy_coding_results_resource_ptr),
-                                       "Pack");
-
-#undef CONSUMER_FIFO
+        // Register all pipeline kernels in stage order
+        register_dispatch_kernels(enc_handle_ptr);
 
         // Store ME context for inline TF/MCTF processing in PD
         scs->enc_ctx->st_me_context = enc_handle_ptr->motion_estimation_context_ptr_array[0]->priv;
     } else
+#endif
+#if CONFIG_KERNEL_POOL
+    if (scs->static_config.shared_thread_pool) {
+        // Process-wide pool: every opted-in handle shares one set of workers
+        register_dispatch_kernels(enc_handle_ptr);
+        check_thread_group_settings_unused(enc_handle_ptr);
+        return_error = svt_kernel_dispatcher_attach_shared_pool(&enc_handle_ptr->kernel_dispatcher,
+                                                                scs->static_config.thread_pool_weight,
+                                                                scs->static_config.shared_pool_threads,
+                                                                get_num_processors());
+        if (return_error != EB_ErrorNone) {
+            return return_error;
+        }
+        SVT_INFO("Kernel dispatch: %u kernels on the shared pool, weight %u, up to %u threads process-wide\n",
+                 enc_handle_ptr->kernel_dispatcher.num_kernels,
+                 scs->static_config.thread_pool_weight,
+                 enc_handle_ptr->kernel_dispatcher.pool->max_threads);
+    } else if (scs->static_config.dispatch_workers || scs->static_config.enable_thread_pool) {
+        // Multi-worker dispatch: a few workers drive the whole kernel table
+        const uint32_t workers = scs->static_config.dispatch_workers
+            ? scs->static_config.dispatch_workers
+            : get_kernel_pool_workers(scs->lp, get_handle_processors(&scs->static_config));
+        register_dispatch_kernels(enc_handle_ptr);
+        check_thread_group_settings_unused(enc_handle_ptr);
+        return_error = svt_kernel_dispatcher_start_workers(&enc_handle_ptr->kernel_dispatcher, workers);
+        if (return_error != EB_ErrorNone) {
+            return return_error;
+        }
+        SVT_INFO("Kernel dispatch: %u kernels on %u workers, up to %u threads\n",
+                 enc_handle_ptr->kernel_dispatcher.num_kernels,
+                 workers,
+                 enc_handle_ptr->kernel_dispatcher.pool->max_threads);
+    } else
 #endif
     {
+#if CONFIG_LOCKFREE_FIFO
+        // Dedicated stage threads block in the FIFOs themselves, so they can
+        // use the lock-free rings; the dispatcher modes above need the
+        // per-FIFO readiness of the semaphore path. lockfree_fifo = 0 keeps
+        // the semaphore path here too.
+#define SRM_SET_LOCKFREE(member)                                                      \
+    do {                                                                              \
+        return_error = svt_system_resource_set_lockfree_mode(enc_handle_ptr->member); \
+        if (return_error != EB_ErrorNone) {                                           \
+            return return_error;                                                      \
+        }                                                                             \
+    } while (0)
+        if (scs->static_config.lockfree_fifo) {
+            ENC_HANDLE_SYSTEM_RESOURCES(SRM_SET_LOCKFREE);
+        }
+#undef SRM_SET_LOCKFREE
+#endif
+        // Let THREAD_SCALE_EVENT park the workers of the parallel stages
+#define SRM_ENABLE_SCALING(member, count)                                          \
+    if (scs->count > 1) {                                                          \
+        return_error = svt_system_resource_enable_scaling(enc_handle_ptr->member); \
+        if (return_error != EB_ErrorNone) {                                        \
+            return return_error;                                                   \
+        }                                                                          \
+    }
+        ENC_HANDLE_SCALABLE_STAGES(SRM_ENABLE_SCALING);
+#undef SRM_ENABLE_SCALING
+        enc_handle_ptr->thread_scaling = true;
+        if (scs->static_config.pipeline_profile) {
+            return_error = setup_pipeline_profiler(enc_handle_ptr);
+            if (return_error != EB_ErrorNone) {
+                return return_error;
+            }
+        }
         EB_CREATE_THREAD(enc_handle_ptr->resource_coordination_thread_handle,
                          svt_aom_resource_coordination_kernel,
                          enc_handle_ptr->resource_coordination_context_ptr);
@@ -2261,6 +2956,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         EB_CREATE_THREAD(enc_handle_ptr->packetization_thread_handle,
                          svt_aom_packetization_kernel,
                          enc_handle_ptr->packetization_context_ptr);
+        setup_thread_groups(enc_handle_ptr);
     } // end of thread creation block
 
     svt_print_memory_usage();
@@ -2268,6 +2964,66 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
     return return_error;
 }
 
+/*
+ * fit_memory_budget() sized the pipeline on estimates before anything was
+ * allocated; hold the budget against what svt_av1_enc_init() allocated.
+ */
+static EbErrorType check_memory_budget(const EbEncHandle* enc_handle) {
+    const SequenceControlSet* scs    = enc_handle->scs_instance->scs;
+    const uint64_t            budget = (uint64_t)scs->static_config.max_memory_mb << 20;
+    if (!budget) {
+        return EB_ErrorNone;
+    }
+    uint64_t allocated = 0;
+    for (uint32_t c = 0; c < SVT_AV1_MEMORY_CATEGORIES; c++) {
+        allocated += enc_handle->mem_account.bytes[c];
+    }
+    if (allocated > budget) {
+        SVT_ERROR("max_memory_mb: the encoder allocated %u MiB, above the budget of %u MiB\n",
+                  to_mib(allocated),
+                  scs->static_config.max_memory_mb);
+        return EB_ErrorInsufficientResources;
+    }
+    return EB_ErrorNone;
+}
+
+EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
+    if (svt_enc_component == NULL) {
+        return EB_ErrorBadParameter;
+    }
+    EbEncHandle* enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    SvtCpuSet    caller_cpus;
+    SvtCpuSet    handle_cpus;
+    bool         bound = false;
+
+    // Thread placement: run the whole initialization bound to the core set of
+    // the handle. Every pipeline thread created here inherits the binding, and
+    // the picture buffers and contexts allocated here are first-touched on the
+    // NUMA node of those cores. Pages left untouched are first-touched later
+    // by the bound threads.
+    if (get_handle_cpus(enc_handle_ptr, &handle_cpus)) {
+        if (svt_get_thread_affinity(&caller_cpus) && svt_set_thread_affinity(&handle_cpus)) {
+            bound = true;
+            SVT_INFO("Thread placement: %u processors\n", svt_cpu_set_count(&handle_cpus));
+        } else {
+            SVT_WARN("Thread placement is not available on this platform, threads are not pinned\n");
+        }
+    }
+    // Account what the pipeline allocates; init_encoder_pipeline() switches
+    // the category per component
+    const SvtMemScope mem_scope    = svt_mem_scope_enter(&enc_handle_ptr->mem_account, SVT_AV1_MEMORY_OTHER);
+    EbErrorType       return_error = init_encoder_pipeline(svt_enc_component);
+    svt_mem_scope_leave(mem_scope);
+    if (return_error == EB_ErrorNone) {
+        return_error = check_memory_budget(enc_handle_ptr);
+    }
+    if (bound) {
+        // Give the calling application thread its own affinity back
+        svt_set_thread_affinity(&caller_cpus);
+    }
+    return return_error;
+}
+
 static EbErrorType enc_drain_queue(EbComponentType* svt_enc_component) {
     bool eos = false;
     do {
@@ -2313,10 +3069,11 @@ EB_API EbErrorType svt_av1_enc_deinit(EbComponentType* svt_enc_component) {
         }
     }
 
-    // Free per-instance block geometry table
-    if (handle->scs_instance && handle->scs_instance->scs && handle->scs_instance->scs->blk_geom_mds != NULL) {
-        EB_FREE_ARRAY(handle->scs_instance->scs->blk_geom_mds);
+    // Release per-instance block geometry table
+    if (handle->scs_instance && handle->scs_instance->scs) {
+        handle->scs_instance->scs->blk_geom_mds = NULL;
     }
+    blk_geom_release(&handle->blk_geom);
 
     svt_shutdown_process(handle->input_buffer_resource_ptr);
     svt_shutdown_process(handle->input_cmd_resource_ptr);
@@ -2371,6 +3128,32 @@ EB_API EbErrorType svt_av1_enc_init_handle(
     return return_error;
 }
 
+/**********************************
+* Clone Handle
+**********************************/
+EB_API EbErrorType svt_av1_enc_clone_handle(EbComponentType** p_handle, EbComponentType* src_handle,
+                                            EbSvtAv1EncConfiguration* config_ptr) {
+    if (p_handle == NULL || src_handle == NULL || src_handle->p_component_private == NULL || config_ptr == NULL) {
+        return EB_ErrorBadParameter;
+    }
+    EbEncHandle* src = (EbEncHandle*)src_handle->p_component_private;
+    if (!src->app_config_set) {
+        SVT_ERROR("svt_av1_enc_clone_handle: svt_av1_enc_set_parameter was not called on the source handle\n");
+        return EB_ErrorBadParameter;
+    }
+    EbErrorType return_error = svt_av1_enc_init_handle(p_handle, config_ptr);
+    if (return_error != EB_ErrorNone) {
+        return return_error;
+    }
+    EbEncHandle* enc_handle = (EbEncHandle*)(*p_handle)->p_component_private;
+    *config_ptr             = src->app_config;
+    enc_handle->scs_instance->enc_ctx->output_allocator = src->scs_instance->enc_ctx->output_allocator;
+    if (src->blk_geom) {
+        enc_handle->clone_blk_geom = blk_geom_acquire(src->blk_geom);
+    }
+    return EB_ErrorNone;
+}
+
 /**********************************
 * Encoder Componenet DeInit
 **********************************/
@@ -4196,24 +4979,7 @@ static void set_param_based_on_input(SequenceControlSet* scs) {
         ? 0
         : scs->static_config.enable_overlays;
 
-    // Enforce starting frame in decode order (at PicMgr)
-    // Does not wait for feedback from PKT
-    if (scs->static_config.level_of_parallelism == 1 || scs->static_config.pred_structure == LOW_DELAY) {
-        scs->enable_pic_mgr_dec_order = 1;
-    } else {
-        scs->enable_pic_mgr_dec_order = 0;
-    }
-    // Enforce encoding frame in decode order
-    // Wait for feedback from PKT
-#if RC_NO_R2R
-    scs->enable_dec_order = 1;
-#else
-    if (scs->static_config.level_of_parallelism == 1 || scs->static_config.pred_structure == LOW_DELAY) {
-        scs->enable_dec_order = 1;
-    } else {
-        scs->enable_dec_order = 0;
-    }
-#endif
+    set_dec_order(scs);
     // 1: Use boundary pixels in restoration filter search.
     // 0: Do not use boundary pixels in the restoration filter search.
     scs->use_boundaries_in_rest_search = 0;
@@ -4617,14 +5383,31 @@ static void copy_api_from_app(SequenceControlSet* scs, EbSvtAv1EncConfiguration*
             "for info.\n");
         scs->static_config.level_of_parallelism = PARALLEL_LEVEL_6;
     }
+    scs->static_config.numa_node        = config_struct->numa_node;
+    scs->static_config.pin_threads      = config_struct->pin_threads;
+    scs->static_config.thread_qos       = config_struct->thread_qos;
+    scs->static_config.pipeline_profile = config_struct->pipeline_profile;
+    scs->static_config.zero_copy_input  = config_struct->zero_copy_input;
+    scs->static_config.lazy_pool_alloc  = config_struct->lazy_pool_alloc;
+    scs->static_config.pool_headroom    = config_struct->pool_headroom;
+    scs->static_config.max_memory_mb    = config_struct->max_memory_mb;
+    scs->static_config.huge_pages       = config_struct->huge_pages;
+    scs->static_config.compact_refs     = config_struct->compact_refs;
     // When lp is left unset (0), resolve it to the core-count-based default now,
     // before any pipeline setup reads static_config.level_of_parallelism. This
     // keeps every downstream single-thread check (== 1) consistent with the
     // derived scs->lp used for segment/dispatcher setup; otherwise a 1-core
     // machine gets scs->lp == 1 (ST dispatch) while these checks still see 0.
     if (scs->static_config.level_of_parallelism == 0) {
-        scs->static_config.level_of_parallelism = get_default_level_of_parallelism(get_num_processors());
+        scs->static_config.level_of_parallelism = get_default_level_of_parallelism(
+            get_handle_processors(&scs->static_config));
     }
+    scs->static_config.enable_thread_pool  = config_struct->enable_thread_pool;
+    scs->static_config.dispatch_workers    = config_struct->dispatch_workers;
+    scs->static_config.shared_thread_pool  = config_struct->shared_thread_pool;
+    scs->static_config.thread_pool_weight  = config_struct->thread_pool_weight;
+    scs->static_config.lockfree_fifo       = config_struct->lockfree_fifo;
+    scs->static_config.shared_pool_threads = config_struct->shared_pool_threads;
 
     scs->static_config.qp            = config_struct->qp;
     scs->static_config.recon_enabled = config_struct->recon_enabled;
@@ -4838,10 +5621,25 @@ EB_API EbErrorType svt_av1_enc_set_parameter(EbComponentType*          svt_enc_c
 
     EbEncHandle*        enc_handle = (EbEncHandle*)svt_enc_component->p_component_private;
     SequenceControlSet* scs        = enc_handle->scs_instance->scs;
+    // Keep what the application asked for, without the lists and strings it
+    // owns and the stats of its own passes, as the configuration of its clones
+    enc_handle->app_config                  = *config_struct;
+    enc_handle->app_config.thread_affinity  = NULL;
+    enc_handle->app_config.frame_scale_evts = (SvtAv1FrameScaleEvts){0};
+    enc_handle->app_config.sframe_posi      = (SvtAv1SFramePositions){0};
+    enc_handle->app_config.rc_stats_buffer  = (SvtAv1FixedBuf){0};
+    enc_handle->app_config_set              = true;
     copy_api_from_app(scs, config_struct);
 
     EbErrorType return_error = svt_av1_verify_settings(scs);
 
+    // thread_affinity is parsed into the handle; the string stays the caller's
+    memset(&enc_handle->thread_affinity, 0, sizeof(enc_handle->thread_affinity));
+    if (config_struct->thread_affinity &&
+        parse_thread_affinity(config_struct->thread_affinity, &enc_handle->thread_affinity) != EB_ErrorNone) {
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (return_error == EB_ErrorBadParameter) {
         return EB_ErrorBadParameter;
     }
@@ -4886,7 +5684,12 @@ EB_API EbErrorType svt_av1_enc_set_parameter(EbComponentType*          svt_enc_c
     if (!enc_handle->scs_instance->enc_ctx->prediction_structure_group_ptr) {
         return EB_ErrorInsufficientResources;
     }
-    return_error = load_default_buffer_configuration_settings(scs);
+    scs->child_pool_cap = 0;
+    return_error        = load_default_buffer_configuration_settings(scs);
+    if (return_error == EB_ErrorNone && scs->static_config.max_memory_mb) {
+        return_error = fit_memory_budget(scs);
+    }
+    print_buffer_configuration(scs);
 
     svt_av1_print_lib_params(scs);
 
@@ -4917,6 +5720,47 @@ EB_API EbErrorType svt_av1_enc_set_parameter(EbComponentType*          svt_enc_c
     return return_error;
 }
 
+/**********************************
+* Set Output Allocator
+**********************************/
+EB_API EbErrorType svt_av1_enc_set_output_allocator(EbComponentType*             svt_enc_component,
+                                                    const SvtAv1OutputAllocator* allocator) {
+    if (svt_enc_component == NULL) {
+        return EB_ErrorBadParameter;
+    }
+    if (allocator && (!allocator->alloc || !allocator->release)) {
+        return EB_ErrorBadParameter;
+    }
+    EbEncHandle*   enc_handle = (EbEncHandle*)svt_enc_component->p_component_private;
+    EncodeContext* enc_ctx    = enc_handle->scs_instance->enc_ctx;
+    if (allocator) {
+        enc_ctx->output_allocator = *allocator;
+    } else {
+        memset(&enc_ctx->output_allocator, 0, sizeof(enc_ctx->output_allocator));
+    }
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Set ME Field Sink
+**********************************/
+EB_API EbErrorType svt_av1_enc_set_me_field_sink(EbComponentType* svt_enc_component, const SvtAv1MeFieldSink* sink) {
+    if (svt_enc_component == NULL) {
+        return EB_ErrorBadParameter;
+    }
+    if (sink && !sink->write) {
+        return EB_ErrorBadParameter;
+    }
+    EbEncHandle*   enc_handle = (EbEncHandle*)svt_enc_component->p_component_private;
+    EncodeContext* enc_ctx    = enc_handle->scs_instance->enc_ctx;
+    if (sink) {
+        enc_ctx->me_field_sink = *sink;
+    } else {
+        memset(&enc_ctx->me_field_sink, 0, sizeof(enc_ctx->me_field_sink));
+    }
+    return EB_ErrorNone;
+}
+
 EB_API EbErrorType svt_av1_enc_stream_header(EbComponentType*     svt_enc_component,
                                              EbBufferHeaderType** output_stream_ptr) {
     EbErrorType return_error = EB_ErrorNone;
@@ -5365,7 +6209,7 @@ static void memset_input_buffer(SequenceControlSet* scs, EbBufferHeaderType* dst
 from the sample application to the library buffers
 */
 static void copy_input_buffer(SequenceControlSet* scs, EbBufferHeaderType* dst, EbBufferHeaderType* dst_y8b,
-                              EbBufferHeaderType* src, int pass) {
+                              EbBufferHeaderType* src, int pass, bool lent) {
     // Copy the higher level structure
     dst->n_alloc_len  = src->n_alloc_len;
     dst->n_filled_len = src->n_filled_len;
@@ -5384,7 +6228,9 @@ static void copy_input_buffer(SequenceControlSet* scs, EbBufferHeaderType* dst,
         // Bypass copy for the unecessary picture in IPPP pass
         // Copy the picture buffer
         if (src->p_buffer != NULL) {
-            copy_frame_buffer(scs, dst->p_buffer, dst_y8b->p_buffer, src->p_buffer, pass);
+            if (!lent) {
+                copy_frame_buffer(scs, dst->p_buffer, dst_y8b->p_buffer, src->p_buffer, pass);
+            }
             // Copy the metadata array
             if (svt_aom_copy_metadata_buffer(dst, src->metadata) != EB_ErrorNone) {
                 dst->metadata = NULL;
@@ -5400,6 +6246,79 @@ static void copy_input_buffer(SequenceControlSet* scs, EbBufferHeaderType* dst,
     }
 }
 
+// Planes of an input picture lent by the application (zero_copy_input): the
+// y8b picture holds the luma and the input picture the chroma. The planes go
+// back to the application once both pictures are released.
+typedef struct LentInputPicture {
+    void (*release_cb)(void* release_ctx);
+    void*             release_ctx;
+    uint8_t*          y_buffer; // library planes, restored on release
+    uint8_t*          u_buffer;
+    uint8_t*          v_buffer;
+    volatile uint32_t pending;
+} LentInputPicture;
+
+static void lent_input_picture_put(LentInputPicture* lent) {
+    if (svt_atomic_fetch_add_u32(&lent->pending, (uint32_t)-1) == 1) {
+        lent->release_cb(lent->release_ctx);
+        EB_FREE(lent);
+    }
+}
+
+static void lent_y8b_release(EbObjectWrapper* wrapper, void* release_ctx) {
+    LentInputPicture*    lent = (LentInputPicture*)release_ctx;
+    EbPictureBufferDesc* pic  = (EbPictureBufferDesc*)((EbBufferHeaderType*)wrapper->object_ptr)->p_buffer;
+    pic->y_buffer             = lent->y_buffer;
+    lent_input_picture_put(lent);
+}
+
+static void lent_input_release(EbObjectWrapper* wrapper, void* release_ctx) {
+    LentInputPicture*    lent = (LentInputPicture*)release_ctx;
+    EbPictureBufferDesc* pic  = (EbPictureBufferDesc*)((EbBufferHeaderType*)wrapper->object_ptr)->p_buffer;
+    pic->u_buffer             = lent->u_buffer;
+    pic->v_buffer             = lent->v_buffer;
+    lent_input_picture_put(lent);
+}
+
+/*
+ Point the library input pictures to the planes of the application instead of
+ copying them. Only 8-bit pictures with the layout of the library buffers are
+ lent; returns false for anything else, which is then copied.
+*/
+static bool lend_input_buffer(SequenceControlSet* scs, EbObjectWrapper* input_wrapper, EbObjectWrapper* y8b_wrapper,
+                              EbBufferHeaderType* src, void (*release_cb)(void* release_ctx), void* release_ctx) {
+    const EbSvtIOFormat* src_pic = (const EbSvtIOFormat*)src->p_buffer;
+    EbPictureBufferDesc* pic     = (EbPictureBufferDesc*)((EbBufferHeaderType*)input_wrapper->object_ptr)->p_buffer;
+    EbPictureBufferDesc* y8b_pic = (EbPictureBufferDesc*)((EbBufferHeaderType*)y8b_wrapper->object_ptr)->p_buffer;
+
+    if (SVT_EFFECTIVE_BIT_DEPTH(scs->static_config.encoder_bit_depth) != EB_EIGHT_BIT || scs->first_pass_downsample ||
+        src_pic->y_stride != y8b_pic->y_stride || src_pic->cb_stride != pic->u_stride ||
+        src_pic->cr_stride != pic->v_stride) {
+        return false;
+    }
+    LentInputPicture* lent;
+    EB_MALLOC_NO_CHECK(lent, sizeof(*lent));
+    if (!lent) {
+        return false;
+    }
+    lent->release_cb  = release_cb;
+    lent->release_ctx = release_ctx;
+    lent->y_buffer    = y8b_pic->y_buffer;
+    lent->u_buffer    = pic->u_buffer;
+    lent->v_buffer    = pic->v_buffer;
+    lent->pending     = 2;
+
+    y8b_pic->y_buffer = src_pic->luma;
+    pic->u_buffer     = src_pic->cb;
+    pic->v_buffer     = src_pic->cr;
+
+    y8b_wrapper->release_cb    = lent_y8b_release;
+    y8b_wrapper->release_ctx   = lent;
+    input_wrapper->release_cb  = lent_input_release;
+    input_wrapper->release_ctx = lent;
+    return true;
+}
+
 // Update the input picture definitions: resolution of the sequence
 static EbErrorType validate_on_the_fly_settings(EbBufferHeaderType* input_ptr, SequenceControlSet* scs,
                                                 EbHandle config_mutex) {
@@ -5573,16 +6492,64 @@ static EbErrorType validate_on_the_fly_settings(EbBufferHeaderType* input_ptr, S
                 SVT_ERROR("Low delay CBR supports hierarchical_levels [0-2].\n");
                 return EB_ErrorBadParameter;
             }
+        } else if (node->node_type == FRAME_TIMING_EVENT) {
+            if (node->size != sizeof(SvtAv1FrameTimingInfo) || !node->data) {
+                SVT_ERROR("FRAME_TIMING_EVENT: invalid private-data size or NULL data\n");
+                return EB_ErrorBadParameter;
+            }
+        } else if (node->node_type == ME_FIELD_EVENT) {
+            const SvtAv1MeField* field = (const SvtAv1MeField*)node->data;
+            if (node->size < sizeof(SvtAv1MeField) || !field) {
+                SVT_ERROR("ME_FIELD_EVENT: invalid private-data size or NULL data\n");
+                return EB_ErrorBadParameter;
+            }
+            if (!field->width || !field->height || !field->b64_cols || !field->b64_rows ||
+                field->ref_count > SVT_AV1_ME_FIELD_MAX_REFS ||
+                (field->block_count != 1 && field->block_count != SVT_AV1_ME_FIELD_BLOCKS) ||
+                node->size !=
+                    SVT_AV1_ME_FIELD_SIZE(field->b64_cols, field->b64_rows, field->ref_count, field->block_count)) {
+                SVT_ERROR("ME_FIELD_EVENT: field size does not match its header\n");
+                return EB_ErrorBadParameter;
+            }
+        } else if (node->node_type == THREAD_SCALE_EVENT) {
+            if (node->size != sizeof(SvtAv1ThreadScaleInfo) || !node->data) {
+                SVT_ERROR("THREAD_SCALE_EVENT: invalid private-data size or NULL data\n");
+                return EB_ErrorBadParameter;
+            }
+            const uint32_t active_percent = ((const SvtAv1ThreadScaleInfo*)node->data)->active_percent;
+            if (active_percent < 1 || active_percent > 100) {
+                SVT_ERROR("Thread scaling on the fly requires active_percent in range [1, 100]\n");
+                return EB_ErrorBadParameter;
+            }
         }
         node = node->next;
     }
     return EB_ErrorNone;
 }
 
+// Apply the THREAD_SCALE_EVENT of an input right away: the workers of the
+// parallel stages are shared by every picture in flight, so the new count
+// cannot be tied to the picture carrying the event
+static void apply_thread_scale_event(EbEncHandle* enc_handle_ptr, const EbBufferHeaderType* input_ptr) {
+    for (const EbPrivDataNode* node = input_ptr->p_app_private; node; node = node->next) {
+        if (node->node_type != THREAD_SCALE_EVENT) {
+            continue;
+        }
+        if (!enc_handle_ptr->thread_scaling) {
+            SVT_WARN("THREAD_SCALE_EVENT needs per-stage threads and is ignored\n");
+            continue;
+        }
+        set_active_worker_percent(enc_handle_ptr, ((const SvtAv1ThreadScaleInfo*)node->data)->active_percent);
+    }
+}
+
 /**********************************
 * Empty This Buffer
 **********************************/
-EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component, EbBufferHeaderType* p_buffer) {
+// release_cb is set for the pictures of svt_av1_enc_send_picture_lent() and is
+// called exactly once, when the encoder no longer references the planes
+static EbErrorType send_picture(EbComponentType* svt_enc_component, EbBufferHeaderType* p_buffer,
+                                void (*release_cb)(void* release_ctx), void* release_ctx) {
     EbErrorType         return_val     = EB_ErrorNone;
     EbEncHandle*        enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
     EbObjectWrapper*    eb_wrapper_ptr;
@@ -5619,9 +6586,14 @@ EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component,
     if (validate_on_the_fly_settings(p_buffer, scs, enc_handle_ptr->scs_instance->config_mutex)) {
         return_val = EB_ErrorBadParameter;
         if (!(p_buffer->flags & EB_BUFFERFLAG_EOS)) {
+            if (release_cb) {
+                release_cb(release_ctx);
+            }
             return EB_ErrorBadParameter;
         }
         enc_handle_ptr->eos_received = 1;
+    } else {
+        apply_thread_scale_event(enc_handle_ptr, p_buffer);
     }
 
     // Get new Luma-8b buffer & a new (Chroma-8b + Luma-Chroma-2bit) buffers; Lib will release once done.
@@ -5666,6 +6638,9 @@ EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component,
     const size_t chroma_height = (luma_height + subsampling_y) >> subsampling_y;
     const size_t read_size     = (luma_width * luma_height + 2 * chroma_width * chroma_height) << is_16bit_input;
 
+    // With zero_copy_input, the planes of a lent picture are referenced instead of copied
+    const bool lend = config->zero_copy_input && release_cb && app_hdr->p_buffer;
+    bool       lent = false;
     if (app_hdr->p_buffer != NULL && read_size > app_hdr->n_filled_len) {
         // memset the library input buffer(s) if the API input buffer is not large enough
         // this operation is necessary to avoid a potential crash when processing an invalid input
@@ -5673,7 +6648,12 @@ EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component,
         memset_input_buffer(scs, lib_reg_hdr, lib_y8b_hdr, app_hdr, 0);
         enc_handle_ptr->is_prev_valid = false;
     } else {
-        copy_input_buffer(scs, lib_reg_hdr, lib_y8b_hdr, app_hdr, 0);
+        lent = lend && lend_input_buffer(scs, eb_wrapper_ptr, y8b_wrapper, app_hdr, release_cb, release_ctx);
+        copy_input_buffer(scs, lib_reg_hdr, lib_y8b_hdr, app_hdr, 0, lent);
+    }
+    // Copied instead, or not read at all, the planes are free again
+    if (release_cb && !lent) {
+        release_cb(release_ctx);
     }
 
     //Take a new App-RessCoord command
@@ -5696,6 +6676,18 @@ EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component,
     return return_val;
 }
 
+EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component, EbBufferHeaderType* p_buffer) {
+    return send_picture(svt_enc_component, p_buffer, NULL, NULL);
+}
+
+EB_API EbErrorType svt_av1_enc_send_picture_lent(EbComponentType* svt_enc_component, EbBufferHeaderType* p_buffer,
+                                                 void (*release_cb)(void* release_ctx), void* release_ctx) {
+    if (!release_cb) {
+        return EB_ErrorBadParameter;
+    }
+    return send_picture(svt_enc_component, p_buffer, release_cb, release_ctx);
+}
+
 static void copy_output_recon_buffer(EbBufferHeaderType* dst, EbBufferHeaderType* src) {
     // copy output Bitstream fileds
     dst->size          = src->size;
@@ -5770,15 +6762,31 @@ EB_API EbErrorType svt_av1_enc_get_packet(EbComponentType* svt_enc_component, Eb
 
 EB_API void svt_av1_enc_release_out_buffer(EbBufferHeaderType** p_buffer) {
     if (p_buffer && (*p_buffer)->wrapper_ptr) {
-        if ((*p_buffer)->p_buffer) {
+        EbObjectWrapper* wrapper = (EbObjectWrapper*)(*p_buffer)->wrapper_ptr;
+        // A buffer of the output allocator goes back to it from the release_cb of the wrapper
+        if ((*p_buffer)->p_buffer && !wrapper->release_cb) {
             EB_FREE((*p_buffer)->p_buffer);
         }
+        ((EbOutputPacket*)*p_buffer)->has_timing = false;
         // Release out put buffer back into the pool
         svt_release_object((EbObjectWrapper*)(*p_buffer)->wrapper_ptr);
     }
     return;
 }
 
+EB_API EbErrorType svt_av1_enc_get_packet_timing(const EbBufferHeaderType* packet, SvtAv1FrameTiming* timing) {
+    if (!packet || !timing || !packet->wrapper_ptr ||
+        ((EbObjectWrapper*)packet->wrapper_ptr)->object_ptr != (EbPtr)packet) {
+        return EB_ErrorBadParameter;
+    }
+    const EbOutputPacket* output_packet = (const EbOutputPacket*)packet;
+    if (!output_packet->has_timing) {
+        return EB_NoErrorEmptyQueue;
+    }
+    *timing = output_packet->timing;
+    return EB_ErrorNone;
+}
+
 /**********************************
 * Fill This Buffer
 **********************************/
@@ -5920,8 +6928,9 @@ static EbErrorType allocate_frame_buffer(SequenceControlSet* scs, EbBufferHeader
 
     input_pic_buf_desc_init_data.split_mode = is_16bit ? true : false;
 
-    input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
-    input_pic_buf_desc_init_data.is_16bit_pipeline  = 0;
+    input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK |
+        svt_aom_huge_page_mask(config->huge_pages);
+    input_pic_buf_desc_init_data.is_16bit_pipeline = 0;
 
     // Enhanced Picture Buffer
     {
@@ -5960,8 +6969,9 @@ static EbErrorType allocate_y8b_frame_buffer(SequenceControlSet* scs, EbBufferHe
 
     input_pic_buf_desc_init_data.split_mode = is_16bit ? true : false;
 
-    input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_LUMA_MASK; //allocate for 8bit Luma only
-    input_pic_buf_desc_init_data.is_16bit_pipeline  = 0;
+    input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_LUMA_MASK | //allocate for 8bit Luma only
+        svt_aom_huge_page_mask(config->huge_pages);
+    input_pic_buf_desc_init_data.is_16bit_pipeline = 0;
 
     // Enhanced Picture Buffer
     {
@@ -6039,14 +7049,7 @@ void svt_input_buffer_header_destroyer(EbPtr p) {
     EbBufferHeaderType*  obj = (EbBufferHeaderType*)p;
     EbPictureBufferDesc* buf = (EbPictureBufferDesc*)obj->p_buffer;
     if (buf) {
-        EB_FREE_ALIGNED_ARRAY(buf->buffer_alloc);
-        buf->buffer_alloc_sz  = 0;
-        buf->y_buffer         = NULL;
-        buf->u_buffer         = NULL;
-        buf->v_buffer         = NULL;
-        buf->y_buffer_bit_inc = NULL;
-        buf->u_buffer_bit_inc = NULL;
-        buf->v_buffer_bit_inc = NULL;
+        svt_picture_buffer_desc_free(buf);
     }
 
     EB_DELETE(buf);
@@ -6079,9 +7082,11 @@ EbErrorType svt_overlay_buffer_header_creator(EbPtr* object_dbl_ptr, EbPtr objec
 EbErrorType svt_output_buffer_header_creator(EbPtr* object_dbl_ptr, EbPtr object_init_data_ptr) {
     (void)object_init_data_ptr;
     EbBufferHeaderType* out_buf_ptr;
+    EbOutputPacket*     packet;
 
     *object_dbl_ptr = NULL;
-    EB_CALLOC(out_buf_ptr, 1, sizeof(EbBufferHeaderType));
+    EB_CALLOC(packet, 1, sizeof(EbOutputPacket));
+    out_buf_ptr     = &packet->header;
     *object_dbl_ptr = (EbPtr)out_buf_ptr;
 
     // Initialize Header
@@ -6094,7 +7099,7 @@ EbErrorType svt_output_buffer_header_creator(EbPtr* object_dbl_ptr, EbPtr object
 }
 
 void svt_output_buffer_header_destroyer(EbPtr p) {
-    EbBufferHeaderType* obj = (EbBufferHeaderType*)p;
+    EbOutputPacket* obj = (EbOutputPacket*)p;
     EB_FREE(obj);
 }
 
@@ -6138,6 +7143,30 @@ void svt_output_recon_buffer_header_destroyer(EbPtr p) {
     EB_FREE(obj);
 }
 
+// Picture memory of a pool object on huge pages, for SVT_AV1_STREAM_INFO_POOL_USAGE
+static uint64_t pic_huge_page_bytes(const EbPictureBufferDesc* pic) {
+    return pic && pic->buffer_pages != SVT_PAGES_HEAP ? pic->buffer_alloc_sz : 0;
+}
+
+static uint64_t input_huge_page_bytes(EbPtr object) {
+    return pic_huge_page_bytes((EbPictureBufferDesc*)((EbBufferHeaderType*)object)->p_buffer);
+}
+
+static uint64_t enc_dec_huge_page_bytes(EbPtr object) {
+    const EncDecSet*         set   = (EncDecSet*)object;
+    const SvtPicBufDescPool* coeff = &set->quantized_coeff_pool;
+    return pic_huge_page_bytes(set->recon_pic) + pic_huge_page_bytes(set->recon_pic_16bit) +
+        (coeff->backing_pages != SVT_PAGES_HEAP ? coeff->backing_size : 0);
+}
+
+static uint64_t tpl_reference_huge_page_bytes(EbPtr object) {
+    return pic_huge_page_bytes(((EbTplReferenceObject*)object)->ref_picture_ptr);
+}
+
+static uint64_t reference_huge_page_bytes(EbPtr object) {
+    return pic_huge_page_bytes(((EbReferenceObject*)object)->reference_picture);
+}
+
 /**********************************
 * svt_av1_enc_get_stream_info get stream information from encoder
 **********************************/
@@ -6146,7 +7175,92 @@ EB_API EbErrorType svt_av1_enc_get_stream_info(EbComponentType* svt_enc_componen
     if (stream_info_id >= SVT_AV1_STREAM_INFO_END || stream_info_id < SVT_AV1_STREAM_INFO_START) {
         return EB_ErrorBadParameter;
     }
-    EbEncHandle*    enc_handle       = svt_enc_component->p_component_private;
+    EbEncHandle* enc_handle = svt_enc_component->p_component_private;
+    if (stream_info_id == SVT_AV1_STREAM_INFO_PIPELINE_PROFILE) {
+        if (!enc_handle->profiler) {
+            return EB_ErrorBadParameter;
+        }
+        svt_pipeline_profiler_get(enc_handle->profiler, (SvtAv1PipelineProfile*)info);
+        return EB_ErrorNone;
+    }
+    if (stream_info_id == SVT_AV1_STREAM_INFO_PIPELINE_TRACE) {
+        if (!enc_handle->profiler) {
+            return EB_ErrorBadParameter;
+        }
+        return svt_pipeline_profiler_get_trace(enc_handle->profiler, (SvtAv1FixedBuf*)info);
+    }
+    if (stream_info_id == SVT_AV1_STREAM_INFO_POOL_USAGE) {
+        const struct {
+            const char*       name;
+            EbSystemResource* pool;
+            uint64_t (*huge_page_bytes)(EbPtr object); // NULL for pools never on huge pages
+        } pools[SVT_AV1_MAX_POOLS] = {
+            {"input", enc_handle->input_buffer_resource_ptr, input_huge_page_bytes},
+            {"input_y8b", enc_handle->input_y8b_buffer_resource_ptr, input_huge_page_bytes},
+            {"parent_pcs", enc_handle->picture_parent_control_set_pool_ptr, NULL},
+            {"me", enc_handle->me_pool_ptr, NULL},
+            {"pcs", enc_handle->picture_control_set_pool_ptr, NULL},
+            {"enc_dec", enc_handle->enc_dec_pool_ptr, enc_dec_huge_page_bytes},
+            {"pa_reference", enc_handle->pa_reference_picture_pool_ptr, NULL},
+            {"tpl_reference", enc_handle->tpl_reference_picture_pool_ptr, tpl_reference_huge_page_bytes},
+            {"reference", enc_handle->reference_picture_pool_ptr, reference_huge_page_bytes},
+            {"overlay_input", enc_handle->overlay_input_picture_pool_ptr, input_huge_page_bytes},
+        };
+        SvtAv1PoolUsage* usage = (SvtAv1PoolUsage*)info;
+        usage->pool_count      = 0;
+        for (uint32_t i = 0; i < SVT_AV1_MAX_POOLS; i++) {
+            const EbSystemResource* pool = pools[i].pool;
+            if (!pool) {
+                continue;
+            }
+            SvtAv1PoolStats* stats = &usage->pools[usage->pool_count++];
+            stats->name            = pools[i].name;
+            stats->ceiling         = pool->object_total_count;
+            stats->allocated       = pool->object_created_count;
+            stats->in_use          = pool->in_use_count;
+            stats->peak_in_use     = pool->peak_in_use_count;
+            stats->huge_page_bytes = 0;
+            for (uint32_t w = 0; pools[i].huge_page_bytes && w < pool->object_created_count; w++) {
+                // A lazy pool publishes its wrapper once the object is constructed
+                const EbObjectWrapper* wrapper = pool->wrapper_ptr_pool[w];
+                if (wrapper && wrapper->object_ptr) {
+                    stats->huge_page_bytes += pools[i].huge_page_bytes(wrapper->object_ptr);
+                }
+            }
+        }
+        return EB_ErrorNone;
+    }
+    if (stream_info_id == SVT_AV1_STREAM_INFO_MEMORY_USAGE) {
+        SvtAv1MemoryUsage* usage = (SvtAv1MemoryUsage*)info;
+        usage->total             = 0;
+        for (uint32_t c = 0; c < SVT_AV1_MEMORY_CATEGORIES; c++) {
+            usage->bytes[c] = enc_handle->mem_account.bytes[c];
+            usage->total += usage->bytes[c];
+        }
+        return EB_ErrorNone;
+    }
+    if (stream_info_id == SVT_AV1_STREAM_INFO_INPUT_LAYOUT) {
+        if (!enc_handle->input_buffer_resource_ptr || !enc_handle->input_y8b_buffer_resource_ptr) {
+            return EB_ErrorBadParameter;
+        }
+        const EbBufferHeaderType* y8b_hdr =
+            (EbBufferHeaderType*)enc_handle->input_y8b_buffer_resource_ptr->wrapper_ptr_pool[0]->object_ptr;
+        const EbBufferHeaderType* hdr =
+            (EbBufferHeaderType*)enc_handle->input_buffer_resource_ptr->wrapper_ptr_pool[0]->object_ptr;
+        const EbPictureBufferDesc* y8b_pic = (EbPictureBufferDesc*)y8b_hdr->p_buffer;
+        const EbPictureBufferDesc* pic     = (EbPictureBufferDesc*)hdr->p_buffer;
+        const uint8_t      ss_x   = pic->color_format == EB_YUV444 ? 0 : 1;
+        const uint8_t      ss_y   = pic->color_format == EB_YUV444 || pic->color_format == EB_YUV422 ? 0 : 1;
+        SvtAv1InputLayout* layout = (SvtAv1InputLayout*)info;
+        layout->y_stride          = y8b_pic->y_stride;
+        layout->uv_stride         = pic->u_stride;
+        layout->border            = y8b_pic->border;
+        layout->luma_size         = y8b_pic->luma_size;
+        layout->chroma_size       = pic->chroma_size;
+        layout->luma_offset       = y8b_pic->border + y8b_pic->y_stride * y8b_pic->border;
+        layout->chroma_offset     = (pic->border >> ss_x) + pic->u_stride * (pic->border >> ss_y);
+        return EB_ErrorNone;
+    }
     EncodeContext*  context          = enc_handle->scs_instance->enc_ctx;
     SvtAv1FixedBuf* first_pass_stats = info;
     first_pass_stats->buf            = context->stats_out.stat;
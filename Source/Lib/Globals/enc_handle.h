@@ -18,6 +18,8 @@
 #include "sys_resource_manager.h"
 #include "sequence_control_set.h"
 #include "object.h"
+#include "svt_threads.h"
+#include "pipeline_profiler.h"
 #include "EbConfigMacros.h"
 #if CONFIG_SINGLE_THREAD_KERNEL
 #include "kernel_dispatch.h"
@@ -28,6 +30,36 @@ struct _EbThreadContext {
     EbPtr   priv;
 };
 
+/**************************************
+ * Thread groups of the per-stage threads, each of which can be given its own
+ * core set through thread_affinity ("<group>@<cpulist>").
+ **************************************/
+typedef enum EncThreadGroup {
+    ENC_THREAD_GROUP_ALL, // default core set of the handle (entry without a group)
+    ENC_THREAD_GROUP_RESOURCE_COORDINATION,
+    ENC_THREAD_GROUP_PICTURE_ANALYSIS,
+    ENC_THREAD_GROUP_PICTURE_DECISION,
+    ENC_THREAD_GROUP_MOTION_ESTIMATION,
+    ENC_THREAD_GROUP_INITIAL_RATE_CONTROL,
+    ENC_THREAD_GROUP_SOURCE_BASED_OPERATIONS,
+    ENC_THREAD_GROUP_TPL_DISP,
+    ENC_THREAD_GROUP_PICTURE_MANAGER,
+    ENC_THREAD_GROUP_RATE_CONTROL,
+    ENC_THREAD_GROUP_MODE_DECISION_CONFIGURATION,
+    ENC_THREAD_GROUP_ENC_DEC,
+    ENC_THREAD_GROUP_ENTROPY_CODING,
+    ENC_THREAD_GROUP_DLF,
+    ENC_THREAD_GROUP_CDEF,
+    ENC_THREAD_GROUP_REST,
+    ENC_THREAD_GROUP_PACKETIZATION,
+    ENC_THREAD_GROUP_COUNT
+} EncThreadGroup;
+
+typedef struct EncThreadAffinity {
+    SvtCpuSet cpus[ENC_THREAD_GROUP_COUNT];
+    bool      is_set[ENC_THREAD_GROUP_COUNT];
+} EncThreadAffinity;
+
 /**************************************
  * Component Private Data
  **************************************/
@@ -129,6 +161,26 @@ struct _EbEncHandle {
     bool frame_received; // used to signal we received any frame from the app
     bool is_prev_valid; // whether the previous input is valid or not
 
+    // Core sets parsed from thread_affinity
+    EncThreadAffinity thread_affinity;
+    // Whether the per-stage threads can be parked by THREAD_SCALE_EVENT
+    bool thread_scaling;
+    // Per-stage counters, NULL unless pipeline_profile is set
+    SvtPipelineProfiler* profiler;
+    // Bytes allocated per SvtAv1MemoryCategory while the encoder was built
+    // and its pools grew
+    SvtMemAccount mem_account;
+    // Block geometry table scs->blk_geom_mds points into, shared with the
+    // handles cloned from this one
+    struct SharedBlkGeom* blk_geom;
+    // Table of the handle this one was cloned from, used by
+    // svt_av1_enc_init() when the geometry matches
+    struct SharedBlkGeom* clone_blk_geom;
+    // Configuration last passed to svt_av1_enc_set_parameter(), the starting
+    // point of the handles cloned from this one
+    EbSvtAv1EncConfiguration app_config;
+    bool                     app_config_set;
+
 #if CONFIG_SINGLE_THREAD_KERNEL
     SvtKernelDispatcher kernel_dispatcher;
 #endif
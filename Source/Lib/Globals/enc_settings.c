@@ -174,6 +174,40 @@ EbErrorType svt_av1_verify_settings(SequenceControlSet* scs) {
                   (unsigned)config->rate_control_mode);
         return_error = EB_ErrorBadParameter;
     }
+    if (config->dispatch_workers > 8) {
+        SVT_ERROR("dispatch_workers must be in [0, 8] (got %u)\n", (unsigned)config->dispatch_workers);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->thread_pool_weight < 1) {
+        SVT_ERROR("thread_pool_weight must be in [1, 255] (got %u)\n", (unsigned)config->thread_pool_weight);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->thread_qos > 2) {
+        SVT_ERROR("thread_qos must be in [0, 2] (got %u)\n", (unsigned)config->thread_qos);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->pipeline_profile > 2) {
+        SVT_ERROR("pipeline_profile must be in [0, 2] (got %u)\n", (unsigned)config->pipeline_profile);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->pool_headroom > 100) {
+        SVT_ERROR("pool_headroom must be in [0, 100] (got %u)\n", (unsigned)config->pool_headroom);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->huge_pages > 2) {
+        SVT_ERROR("huge_pages must be in [0, 2] (got %u)\n", (unsigned)config->huge_pages);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->zero_copy_input && config->encoder_bit_depth != EB_EIGHT_BIT) {
+        SVT_WARN("zero_copy_input only applies to 8-bit input, input pictures will be copied\n");
+    }
+    if (config->compact_refs && config->encoder_bit_depth == EB_EIGHT_BIT) {
+        SVT_WARN("compact_refs only applies to 10-bit input\n");
+    }
+    if (config->numa_node < -1 || config->numa_node > 63) {
+        SVT_ERROR("numa_node must be in [-1, 63] (got %d)\n", config->numa_node);
+        return_error = EB_ErrorBadParameter;
+    }
     if (config->rate_control_mode == SVT_AV1_RC_MODE_VBR && config->pred_structure == LOW_DELAY) {
         SVT_ERROR("VBR Rate control is currently not supported for LOW_DELAY, use CBR mode\n");
         return_error = EB_ErrorBadParameter;
@@ -999,6 +1033,23 @@ EbErrorType svt_av1_set_default_params(EbSvtAv1EncConfiguration* config_ptr) {
 
     // Channel info
     config_ptr->level_of_parallelism = 0;
+    config_ptr->enable_thread_pool   = false;
+    config_ptr->dispatch_workers     = 0;
+    config_ptr->shared_thread_pool   = false;
+    config_ptr->thread_pool_weight   = 1;
+    config_ptr->lockfree_fifo        = true;
+    config_ptr->shared_pool_threads  = 0;
+    config_ptr->numa_node            = -1;
+    config_ptr->pin_threads          = 0;
+    config_ptr->thread_affinity      = NULL;
+    config_ptr->thread_qos           = 0;
+    config_ptr->pipeline_profile     = 0;
+    config_ptr->zero_copy_input      = false;
+    config_ptr->lazy_pool_alloc      = false;
+    config_ptr->pool_headroom        = 100;
+    config_ptr->max_memory_mb        = 0;
+    config_ptr->huge_pages           = 0;
+    config_ptr->compact_refs         = false;
 
     // Debug info
     config_ptr->recon_enabled = 0;
@@ -2020,6 +2071,19 @@ static EbErrorType str_to_resz_kf_denoms(const char* nptr, SvtAv1FrameScaleEvts*
     return parse_list_uint32(nptr, evts->resize_kf_denoms, param_count);
 }
 
+static EbErrorType str_to_thread_affinity(const char* nptr, char** thread_affinity) {
+    const size_t len = strlen(nptr);
+    if (len == 0) {
+        return EB_ErrorBadParameter;
+    }
+    if (*thread_affinity) {
+        EB_FREE(*thread_affinity);
+    }
+    EB_MALLOC(*thread_affinity, len + 1);
+    memcpy(*thread_affinity, nptr, len + 1);
+    return EB_ErrorNone;
+}
+
 static EbErrorType str_to_resz_denoms(const char* nptr, SvtAv1FrameScaleEvts* evts) {
     const uint32_t param_count = count_params(nptr);
     if ((evts->evt_num != 0 && evts->evt_num != param_count) || param_count == 0) {
@@ -2225,6 +2289,10 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration* config_
         return str_to_resz_denoms(value, &config_struct->frame_scale_evts);
     }
 
+    if (!strcmp(name, "thread-affinity")) {
+        return str_to_thread_affinity(value, &config_struct->thread_affinity);
+    }
+
     if (!strcmp(name, "sframe-posi")) {
         return str_to_sframe_posi(value, &config_struct->sframe_posi);
     }
@@ -2253,6 +2321,9 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration* config_
         {"tier", &config_struct->tier},
         {"level", &config_struct->level},
         {"lp", &config_struct->level_of_parallelism},
+        {"shared-pool-threads", &config_struct->shared_pool_threads},
+        {"max-memory-mb", &config_struct->max_memory_mb},
+        {"pin", &config_struct->pin_threads},
         {"fps-num", &config_struct->frame_rate_numerator},
         {"fps-denom", &config_struct->frame_rate_denominator},
         {"lookahead", &config_struct->look_ahead_distance},
@@ -2288,6 +2359,12 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration* config_
         uint8_t*    out;
     } uint8_opts[] = {
         {"aq-mode", &config_struct->aq_mode},
+        {"dispatch-workers", &config_struct->dispatch_workers},
+        {"thread-pool-weight", &config_struct->thread_pool_weight},
+        {"thread-qos", &config_struct->thread_qos},
+        {"pipeline-profile", &config_struct->pipeline_profile},
+        {"pool-headroom", &config_struct->pool_headroom},
+        {"huge-pages", &config_struct->huge_pages},
         {"superres-mode", &config_struct->superres_mode},
         {"superres-qthres", &config_struct->superres_qthres},
         {"superres-kf-qthres", &config_struct->superres_kf_qthres},
@@ -2406,6 +2483,7 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration* config_
         {"preset", &config_struct->enc_mode},
         {"sharpness", &config_struct->sharpness},
         {"startup-qp-offset", &config_struct->startup_qp_offset},
+        {"numa-node", &config_struct->numa_node},
     };
 
     const size_t int8_opts_size = sizeof(int8_opts) / sizeof(int8_opts[0]);
@@ -2445,6 +2523,12 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration* config_
         {"adaptive-film-grain", &config_struct->adaptive_film_grain},
         {"enable-kf-tf", &config_struct->enable_tf_key},
         {"enable-intrabc", &config_struct->enable_intrabc},
+        {"thread-pool", &config_struct->enable_thread_pool},
+        {"shared-thread-pool", &config_struct->shared_thread_pool},
+        {"lockfree-fifo", &config_struct->lockfree_fifo},
+        {"zero-copy-input", &config_struct->zero_copy_input},
+        {"lazy-pool-alloc", &config_struct->lazy_pool_alloc},
+        {"compact-refs", &config_struct->compact_refs},
     };
     const size_t bool_opts_size = sizeof(bool_opts) / sizeof(bool_opts[0]);
 
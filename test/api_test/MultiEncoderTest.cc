@@ -16,7 +16,9 @@
  * @brief SVT-AV1 multi-encoder thread safety test
  *
  * Tests running multiple encoder instances on different threads with RTC
- * configuration to verify thread safety of global state initialization.
+ * configuration to verify thread safety of global state initialization,
+ * several handles attached to the process-wide shared thread pool, and
+ * handles cloned from a configured one.
  *
  ******************************************************************************/
 
@@ -123,10 +125,13 @@ static void configure_encoder(
 }
 
 // Initialize encoder: init_handle -> set_parameter -> init
+// customize, when set, adjusts the configuration after configure_encoder()
 // Returns true on success, false on failure (logs error and sets g_test_failed)
-static bool init_encoder(EbComponentType **encoder_handle,
-                         EbSvtAv1EncConfiguration *config, int id,
-                         GeometrySize geometry_size = GeometrySize::SMALL) {
+static bool init_encoder(
+    EbComponentType **encoder_handle, EbSvtAv1EncConfiguration *config,
+    int id, GeometrySize geometry_size = GeometrySize::SMALL,
+    const std::function<void(EbSvtAv1EncConfiguration &)> &customize =
+        nullptr) {
     EbErrorType ret = svt_av1_enc_init_handle(encoder_handle, config);
     if (ret != EB_ErrorNone) {
         log_error(id, "svt_av1_enc_init_handle failed", ret);
@@ -134,6 +139,9 @@ static bool init_encoder(EbComponentType **encoder_handle,
     }
 
     configure_encoder(*config, geometry_size);
+    if (customize) {
+        customize(*config);
+    }
 
     ret = svt_av1_enc_set_parameter(*encoder_handle, config);
     if (ret != EB_ErrorNone) {
@@ -497,4 +505,209 @@ TEST(MultiEncoderTest, VaryingBlockGeometrySizes) {
         << "Not all encoder threads completed";
 }
 
+/**
+ * @brief Test several encoders attached to the process-wide shared pool
+ *
+ * Each encoder opts into the shared thread pool with its own weight, so all
+ * of their pipeline kernels run on one set of workers capped at two running
+ * at once. Encoders start at staggered times and finish at different times,
+ * which exercises attaching to a busy pool, detaching while other handles
+ * still have work queued, and recreating the pool after the last handle
+ * leaves.
+ */
+TEST(MultiEncoderTest, SharedThreadPool) {
+    constexpr int kNumSharedEncoders = 4;
+    constexpr int kRounds = 2;
+
+    for (int round = 0; round < kRounds; round++) {
+        reset_test_state();
+
+        auto encoder_thread = [](int encoder_id) {
+            std::this_thread::sleep_for(
+                std::chrono::milliseconds(encoder_id * 5));
+
+            DummyVideoSource video_source(IMG_FMT_420, kWidth, kHeight, 8);
+            const int num_frames = kNumFrames / (encoder_id + 1);
+            if (video_source.open_source(0, num_frames) != EB_ErrorNone) {
+                log_error(
+                    encoder_id, "Failed to open video source", EB_ErrorMax);
+                return;
+            }
+
+            EbComponentType *encoder_handle = nullptr;
+            EbSvtAv1EncConfiguration config{};
+
+            auto use_shared_pool = [=](EbSvtAv1EncConfiguration &cfg) {
+                cfg.level_of_parallelism = 2;
+                cfg.shared_thread_pool = true;
+                cfg.thread_pool_weight = static_cast<uint8_t>(1 + encoder_id);
+                cfg.shared_pool_threads = 2;
+            };
+            if (!init_encoder(&encoder_handle,
+                              &config,
+                              encoder_id,
+                              GeometrySize::SMALL,
+                              use_shared_pool)) {
+                video_source.close_source();
+                return;
+            }
+
+            if (encode_frames(
+                    encoder_handle, video_source, num_frames, encoder_id)) {
+                flush_encoder(encoder_handle);
+            }
+
+            shutdown_encoder(encoder_handle);
+            video_source.close_source();
+            g_completed_encoders++;
+        };
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < kNumSharedEncoders; i++) {
+            threads.emplace_back(encoder_thread, i);
+        }
+
+        wait_for_completion(threads, kNumSharedEncoders);
+
+        EXPECT_FALSE(g_test_failed)
+            << "Shared thread pool test failed in round " << round;
+        EXPECT_EQ(g_completed_encoders.load(), kNumSharedEncoders)
+            << "Not all encoders completed in round " << round;
+    }
+}
+
+/**
+ * @brief Test that handles must agree on the shared pool's worker count
+ *
+ * The first handle creates the shared pool with its shared_pool_threads. A
+ * later handle asking for a different count fails to initialize instead of
+ * silently getting the first one, while a later handle that leaves it at 0
+ * attaches to the pool as is.
+ */
+TEST(MultiEncoderTest, SharedPoolThreadsMismatch) {
+    reset_test_state();
+
+    auto shared_pool_threads = [](uint32_t threads) {
+        return [=](EbSvtAv1EncConfiguration &cfg) {
+            cfg.level_of_parallelism = 2;
+            cfg.shared_thread_pool = true;
+            cfg.shared_pool_threads = threads;
+        };
+    };
+
+    EbComponentType *first = nullptr;
+    EbSvtAv1EncConfiguration first_config{};
+    ASSERT_TRUE(init_encoder(&first,
+                             &first_config,
+                             0,
+                             GeometrySize::SMALL,
+                             shared_pool_threads(2)));
+
+    EbComponentType *mismatch = nullptr;
+    EbSvtAv1EncConfiguration mismatch_config{};
+    ASSERT_EQ(svt_av1_enc_init_handle(&mismatch, &mismatch_config),
+              EB_ErrorNone);
+    configure_encoder(mismatch_config);
+    shared_pool_threads(3)(mismatch_config);
+    ASSERT_EQ(svt_av1_enc_set_parameter(mismatch, &mismatch_config),
+              EB_ErrorNone);
+    EXPECT_EQ(svt_av1_enc_init(mismatch), EB_ErrorBadParameter);
+    svt_av1_enc_deinit_handle(mismatch);
+
+    EbComponentType *any = nullptr;
+    EbSvtAv1EncConfiguration any_config{};
+    EXPECT_TRUE(init_encoder(
+        &any, &any_config, 2, GeometrySize::SMALL, shared_pool_threads(0)));
+
+    DummyVideoSource video_source(IMG_FMT_420, kWidth, kHeight, 8);
+    ASSERT_EQ(video_source.open_source(0, kNumFrames), EB_ErrorNone);
+    if (encode_frames(first, video_source, kNumFrames, 0)) {
+        flush_encoder(first);
+    }
+    video_source.close_source();
+
+    shutdown_encoder(any);
+    shutdown_encoder(first);
+    EXPECT_FALSE(g_test_failed);
+}
+
+/**
+ * @brief Test handles cloned from a configured handle
+ *
+ * Both clones start from the configuration of the source. The one at the
+ * same resolution shares the block geometry table built by the source, the
+ * other one encodes at half the resolution and shares it only when that
+ * resolution selects the same geometry. The source is deinitialized before
+ * either clone is initialized, so a shared table must outlive the handle that
+ * built it.
+ */
+TEST(MultiEncoderTest, CloneHandle) {
+    reset_test_state();
+
+    EbComponentType *source = nullptr;
+    EbSvtAv1EncConfiguration source_config{};
+    ASSERT_TRUE(init_encoder(&source, &source_config, 0));
+
+    EbComponentType *same = nullptr;
+    EbSvtAv1EncConfiguration same_config{};
+    ASSERT_EQ(svt_av1_enc_clone_handle(&same, source, &same_config),
+              EB_ErrorNone);
+    EXPECT_EQ(same_config.source_width, static_cast<uint32_t>(kWidth));
+    EXPECT_EQ(same_config.enc_mode, source_config.enc_mode);
+    EXPECT_EQ(same_config.target_bit_rate, source_config.target_bit_rate);
+
+    EbComponentType *half = nullptr;
+    EbSvtAv1EncConfiguration half_config{};
+    ASSERT_EQ(svt_av1_enc_clone_handle(&half, source, &half_config),
+              EB_ErrorNone);
+    half_config.source_width = kWidth / 2;
+    half_config.source_height = kHeight / 2;
+    half_config.target_bit_rate = kTargetBitrateKbps * 1000 / 4;
+
+    shutdown_encoder(source);
+
+    ASSERT_EQ(svt_av1_enc_set_parameter(same, &same_config), EB_ErrorNone);
+    ASSERT_EQ(svt_av1_enc_init(same), EB_ErrorNone);
+    ASSERT_EQ(svt_av1_enc_set_parameter(half, &half_config), EB_ErrorNone);
+    ASSERT_EQ(svt_av1_enc_init(half), EB_ErrorNone);
+
+    DummyVideoSource same_source(IMG_FMT_420, kWidth, kHeight, 8);
+    ASSERT_EQ(same_source.open_source(0, kNumFrames), EB_ErrorNone);
+    if (encode_frames(same, same_source, kNumFrames, 1)) {
+        flush_encoder(same);
+    }
+    same_source.close_source();
+    shutdown_encoder(same);
+
+    DummyVideoSource half_source(IMG_FMT_420, kWidth / 2, kHeight / 2, 8);
+    ASSERT_EQ(half_source.open_source(0, kNumFrames), EB_ErrorNone);
+    if (encode_frames(half, half_source, kNumFrames, 2)) {
+        flush_encoder(half);
+    }
+    half_source.close_source();
+    shutdown_encoder(half);
+
+    EXPECT_FALSE(g_test_failed) << "Cloned handle failed to encode";
+}
+
+/**
+ * @brief Test that only configured handles can be cloned
+ *
+ * A handle that never got svt_av1_enc_set_parameter() has no configuration
+ * to copy, so cloning it fails and leaves no handle behind.
+ */
+TEST(MultiEncoderTest, CloneUnconfiguredHandle) {
+    EbComponentType *source = nullptr;
+    EbSvtAv1EncConfiguration source_config{};
+    ASSERT_EQ(svt_av1_enc_init_handle(&source, &source_config), EB_ErrorNone);
+
+    EbComponentType *clone = nullptr;
+    EbSvtAv1EncConfiguration clone_config{};
+    EXPECT_EQ(svt_av1_enc_clone_handle(&clone, source, &clone_config),
+              EB_ErrorBadParameter);
+    EXPECT_EQ(clone, nullptr);
+
+    svt_av1_enc_deinit_handle(source);
+}
+
 }  // namespace
@@ -0,0 +1,216 @@
+/*
+ * Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file OutputAllocatorTest.cc
+ *
+ * @brief SVT-AV1 output allocator test
+ *
+ * Encodes a clip with a counting SvtAv1OutputAllocator set through
+ * svt_av1_enc_set_output_allocator() and checks that every buffer it hands
+ * out comes back exactly once, that the bitstream is the one the library
+ * allocation produces, and that packets the allocator declines are written
+ * to library memory that is never passed to its release.
+ *
+ ******************************************************************************/
+
+#include "EbSvtAv1Enc.h"
+#include "gtest/gtest.h"
+#include "DummyVideoSource.h"
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <vector>
+
+using svt_av1_video_source::DummyVideoSource;
+
+namespace {
+
+static constexpr uint32_t kWidth = 320;
+static constexpr uint32_t kHeight = 240;
+static constexpr uint32_t kNumFrames = 20;
+
+// Allocator that keeps track of every buffer it handed out. Declines every
+// decline_every-th request when decline_every is set.
+class CountingAllocator {
+  public:
+    explicit CountingAllocator(uint32_t decline_every = 0)
+        : decline_every_(decline_every) {
+        allocator_.ctx = this;
+        allocator_.alloc = alloc;
+        allocator_.release = release;
+    }
+
+    ~CountingAllocator() {
+        for (auto &buffer : live_)
+            free(buffer.first);
+    }
+
+    const SvtAv1OutputAllocator *get() const {
+        return &allocator_;
+    }
+
+    uint32_t allocs() const {
+        return allocs_;
+    }
+    uint32_t declined() const {
+        return declined_;
+    }
+    uint32_t releases() const {
+        return releases_;
+    }
+    // Buffers passed to release that this allocator did not hand out or had
+    // already got back
+    uint32_t foreign_releases() const {
+        return foreign_releases_;
+    }
+    size_t live() const {
+        return live_.size();
+    }
+
+  private:
+    static uint8_t *alloc(void *ctx, uint32_t size) {
+        CountingAllocator *self = static_cast<CountingAllocator *>(ctx);
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        const uint32_t request = self->allocs_ + self->declined_ + 1;
+        if (self->decline_every_ && request % self->decline_every_ == 0) {
+            self->declined_++;
+            return nullptr;
+        }
+        uint8_t *buffer = static_cast<uint8_t *>(malloc(size));
+        if (buffer) {
+            self->allocs_++;
+            self->live_[buffer] = size;
+        }
+        return buffer;
+    }
+
+    static void release(void *ctx, uint8_t *buffer) {
+        CountingAllocator *self = static_cast<CountingAllocator *>(ctx);
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        auto it = self->live_.find(buffer);
+        if (it == self->live_.end()) {
+            self->foreign_releases_++;
+            return;
+        }
+        self->live_.erase(it);
+        self->releases_++;
+        free(buffer);
+    }
+
+    SvtAv1OutputAllocator allocator_;
+    const uint32_t decline_every_;
+    std::mutex mutex_;
+    std::map<uint8_t *, uint32_t> live_;
+    uint32_t allocs_ = 0;
+    uint32_t declined_ = 0;
+    uint32_t releases_ = 0;
+    uint32_t foreign_releases_ = 0;
+};
+
+// Encode kNumFrames and return the concatenated packets, with the output
+// allocator when one is given
+static std::vector<uint8_t> encode_clip(
+    const SvtAv1OutputAllocator *allocator) {
+    std::vector<uint8_t> bitstream;
+    DummyVideoSource video_source(IMG_FMT_420, kWidth, kHeight, 8);
+    EXPECT_EQ(video_source.open_source(0, kNumFrames), EB_ErrorNone);
+
+    EbComponentType *handle = nullptr;
+    EbSvtAv1EncConfiguration config;
+    EXPECT_EQ(svt_av1_enc_init_handle(&handle, &config), EB_ErrorNone);
+    config.source_width = kWidth;
+    config.source_height = kHeight;
+    config.encoder_bit_depth = 8;
+    config.enc_mode = 10;
+    config.rate_control_mode = SVT_AV1_RC_MODE_CQP_OR_CRF;
+    config.qp = 35;
+    EXPECT_EQ(svt_av1_enc_set_parameter(handle, &config), EB_ErrorNone);
+    if (allocator) {
+        EXPECT_EQ(svt_av1_enc_set_output_allocator(handle, allocator),
+                  EB_ErrorNone);
+    }
+    EXPECT_EQ(svt_av1_enc_init(handle), EB_ErrorNone);
+
+    for (uint32_t i = 0; i < kNumFrames; i++) {
+        EbBufferHeaderType input{};
+        input.size = sizeof(input);
+        input.p_buffer =
+            reinterpret_cast<uint8_t *>(video_source.get_next_frame());
+        input.n_filled_len = video_source.get_frame_size();
+        input.pts = i;
+        input.pic_type = EB_AV1_INVALID_PICTURE;
+        EXPECT_EQ(svt_av1_enc_send_picture(handle, &input), EB_ErrorNone);
+    }
+    EbBufferHeaderType eos{};
+    eos.size = sizeof(eos);
+    eos.flags = EB_BUFFERFLAG_EOS;
+    eos.pic_type = EB_AV1_INVALID_PICTURE;
+    EXPECT_EQ(svt_av1_enc_send_picture(handle, &eos), EB_ErrorNone);
+    for (;;) {
+        EbBufferHeaderType *packet = nullptr;
+        if (svt_av1_enc_get_packet(handle, &packet, 1) != EB_ErrorNone)
+            break;
+        bitstream.insert(bitstream.end(),
+                         packet->p_buffer,
+                         packet->p_buffer + packet->n_filled_len);
+        const bool eos_packet = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+        svt_av1_enc_release_out_buffer(&packet);
+        if (eos_packet)
+            break;
+    }
+    EXPECT_EQ(svt_av1_enc_deinit(handle), EB_ErrorNone);
+    EXPECT_EQ(svt_av1_enc_deinit_handle(handle), EB_ErrorNone);
+    video_source.close_source();
+    return bitstream;
+}
+
+/**
+ * @brief Test that every buffer of the allocator is released exactly once
+ * and that the bitstream does not depend on who allocated it
+ */
+TEST(OutputAllocatorTest, ReleasesEveryBufferOnce) {
+    const std::vector<uint8_t> reference = encode_clip(nullptr);
+    ASSERT_FALSE(reference.empty());
+
+    CountingAllocator allocator;
+    const std::vector<uint8_t> bitstream = encode_clip(allocator.get());
+    EXPECT_GT(allocator.allocs(), 0u);
+    EXPECT_EQ(allocator.releases(), allocator.allocs());
+    EXPECT_EQ(allocator.foreign_releases(), 0u);
+    EXPECT_EQ(allocator.live(), 0u);
+    EXPECT_TRUE(bitstream == reference)
+        << "output allocator changed the bitstream";
+}
+
+/**
+ * @brief Test that declined packets fall back to library memory
+ *
+ * Every other alloc returns NULL. Those packets are still written, to memory
+ * of the library, and never reach the release of the allocator.
+ */
+TEST(OutputAllocatorTest, FallsBackWhenAllocFails) {
+    const std::vector<uint8_t> reference = encode_clip(nullptr);
+    ASSERT_FALSE(reference.empty());
+
+    CountingAllocator allocator(2);
+    const std::vector<uint8_t> bitstream = encode_clip(allocator.get());
+    EXPECT_GT(allocator.declined(), 0u);
+    EXPECT_GT(allocator.allocs(), 0u);
+    EXPECT_EQ(allocator.releases(), allocator.allocs());
+    EXPECT_EQ(allocator.foreign_releases(), 0u);
+    EXPECT_EQ(allocator.live(), 0u);
+    EXPECT_TRUE(bitstream == reference)
+        << "declined allocations changed the bitstream";
+}
+
+}  // namespace
@@ -0,0 +1,256 @@
+/*
+ * Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file StartupTimeTest.cc
+ *
+ * @brief SVT-AV1 time-to-first-packet benchmark
+ *
+ * Measures the time from svt_av1_enc_init_handle() to the first packet out of
+ * svt_av1_enc_get_packet(), split into handle creation, set_parameter, init
+ * and the encode of the first picture, for the workloads dominated by startup:
+ *   - AvifStill   — one 1280x720 picture in avif mode
+ *   - ShortClip   — the first packet of a 640x360 clip at a fast preset
+ * and, for the rungs of a ladder, the set up time of a handle cloned with
+ * svt_av1_enc_clone_handle() against one created from scratch:
+ *   - CloneRung   — 1280x720 and 640x360 rungs of a 1280x720 source
+ * The first run of a process also builds the process-wide tables, so it is
+ * reported apart from the median of the following runs.
+ *
+ * Opt in via:
+ *   --gtest_also_run_disabled_tests --gtest_filter='*StartupTime*'
+ ******************************************************************************/
+
+#include "EbSvtAv1Enc.h"
+#include "gtest/gtest.h"
+#include "DummyVideoSource.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+using svt_av1_video_source::DummyVideoSource;
+
+namespace {
+
+static constexpr int kRuns = 10;
+
+struct StartupTime {
+    double init_handle_ms;
+    double set_parameter_ms;
+    double init_ms;
+    double first_packet_ms;
+    double total_ms;
+};
+
+static double elapsed_ms(std::chrono::steady_clock::time_point from,
+                         std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+// Run one encoder from handle creation to its first packet, then drain it
+static bool time_first_packet(
+    uint32_t width, uint32_t height, uint32_t frames,
+    const std::function<void(EbSvtAv1EncConfiguration &)> &configure,
+    StartupTime *time) {
+    DummyVideoSource video_source(IMG_FMT_420, width, height, 8);
+    if (video_source.open_source(0, frames) != EB_ErrorNone)
+        return false;
+
+    EbComponentType *handle = nullptr;
+    EbSvtAv1EncConfiguration config;
+    const auto t0 = std::chrono::steady_clock::now();
+    if (svt_av1_enc_init_handle(&handle, &config) != EB_ErrorNone)
+        return false;
+    const auto t1 = std::chrono::steady_clock::now();
+    config.source_width = width;
+    config.source_height = height;
+    config.encoder_bit_depth = 8;
+    configure(config);
+    bool ok = svt_av1_enc_set_parameter(handle, &config) == EB_ErrorNone;
+    const auto t2 = std::chrono::steady_clock::now();
+    ok = ok && svt_av1_enc_init(handle) == EB_ErrorNone;
+    const auto t3 = std::chrono::steady_clock::now();
+
+    bool got_packet = false;
+    for (uint32_t i = 0; ok && i < frames; i++) {
+        EbBufferHeaderType input{};
+        input.size = sizeof(input);
+        input.p_buffer =
+            reinterpret_cast<uint8_t *>(video_source.get_next_frame());
+        input.n_filled_len = video_source.get_frame_size();
+        input.pts = i;
+        input.pic_type = EB_AV1_INVALID_PICTURE;
+        ok = svt_av1_enc_send_picture(handle, &input) == EB_ErrorNone;
+    }
+    if (ok) {
+        EbBufferHeaderType eos{};
+        eos.size = sizeof(eos);
+        eos.flags = EB_BUFFERFLAG_EOS;
+        eos.pic_type = EB_AV1_INVALID_PICTURE;
+        ok = svt_av1_enc_send_picture(handle, &eos) == EB_ErrorNone;
+    }
+    std::chrono::steady_clock::time_point t4 = t3;
+    while (ok) {
+        EbBufferHeaderType *packet = nullptr;
+        if (svt_av1_enc_get_packet(handle, &packet, 1) != EB_ErrorNone)
+            break;
+        if (!got_packet) {
+            t4 = std::chrono::steady_clock::now();
+            got_packet = true;
+        }
+        const bool eos = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+        svt_av1_enc_release_out_buffer(&packet);
+        if (eos)
+            break;
+    }
+    svt_av1_enc_deinit(handle);
+    svt_av1_enc_deinit_handle(handle);
+
+    time->init_handle_ms = elapsed_ms(t0, t1);
+    time->set_parameter_ms = elapsed_ms(t1, t2);
+    time->init_ms = elapsed_ms(t2, t3);
+    time->first_packet_ms = elapsed_ms(t3, t4);
+    time->total_ms = elapsed_ms(t0, t4);
+    return ok && got_packet;
+}
+
+static void print_time(const char *name, const char *run,
+                       const StartupTime &time) {
+    printf("%-10s %-7s init_handle %7.2f  set_parameter %7.2f  init %8.2f  "
+           "first packet %8.2f  total %8.2f ms\n",
+           name,
+           run,
+           time.init_handle_ms,
+           time.set_parameter_ms,
+           time.init_ms,
+           time.first_packet_ms,
+           time.total_ms);
+}
+
+static void run_benchmark(
+    const char *name, uint32_t width, uint32_t height, uint32_t frames,
+    const std::function<void(EbSvtAv1EncConfiguration &)> &configure) {
+    std::vector<StartupTime> times(kRuns);
+    for (int i = 0; i < kRuns; i++) {
+        ASSERT_TRUE(
+            time_first_packet(width, height, frames, configure, &times[i]))
+            << name << " run " << i;
+    }
+    print_time(name, "first", times[0]);
+    // Median of the runs after the first one, field by field
+    StartupTime median;
+    double StartupTime::*fields[] = {&StartupTime::init_handle_ms,
+                                     &StartupTime::set_parameter_ms,
+                                     &StartupTime::init_ms,
+                                     &StartupTime::first_packet_ms,
+                                     &StartupTime::total_ms};
+    for (auto field : fields) {
+        std::vector<double> values;
+        for (int i = 1; i < kRuns; i++)
+            values.push_back(times[i].*field);
+        std::nth_element(
+            values.begin(), values.begin() + values.size() / 2, values.end());
+        median.*field = values[values.size() / 2];
+    }
+    print_time(name, "median", median);
+}
+
+static void configure_rung(EbSvtAv1EncConfiguration &c) {
+    c.encoder_bit_depth = 8;
+    c.enc_mode = 10;
+    c.rate_control_mode = SVT_AV1_RC_MODE_CQP_OR_CRF;
+    c.qp = 35;
+}
+
+// Time the creation, set_parameter and init of one rung, cloned from src or,
+// when src is NULL, from scratch
+static bool time_rung_init(EbComponentType *src, uint32_t width,
+                           uint32_t height, double *ms) {
+    EbComponentType *handle = nullptr;
+    EbSvtAv1EncConfiguration config;
+    const auto t0 = std::chrono::steady_clock::now();
+    const EbErrorType err =
+        src ? svt_av1_enc_clone_handle(&handle, src, &config)
+            : svt_av1_enc_init_handle(&handle, &config);
+    if (err != EB_ErrorNone)
+        return false;
+    if (!src)
+        configure_rung(config);
+    config.source_width = width;
+    config.source_height = height;
+    const bool ok = svt_av1_enc_set_parameter(handle, &config) == EB_ErrorNone &&
+                    svt_av1_enc_init(handle) == EB_ErrorNone;
+    const auto t1 = std::chrono::steady_clock::now();
+    svt_av1_enc_deinit(handle);
+    svt_av1_enc_deinit_handle(handle);
+    *ms = elapsed_ms(t0, t1);
+    return ok;
+}
+
+static double median_rung_init(EbComponentType *src, uint32_t width,
+                               uint32_t height) {
+    std::vector<double> values(kRuns);
+    for (int i = 0; i < kRuns; i++) {
+        EXPECT_TRUE(time_rung_init(src, width, height, &values[i]))
+            << width << "x" << height << " run " << i;
+    }
+    std::nth_element(
+        values.begin(), values.begin() + values.size() / 2, values.end());
+    return values[values.size() / 2];
+}
+
+TEST(StartupTime, DISABLED_AvifStill) {
+    run_benchmark("AvifStill", 1280, 720, 1, [](EbSvtAv1EncConfiguration &c) {
+        c.avif = true;
+        c.enc_mode = 8;
+        c.qp = 30;
+    });
+}
+
+TEST(StartupTime, DISABLED_ShortClip) {
+    run_benchmark("ShortClip", 640, 360, 8, [](EbSvtAv1EncConfiguration &c) {
+        c.enc_mode = 10;
+        c.rate_control_mode = SVT_AV1_RC_MODE_CQP_OR_CRF;
+        c.qp = 35;
+    });
+}
+
+TEST(StartupTime, DISABLED_CloneRung) {
+    EbComponentType *src = nullptr;
+    EbSvtAv1EncConfiguration config;
+    ASSERT_EQ(svt_av1_enc_init_handle(&src, &config), EB_ErrorNone);
+    configure_rung(config);
+    config.source_width = 1280;
+    config.source_height = 720;
+    ASSERT_EQ(svt_av1_enc_set_parameter(src, &config), EB_ErrorNone);
+    ASSERT_EQ(svt_av1_enc_init(src), EB_ErrorNone);
+    // Build the process-wide tables before timing either path
+    double warm_up;
+    ASSERT_TRUE(time_rung_init(nullptr, 1280, 720, &warm_up));
+
+    const uint32_t rungs[][2] = {{1280, 720}, {640, 360}};
+    for (const auto &rung : rungs) {
+        const double fresh = median_rung_init(nullptr, rung[0], rung[1]);
+        const double clone = median_rung_init(src, rung[0], rung[1]);
+        printf("CloneRung  %4ux%-4u fresh %8.2f  clone %8.2f ms (median)\n",
+               rung[0],
+               rung[1],
+               fresh,
+               clone);
+    }
+    svt_av1_enc_deinit(src);
+    svt_av1_enc_deinit_handle(src);
+}
+
+}  // namespace
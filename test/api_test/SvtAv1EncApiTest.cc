@@ -197,6 +197,91 @@ TEST(EncApiTest, DISABLED_repeat_normal_setup) {
     }
 }
 
+/** @brief max_memory_mb_out_of_reach is a api test case
+ * EncApiTest.max_memory_mb_out_of_reach sets a memory budget below what the
+ * shortest pipeline needs at 320x192.
+ *
+ * Expected result: <br>
+ * svt_av1_enc_set_parameter() reports EB_ErrorBadParameter, and
+ * svt_av1_enc_init() reports EB_ErrorInsufficientResources since what it
+ * allocated is over the budget.
+ */
+TEST(EncApiTest, max_memory_mb_out_of_reach) {
+    SvtAv1Context context{};
+
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_init_handle(&context.enc_handle, &context.enc_params));
+    context.enc_params.source_width = 320;
+    context.enc_params.source_height = 192;
+    context.enc_params.max_memory_mb = 20;
+    EXPECT_EQ(
+        EB_ErrorBadParameter,
+        svt_av1_enc_set_parameter(context.enc_handle, &context.enc_params));
+    EXPECT_EQ(EB_ErrorInsufficientResources,
+              svt_av1_enc_init(context.enc_handle));
+    svt_av1_enc_deinit(context.enc_handle);
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit_handle(context.enc_handle));
+}
+
+/** @brief max_memory_mb_lowers_parallelism is a api test case
+ * EncApiTest.max_memory_mb_lowers_parallelism sets a budget that lp 4 does
+ * not fit at 320x192 because of its mode decision contexts.
+ *
+ * Expected result: <br>
+ * The encoder lowers its parallelism and look-ahead until it fits, and the
+ * memory it allocates at svt_av1_enc_init() stays within the budget.
+ */
+TEST(EncApiTest, max_memory_mb_lowers_parallelism) {
+    SvtAv1Context context{};
+    const uint32_t budget_mb = 40;
+
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_init_handle(&context.enc_handle, &context.enc_params));
+    context.enc_params.source_width = 320;
+    context.enc_params.source_height = 192;
+    context.enc_params.level_of_parallelism = 4;
+    context.enc_params.max_memory_mb = budget_mb;
+    ASSERT_EQ(
+        EB_ErrorNone,
+        svt_av1_enc_set_parameter(context.enc_handle, &context.enc_params));
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init(context.enc_handle));
+    SvtAv1MemoryUsage usage{};
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_get_stream_info(context.enc_handle,
+                                          SVT_AV1_STREAM_INFO_MEMORY_USAGE,
+                                          &usage));
+    EXPECT_LE(usage.total, static_cast<uint64_t>(budget_mb) << 20);
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit(context.enc_handle));
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit_handle(context.enc_handle));
+}
+
+/** @brief thread_affinity_stays_with_caller is a api test case
+ * EncApiTest.thread_affinity_stays_with_caller passes thread_affinity as a
+ * string the library did not allocate and sets the parameters twice.
+ *
+ * Expected result: <br>
+ * svt_av1_enc_set_parameter() accepts the string both times and leaves the
+ * pointer of the caller untouched.
+ */
+TEST(EncApiTest, thread_affinity_stays_with_caller) {
+    SvtAv1Context context{};
+    char affinity[] = "0";
+
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_init_handle(&context.enc_handle, &context.enc_params));
+    context.enc_params.source_width = 320;
+    context.enc_params.source_height = 192;
+    context.enc_params.thread_affinity = affinity;
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(
+            EB_ErrorNone,
+            svt_av1_enc_set_parameter(context.enc_handle, &context.enc_params));
+        EXPECT_EQ(context.enc_params.thread_affinity, affinity);
+    }
+    EXPECT_STREQ(affinity, "0");
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit_handle(context.enc_handle));
+}
+
 }  // namespace
 
 /**
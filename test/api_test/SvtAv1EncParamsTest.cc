@@ -292,6 +292,70 @@ PARAM_TEST(EncParamOplLevelTest);
 DEFINE_PARAM_TEST_CLASS(EncParamLevelOfParallelismTest, level_of_parallelism);
 PARAM_TEST(EncParamLevelOfParallelismTest);
 
+/** Test case for enable_thread_pool*/
+DEFINE_PARAM_TEST_CLASS(EncParamEnableThreadPoolTest, enable_thread_pool);
+PARAM_TEST(EncParamEnableThreadPoolTest);
+
+/** Test case for lockfree_fifo*/
+DEFINE_PARAM_TEST_CLASS(EncParamLockfreeFifoTest, lockfree_fifo);
+PARAM_TEST(EncParamLockfreeFifoTest);
+
+/** Test case for dispatch_workers*/
+DEFINE_PARAM_TEST_CLASS(EncParamDispatchWorkersTest, dispatch_workers);
+PARAM_TEST(EncParamDispatchWorkersTest);
+
+/** Test case for shared_thread_pool*/
+DEFINE_PARAM_TEST_CLASS(EncParamSharedThreadPoolTest, shared_thread_pool);
+PARAM_TEST(EncParamSharedThreadPoolTest);
+
+/** Test case for thread_pool_weight*/
+DEFINE_PARAM_TEST_CLASS(EncParamThreadPoolWeightTest, thread_pool_weight);
+PARAM_TEST(EncParamThreadPoolWeightTest);
+
+/** Test case for shared_pool_threads*/
+DEFINE_PARAM_TEST_CLASS(EncParamSharedPoolThreadsTest, shared_pool_threads);
+PARAM_TEST(EncParamSharedPoolThreadsTest);
+
+/** Test case for numa_node*/
+DEFINE_PARAM_TEST_CLASS(EncParamNumaNodeTest, numa_node);
+PARAM_TEST(EncParamNumaNodeTest);
+
+/** Test case for pin_threads*/
+DEFINE_PARAM_TEST_CLASS(EncParamPinThreadsTest, pin_threads);
+PARAM_TEST(EncParamPinThreadsTest);
+
+/** Test case for thread_qos*/
+DEFINE_PARAM_TEST_CLASS(EncParamThreadQosTest, thread_qos);
+PARAM_TEST(EncParamThreadQosTest);
+
+/** Test case for pipeline_profile*/
+DEFINE_PARAM_TEST_CLASS(EncParamPipelineProfileTest, pipeline_profile);
+PARAM_TEST(EncParamPipelineProfileTest);
+
+/** Test case for zero_copy_input*/
+DEFINE_PARAM_TEST_CLASS(EncParamZeroCopyInputTest, zero_copy_input);
+PARAM_TEST(EncParamZeroCopyInputTest);
+
+/** Test case for lazy_pool_alloc*/
+DEFINE_PARAM_TEST_CLASS(EncParamLazyPoolAllocTest, lazy_pool_alloc);
+PARAM_TEST(EncParamLazyPoolAllocTest);
+
+/** Test case for pool_headroom*/
+DEFINE_PARAM_TEST_CLASS(EncParamPoolHeadroomTest, pool_headroom);
+PARAM_TEST(EncParamPoolHeadroomTest);
+
+/** Test case for max_memory_mb*/
+DEFINE_PARAM_TEST_CLASS(EncParamMaxMemoryMbTest, max_memory_mb);
+PARAM_TEST(EncParamMaxMemoryMbTest);
+
+/** Test case for huge_pages*/
+DEFINE_PARAM_TEST_CLASS(EncParamHugePagesTest, huge_pages);
+PARAM_TEST(EncParamHugePagesTest);
+
+/** Test case for compact_refs*/
+DEFINE_PARAM_TEST_CLASS(EncParamCompactRefsTest, compact_refs);
+PARAM_TEST(EncParamCompactRefsTest);
+
 /** Test case for recon_enabled*/
 DEFINE_PARAM_TEST_CLASS(EncParamReconEnabledTest, recon_enabled);
 PARAM_TEST(EncParamReconEnabledTest);
@@ -0,0 +1,228 @@
+/*
+ * Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file ThreadPoolTest.cc
+ *
+ * @brief SVT-AV1 kernel pool thread count test
+ *
+ * Encodes a random access clip with the pipeline kernels on a kernel pool
+ * (thread pool, dispatch workers or the process-wide shared pool) and samples
+ * the thread count of the process while it runs. Kernels routinely block
+ * inside the pipeline (e.g. on an exhausted empty pool), and the pool must
+ * hand their run permit to a bounded set of spare workers instead of growing
+ * towards one thread per kernel instance.
+ *
+ ******************************************************************************/
+
+#include "EbSvtAv1Enc.h"
+#include "gtest/gtest.h"
+#include "DummyVideoSource.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using svt_av1_video_source::DummyVideoSource;
+
+namespace {
+
+static constexpr uint32_t kWidth = 640;
+static constexpr uint32_t kHeight = 360;
+static constexpr uint32_t kNumFrames = 24;
+// Workers the pool keeps beyond its run permits (KERNEL_POOL_SPARE_THREADS)
+static constexpr uint32_t kSpareThreads = 2;
+
+// Threads of the calling process, 0 when it cannot be read
+static uint32_t process_thread_count() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 8, "Threads:") == 0)
+            return static_cast<uint32_t>(std::stoul(line.substr(8)));
+    }
+    return 0;
+}
+
+// Samples the process thread count until stopped and keeps the peak
+class ThreadCountSampler {
+  public:
+    ThreadCountSampler() : peak_(0), stop_(false) {
+        thread_ = std::thread([this] {
+            while (!stop_) {
+                peak_ = std::max(peak_.load(), process_thread_count());
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+    }
+    uint32_t stop() {
+        stop_ = true;
+        thread_.join();
+        return peak_;
+    }
+
+  private:
+    std::atomic<uint32_t> peak_;
+    std::atomic<bool> stop_;
+    std::thread thread_;
+};
+
+// Encode kNumFrames with the given configuration, then drain and close the
+// encoder. Returns false on any API failure.
+static bool encode_clip(
+    const std::function<void(EbSvtAv1EncConfiguration &)> &configure) {
+    DummyVideoSource video_source(IMG_FMT_420, kWidth, kHeight, 8);
+    if (video_source.open_source(0, kNumFrames) != EB_ErrorNone)
+        return false;
+
+    EbComponentType *handle = nullptr;
+    EbSvtAv1EncConfiguration config;
+    if (svt_av1_enc_init_handle(&handle, &config) != EB_ErrorNone)
+        return false;
+    config.source_width = kWidth;
+    config.source_height = kHeight;
+    config.encoder_bit_depth = 8;
+    config.enc_mode = 8;
+    config.rate_control_mode = SVT_AV1_RC_MODE_CQP_OR_CRF;
+    config.qp = 35;
+    configure(config);
+    bool ok = svt_av1_enc_set_parameter(handle, &config) == EB_ErrorNone &&
+              svt_av1_enc_init(handle) == EB_ErrorNone;
+
+    for (uint32_t i = 0; ok && i < kNumFrames; i++) {
+        EbBufferHeaderType input{};
+        input.size = sizeof(input);
+        input.p_buffer =
+            reinterpret_cast<uint8_t *>(video_source.get_next_frame());
+        input.n_filled_len = video_source.get_frame_size();
+        input.pts = i;
+        input.pic_type = EB_AV1_INVALID_PICTURE;
+        ok = svt_av1_enc_send_picture(handle, &input) == EB_ErrorNone;
+    }
+    if (ok) {
+        EbBufferHeaderType eos{};
+        eos.size = sizeof(eos);
+        eos.flags = EB_BUFFERFLAG_EOS;
+        eos.pic_type = EB_AV1_INVALID_PICTURE;
+        ok = svt_av1_enc_send_picture(handle, &eos) == EB_ErrorNone;
+    }
+    while (ok) {
+        EbBufferHeaderType *packet = nullptr;
+        if (svt_av1_enc_get_packet(handle, &packet, 1) != EB_ErrorNone)
+            break;
+        const bool eos = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+        svt_av1_enc_release_out_buffer(&packet);
+        if (eos)
+            break;
+    }
+    svt_av1_enc_deinit(handle);
+    svt_av1_enc_deinit_handle(handle);
+    video_source.close_source();
+    return ok;
+}
+
+// Peak number of threads the encoders added to the process while encoding,
+// each on its own application thread when there is more than one
+static uint32_t peak_encoder_threads(
+    const std::function<void(EbSvtAv1EncConfiguration &)> &configure,
+    uint32_t num_encoders = 1) {
+    const uint32_t before = process_thread_count();
+    ThreadCountSampler sampler;
+    uint32_t app_threads = 1;  // the sampler
+    if (num_encoders == 1) {
+        EXPECT_TRUE(encode_clip(configure));
+    } else {
+        std::vector<std::thread> threads;
+        std::atomic<uint32_t> failed{0};
+        for (uint32_t i = 0; i < num_encoders; i++) {
+            threads.emplace_back([&] {
+                if (!encode_clip(configure))
+                    failed++;
+            });
+        }
+        for (auto &t : threads)
+            t.join();
+        EXPECT_EQ(failed.load(), 0u);
+        app_threads += num_encoders;
+    }
+    const uint32_t peak = sampler.stop();
+    return peak > before + app_threads ? peak - before - app_threads : 0;
+}
+
+static uint32_t hardware_threads() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Test that the thread pool stays near its run permits
+ *
+ * At lp 3 the pool gets at most 5 run permits (fewer on smaller hosts) for
+ * roughly 50 kernel instances, so a pool that added a worker every time a
+ * kernel blocked would end up with one thread per instance.
+ */
+TEST(ThreadPoolTest, ThreadPoolThreadCountIsBounded) {
+    if (!process_thread_count())
+        GTEST_SKIP() << "process thread count not available";
+    const uint32_t target = std::min(5u, hardware_threads());
+    const uint32_t peak = peak_encoder_threads([](EbSvtAv1EncConfiguration &c) {
+        c.level_of_parallelism = 3;
+        c.enable_thread_pool = true;
+    });
+    EXPECT_LE(peak, target + kSpareThreads)
+        << "thread pool with " << target << " run permits";
+}
+
+/**
+ * @brief Test that dispatch workers create about N threads
+ *
+ * lp 6 alone would give every stage many instances and threads; with
+ * dispatch_workers the run permits are exactly N, whatever the host.
+ */
+TEST(ThreadPoolTest, DispatchWorkersThreadCountIsBounded) {
+    if (!process_thread_count())
+        GTEST_SKIP() << "process thread count not available";
+    constexpr uint32_t kWorkers = 2;
+    const uint32_t peak = peak_encoder_threads([](EbSvtAv1EncConfiguration &c) {
+        c.level_of_parallelism = 6;
+        c.dispatch_workers = kWorkers;
+    });
+    EXPECT_LE(peak, kWorkers + kSpareThreads)
+        << "dispatch_workers " << kWorkers;
+}
+
+/**
+ * @brief Test that the shared pool bounds the threads of all its handles
+ *
+ * Three lp 2 encoders attached to a shared pool with 2 run permits share one
+ * set of workers, so together they stay within the bound of a single pool.
+ */
+TEST(ThreadPoolTest, SharedPoolThreadCountIsBounded) {
+    if (!process_thread_count())
+        GTEST_SKIP() << "process thread count not available";
+    constexpr uint32_t kEncoders = 3;
+    constexpr uint32_t kPoolThreads = 2;
+    const uint32_t peak = peak_encoder_threads(
+        [](EbSvtAv1EncConfiguration &c) {
+            c.level_of_parallelism = 2;
+            c.shared_thread_pool = true;
+            c.shared_pool_threads = kPoolThreads;
+        },
+        kEncoders);
+    EXPECT_LE(peak, kPoolThreads + kSpareThreads)
+        << kEncoders << " handles on a shared pool of " << kPoolThreads;
+}
+
+}  // namespace
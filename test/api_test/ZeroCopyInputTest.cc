@@ -0,0 +1,232 @@
+/*
+ * Copyright(c) 2025 Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file ZeroCopyInputTest.cc
+ *
+ * @brief SVT-AV1 zero-copy input test
+ *
+ * Lends the planes of every input picture with svt_av1_enc_send_picture_lent()
+ * to an encoder running with zero_copy_input and counts the release_cb calls
+ * of each picture: exactly
+ * one per sent picture, whether the encode is drained through EOS or torn
+ * down with pictures still in flight. Also checks that lent pictures encode
+ * to the same bitstream as copied ones.
+ *
+ ******************************************************************************/
+
+#include "EbSvtAv1Enc.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace {
+
+static constexpr uint32_t kWidth = 320;
+static constexpr uint32_t kHeight = 240;
+static constexpr uint32_t kNumFrames = 20;
+
+// One input picture in the layout the encoder can use in place, and the
+// release_cb calls it got
+struct LentFrame {
+    std::vector<uint8_t> luma;
+    std::vector<uint8_t> cb;
+    std::vector<uint8_t> cr;
+    EbSvtIOFormat format{};
+    std::atomic<uint32_t> releases{0};
+    // Set once svt_av1_enc_send_picture_lent() returned; a release seen before
+    // that means the picture was copied instead of lent
+    std::atomic<bool> sent{false};
+    std::atomic<bool> released_after_send{false};
+};
+
+static void release_frame(void *release_ctx) {
+    LentFrame *frame = static_cast<LentFrame *>(release_ctx);
+    if (frame->sent)
+        frame->released_after_send = true;
+    frame->releases++;
+}
+
+// Fill a frame with a moving gradient so that the encode has some motion
+static std::unique_ptr<LentFrame> make_frame(const SvtAv1InputLayout &layout,
+                                             uint32_t index) {
+    std::unique_ptr<LentFrame> frame(new LentFrame);
+    frame->luma.assign(layout.luma_size, 0);
+    frame->cb.assign(layout.chroma_size, 0);
+    frame->cr.assign(layout.chroma_size, 0);
+    uint8_t *luma = frame->luma.data() + layout.luma_offset;
+    for (uint32_t y = 0; y < kHeight; y++) {
+        for (uint32_t x = 0; x < kWidth; x++) {
+            luma[y * layout.y_stride + x] =
+                static_cast<uint8_t>(x + 2 * y + 3 * index + ((x * y) >> 7));
+        }
+    }
+    uint8_t *cb = frame->cb.data() + layout.chroma_offset;
+    uint8_t *cr = frame->cr.data() + layout.chroma_offset;
+    for (uint32_t y = 0; y < kHeight / 2; y++) {
+        for (uint32_t x = 0; x < kWidth / 2; x++) {
+            cb[y * layout.uv_stride + x] = static_cast<uint8_t>(128 + x - y);
+            cr[y * layout.uv_stride + x] = static_cast<uint8_t>(96 + y + index);
+        }
+    }
+    frame->format.luma = luma;
+    frame->format.cb = cb;
+    frame->format.cr = cr;
+    frame->format.y_stride = layout.y_stride;
+    frame->format.cb_stride = layout.uv_stride;
+    frame->format.cr_stride = layout.uv_stride;
+    return frame;
+}
+
+class ZeroCopyInputTest : public ::testing::Test {
+  protected:
+    void TearDown() override {
+        if (handle_) {
+            svt_av1_enc_deinit(handle_);
+            svt_av1_enc_deinit_handle(handle_);
+        }
+    }
+
+    void init_encoder(bool zero_copy_input) {
+        EbSvtAv1EncConfiguration config;
+        ASSERT_EQ(svt_av1_enc_init_handle(&handle_, &config), EB_ErrorNone);
+        config.source_width = kWidth;
+        config.source_height = kHeight;
+        config.encoder_bit_depth = 8;
+        config.enc_mode = 10;
+        config.rate_control_mode = SVT_AV1_RC_MODE_CQP_OR_CRF;
+        config.qp = 35;
+        config.zero_copy_input = zero_copy_input;
+        ASSERT_EQ(svt_av1_enc_set_parameter(handle_, &config), EB_ErrorNone);
+        ASSERT_EQ(svt_av1_enc_init(handle_), EB_ErrorNone);
+        ASSERT_EQ(svt_av1_enc_get_stream_info(
+                      handle_, SVT_AV1_STREAM_INFO_INPUT_LAYOUT, &layout_),
+                  EB_ErrorNone);
+        frames_.clear();
+        for (uint32_t i = 0; i < kNumFrames; i++)
+            frames_.push_back(make_frame(layout_, i));
+    }
+
+    void send_frames(uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            EbBufferHeaderType input{};
+            input.size = sizeof(input);
+            input.p_buffer = reinterpret_cast<uint8_t *>(&frames_[i]->format);
+            input.n_filled_len = layout_.luma_size + 2 * layout_.chroma_size;
+            input.pts = i;
+            input.pic_type = EB_AV1_INVALID_PICTURE;
+            ASSERT_EQ(svt_av1_enc_send_picture_lent(
+                          handle_, &input, release_frame, frames_[i].get()),
+                      EB_ErrorNone);
+            frames_[i]->sent = true;
+        }
+    }
+
+    // Send EOS and collect the bitstream up to the EOS packet
+    void drain(std::vector<uint8_t> *bitstream) {
+        EbBufferHeaderType eos{};
+        eos.size = sizeof(eos);
+        eos.flags = EB_BUFFERFLAG_EOS;
+        eos.pic_type = EB_AV1_INVALID_PICTURE;
+        ASSERT_EQ(svt_av1_enc_send_picture(handle_, &eos), EB_ErrorNone);
+        for (;;) {
+            EbBufferHeaderType *packet = nullptr;
+            ASSERT_EQ(svt_av1_enc_get_packet(handle_, &packet, 1), EB_ErrorNone);
+            bitstream->insert(bitstream->end(),
+                              packet->p_buffer,
+                              packet->p_buffer + packet->n_filled_len);
+            const bool eos_packet = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+            svt_av1_enc_release_out_buffer(&packet);
+            if (eos_packet)
+                break;
+        }
+    }
+
+    void close_encoder() {
+        ASSERT_EQ(svt_av1_enc_deinit(handle_), EB_ErrorNone);
+        ASSERT_EQ(svt_av1_enc_deinit_handle(handle_), EB_ErrorNone);
+        handle_ = nullptr;
+    }
+
+    EbComponentType *handle_ = nullptr;
+    SvtAv1InputLayout layout_{};
+    std::vector<std::unique_ptr<LentFrame>> frames_;
+};
+
+/**
+ * @brief Test that every lent picture is handed back exactly once at EOS
+ *
+ * The pictures are referenced past svt_av1_enc_send_picture_lent(), so at least
+ * some of them must come back later. Draining through EOS hands them back,
+ * and closing the encoder afterwards must not release any of them again.
+ */
+TEST_F(ZeroCopyInputTest, ReleasesEveryPictureOnceAtEos) {
+    init_encoder(true);
+    send_frames(kNumFrames);
+    std::vector<uint8_t> bitstream;
+    drain(&bitstream);
+    close_encoder();
+
+    uint32_t lent = 0;
+    for (uint32_t i = 0; i < kNumFrames; i++) {
+        EXPECT_EQ(frames_[i]->releases.load(), 1u) << "picture " << i;
+        lent += frames_[i]->released_after_send ? 1 : 0;
+    }
+    EXPECT_GT(lent, 0u) << "no picture was used in place";
+}
+
+/**
+ * @brief Test that pictures in flight are handed back once at teardown
+ *
+ * The encoder is closed without EOS while it still holds most of the
+ * pictures; svt_av1_enc_deinit() must release each of them exactly once.
+ */
+TEST_F(ZeroCopyInputTest, ReleasesEveryPictureOnceOnTeardown) {
+    init_encoder(true);
+    send_frames(kNumFrames);
+    // Without EOS the look-ahead keeps the last pictures
+    uint32_t released = 0;
+    for (uint32_t i = 0; i < kNumFrames; i++)
+        released += frames_[i]->releases.load();
+    EXPECT_LT(released, kNumFrames);
+    close_encoder();
+    for (uint32_t i = 0; i < kNumFrames; i++)
+        EXPECT_EQ(frames_[i]->releases.load(), 1u) << "picture " << i;
+}
+
+/**
+ * @brief Test that lent pictures encode like copied ones
+ */
+TEST_F(ZeroCopyInputTest, MatchesCopiedInput) {
+    std::vector<uint8_t> copied, lent;
+    init_encoder(false);
+    send_frames(kNumFrames);
+    drain(&copied);
+    close_encoder();
+    // Without zero_copy_input the pictures are copied and handed back before
+    // svt_av1_enc_send_picture_lent() returns
+    for (uint32_t i = 0; i < kNumFrames; i++) {
+        EXPECT_EQ(frames_[i]->releases.load(), 1u) << "picture " << i;
+        EXPECT_FALSE(frames_[i]->released_after_send) << "picture " << i;
+    }
+
+    init_encoder(true);
+    send_frames(kNumFrames);
+    drain(&lent);
+    close_encoder();
+
+    ASSERT_FALSE(copied.empty());
+    EXPECT_TRUE(copied == lent) << "lent input changed the bitstream";
+}
+
+}  // namespace
@@ -847,6 +847,191 @@ static const vector<uint32_t> invalid_level_of_parallelism = {
     // ...
 };
 
+/* Run all pipeline kernels on one shared work-stealing pool (lp > 1 only). */
+static const vector<bool> default_enable_thread_pool = {
+    false,
+};
+static const vector<bool> valid_enable_thread_pool = {
+    false,
+    true,
+};
+static const vector<bool> invalid_enable_thread_pool = {
+    // none
+};
+
+/* Lock-free rings between per-stage threads. */
+static const vector<bool> default_lockfree_fifo = {
+    true,
+};
+static const vector<bool> valid_lockfree_fifo = {
+    false,
+    true,
+};
+static const vector<bool> invalid_lockfree_fifo = {
+    // none
+};
+
+/* Number of cooperative workers driving the kernel table (lp > 1 only). */
+static const vector<uint8_t> default_dispatch_workers = {
+    0,
+};
+static const vector<uint8_t> valid_dispatch_workers = {
+    0, 1, 2, 4, 8,
+};
+static const vector<uint8_t> invalid_dispatch_workers = {
+    9,
+    255,
+};
+
+/* Attach to the process-wide shared worker pool (lp > 1 only). */
+static const vector<bool> default_shared_thread_pool = {
+    false,
+};
+static const vector<bool> valid_shared_thread_pool = {
+    false,
+    true,
+};
+static const vector<bool> invalid_shared_thread_pool = {
+    // none
+};
+
+/* Share of the shared worker pool given to the handle. */
+static const vector<uint8_t> default_thread_pool_weight = {
+    1,
+};
+static const vector<uint8_t> valid_thread_pool_weight = {
+    1, 2, 16, 255,
+};
+static const vector<uint8_t> invalid_thread_pool_weight = {
+    0,
+};
+
+/* Concurrently running workers of the shared pool, 0 for the core count. */
+static const vector<uint32_t> default_shared_pool_threads = {
+    0,
+};
+static const vector<uint32_t> valid_shared_pool_threads = {
+    0, 1, 4, 64,
+};
+static const vector<uint32_t> invalid_shared_pool_threads = {
+    // none
+};
+
+/* NUMA node the handle is placed on, -1 for no placement. */
+static const vector<int8_t> default_numa_node = {
+    -1,
+};
+static const vector<int8_t> valid_numa_node = {
+    -1, 0, 1, 63,
+};
+static const vector<int8_t> invalid_numa_node = {
+    -2, 64, 127,
+};
+
+/* Pin the encoder threads to the first N processors, 0 for no pinning. */
+static const vector<uint32_t> default_pin_threads = {
+    0,
+};
+static const vector<uint32_t> valid_pin_threads = {
+    0, 1, 4, 64,
+};
+static const vector<uint32_t> invalid_pin_threads = {
+    // none
+};
+
+/* Scheduler priority of latency-critical stages over bulk stages. */
+static const vector<uint8_t> default_thread_qos = {
+    0,
+};
+static const vector<uint8_t> valid_thread_qos = {
+    0, 1, 2,
+};
+static const vector<uint8_t> invalid_thread_qos = {
+    3, 255,
+};
+
+/* Per-stage pipeline profiling level. */
+static const vector<uint8_t> default_pipeline_profile = {
+    0,
+};
+static const vector<uint8_t> valid_pipeline_profile = {
+    0, 1, 2,
+};
+static const vector<uint8_t> invalid_pipeline_profile = {
+    3, 255,
+};
+
+/* Use 8-bit input planes in place instead of copying them. */
+static const vector<bool> default_zero_copy_input = {
+    false,
+};
+static const vector<bool> valid_zero_copy_input = {
+    false,
+    true,
+};
+static const vector<bool> invalid_zero_copy_input = {
+    // none
+};
+
+/* Allocate the picture pools on demand. */
+static const vector<bool> default_lazy_pool_alloc = {
+    false,
+};
+static const vector<bool> valid_lazy_pool_alloc = {
+    false,
+    true,
+};
+static const vector<bool> invalid_lazy_pool_alloc = {
+    // none
+};
+
+/* Share of the extra pictures in flight kept in the picture pools. */
+static const vector<uint8_t> default_pool_headroom = {
+    100,
+};
+static const vector<uint8_t> valid_pool_headroom = {
+    0, 50, 100,
+};
+static const vector<uint8_t> invalid_pool_headroom = {
+    101, 255,
+};
+
+/* Memory budget of the picture pools and thread contexts in MiB, 0 for none.
+ * A budget below what the shortest pipeline needs is rejected. */
+static const vector<uint32_t> default_max_memory_mb = {
+    0,
+};
+static const vector<uint32_t> valid_max_memory_mb = {
+    0, 512, 65536,
+};
+static const vector<uint32_t> invalid_max_memory_mb = {
+    1,
+};
+
+/* Page size of the picture buffers: 0 regular, 1 transparent huge pages,
+ * 2 hugetlbfs pool. */
+static const vector<uint8_t> default_huge_pages = {
+    0,
+};
+static const vector<uint8_t> valid_huge_pages = {
+    0, 1, 2,
+};
+static const vector<uint8_t> invalid_huge_pages = {
+    3, 255,
+};
+
+/* Keep the 2 bit planes of the 10-bit reference pictures compressed. */
+static const vector<bool> default_compact_refs = {
+    false,
+};
+static const vector<bool> valid_compact_refs = {
+    false,
+    true,
+};
+static const vector<bool> invalid_compact_refs = {
+    // none
+};
+
 // Debug tools
 
 /* Output reconstructed yuv used for debug purposes. The value is set through
@@ -171,6 +171,8 @@ void SvtAv1E2ETestFramework::init_test(TestVideoVector &test_vector) {
     start_pos_ = std::get<7>(test_vector);
     frames_to_test_ = std::get<8>(test_vector);
     frame_sizes_.clear();
+    frame_timings_.clear();
+    bitstream_.clear();
     video_src_ = prepare_video_src(test_vector);
     psnr_src_ = prepare_video_src(test_vector);
 
@@ -248,6 +250,19 @@ void SvtAv1E2ETestFramework::init_test(TestVideoVector &test_vector) {
             av1enc_ctx_.enc_params.recon_enabled = 1;
     }
 
+    // motion field files, set through MeFieldInFile and MeFieldOutFile
+    if (enc_config_->me_field_in_file) {
+        return_error = load_me_fields(enc_config_.get());
+        ASSERT_EQ(return_error, EB_ErrorNone)
+            << "load_me_fields return error:" << return_error;
+    }
+    if (enc_config_->me_field_out_file) {
+        enc_config_->svt_encoder_handle = av1enc_ctx_.enc_handle;
+        return_error = export_me_fields(enc_config_.get());
+        ASSERT_EQ(return_error, EB_ErrorNone)
+            << "export_me_fields return error:" << return_error;
+    }
+
     // set the parameter to encoder
     return_error = svt_av1_enc_set_parameter(av1enc_ctx_.enc_handle,
                                              &av1enc_ctx_.enc_params);
@@ -336,6 +351,18 @@ void SvtAv1E2ETestFramework::deinit_test() {
         delete ref_compare_;
         ref_compare_ = nullptr;
     }
+
+    // the motion field files serve a single encode
+    release_me_fields(enc_config_.get());
+    enc_config_->svt_encoder_handle = nullptr;
+    if (enc_config_->me_field_out_file) {
+        fclose(enc_config_->me_field_out_file);
+        enc_config_->me_field_out_file = nullptr;
+    }
+    if (enc_config_->me_field_in_file) {
+        fclose(enc_config_->me_field_in_file);
+        enc_config_->me_field_in_file = nullptr;
+    }
 }
 
 void SvtAv1E2ETestFramework::output_stat() {
@@ -413,12 +440,50 @@ void SvtAv1E2ETestFramework::gen_frame_event(const EncTestSetting &setting,
                 new_node->node_type = PRESET_CHANGE_EVENT;
                 new_node->data = data;
             } break;
+            case FRAME_TIMING_EVENT: {
+                SvtAv1FrameTimingInfo *data = (SvtAv1FrameTimingInfo *)malloc(
+                    sizeof(SvtAv1FrameTimingInfo));
+                ASSERT_NE(data, nullptr);
+                data->record_timing = true;
+                new_node->size = sizeof(SvtAv1FrameTimingInfo);
+                new_node->node_type = FRAME_TIMING_EVENT;
+                new_node->data = data;
+            } break;
+            case THREAD_SCALE_EVENT: {
+                SvtAv1ThreadScaleInfo *data = (SvtAv1ThreadScaleInfo *)malloc(
+                    sizeof(SvtAv1ThreadScaleInfo));
+                ASSERT_NE(data, nullptr);
+                data->active_percent = std::stoi(std::get<3>(event)[0]);
+                new_node->size = sizeof(SvtAv1ThreadScaleInfo);
+                new_node->node_type = THREAD_SCALE_EVENT;
+                new_node->data = data;
+            } break;
             default: GTEST_FAIL() << "unhandled frame event"; break;
             }
             new_node->next = node;
             node = new_node;
         }
     }
+    // imported motion field of the picture, if any
+    if (frame_count < enc_config_->me_field_count &&
+        enc_config_->me_fields[frame_count]) {
+        const SvtAv1MeField *field = enc_config_->me_fields[frame_count];
+        const size_t size = SVT_AV1_ME_FIELD_SIZE(field->b64_cols,
+                                                  field->b64_rows,
+                                                  field->ref_count,
+                                                  field->block_count);
+        EbPrivDataNode *new_node =
+            (EbPrivDataNode *)malloc(sizeof(EbPrivDataNode));
+        ASSERT_NE(new_node, nullptr);
+        void *data = malloc(size);
+        ASSERT_NE(data, nullptr);
+        memcpy(data, field, size);
+        new_node->size = (uint32_t)size;
+        new_node->node_type = ME_FIELD_EVENT;
+        new_node->data = data;
+        new_node->next = node;
+        node = new_node;
+    }
     *head = node;
 }
 
@@ -663,6 +728,11 @@ void SvtAv1E2ETestFramework::process_compress_data(
     const EbBufferHeaderType *data) {
     ASSERT_NE(data, nullptr);
     frame_sizes_.push_back(data->n_filled_len);
+    bitstream_.insert(
+        bitstream_.end(), data->p_buffer, data->p_buffer + data->n_filled_len);
+    SvtAv1FrameTiming timing;
+    if (svt_av1_enc_get_packet_timing(data, &timing) == EB_ErrorNone)
+        frame_timings_.push_back(timing);
     if (refer_dec_ == nullptr) {
         if (output_file_)
             write_compress_data(data);
@@ -27,6 +27,9 @@
 #include "PerformanceCollect.h"
 #include "CompareTools.h"
 #include "app_config.h"
+extern "C" {
+#include "app_context.h"
+}
 #include "definitions.h"
 #include "RefDecoder.h"
 // Copied from EbAppProcessCmd.c
@@ -180,6 +183,9 @@ class SvtAv1E2ETestFramework : public ::testing::TestWithParam<EncTestSetting> {
     PerformanceCollect *collect_;   /**< performance and time collection*/
     std::vector<uint32_t>
         frame_sizes_;            /**< per-frame compressed sizes (bytes) */
+    std::vector<SvtAv1FrameTiming>
+        frame_timings_; /**< stage timestamps of the timed packets */
+    std::vector<uint8_t> bitstream_; /**< all packets of the encode */
     VideoSource *psnr_src_;      /**< video source context for psnr */
     ICompareQueue *ref_compare_; /**< sink of reference to compare with recon*/
     PsnrStatistics pnsr_statistics_; /**< psnr statistics recorder.*/
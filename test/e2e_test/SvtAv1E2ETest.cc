@@ -968,6 +968,120 @@ INSTANTIATE_TEST_SUITE_P(SvtAv1, PresetChangeOnFlyTest,
                          ::testing::ValuesIn(preset_change_settings),
                          EncTestSetting::GetSettingName);
 
+// Worker thread scaling on-the-fly tests
+// Drop to 25% -> 50% -> 1% of the workers and back to 100%, every 20 frames
+static std::vector<TestFrameEvent> generate_thread_scale_events() {
+    std::vector<TestFrameEvent> events;
+    const int percents[] = {25, 50, 1, 100};
+    const int frames_per_phase = 20;
+    for (int phase = 0; phase < 4; phase++) {
+        uint32_t frame = (phase + 1) * frames_per_phase;
+        events.push_back(std::make_tuple(
+            "ThreadScale@" + std::to_string(frame) + "=" +
+                std::to_string(percents[phase]) + "%",
+            frame,
+            THREAD_SCALE_EVENT,
+            std::vector<std::string>{std::to_string(percents[phase])}));
+    }
+    return events;
+}
+
+/* clang-format off */
+static const std::vector<EncTestSetting> thread_scale_settings = {
+    {"ThreadScaleRandomAccess",
+     {{"EncoderMode", "10"},
+      {"LevelOfParallelism", "4"}},
+     preset_change_test_vectors,
+     generate_thread_scale_events()},
+    {"ThreadScaleLowDelay",
+     {{"EncoderMode", "10"},
+      {"PredStructure", "1"},
+      {"LevelOfParallelism", "4"}},
+     preset_change_test_vectors,
+     generate_thread_scale_events()},
+};
+/* clang-format on */
+
+// Parked workers must not change the output: recon is checked against the decoder
+class ThreadScaleOnFlyDeathTest : public SvtAv1E2ETestFramework {
+  protected:
+    void config_test() override {
+        enable_decoder = true;
+        enable_recon = true;
+        enable_stat = true;
+        enable_config = true;
+        SvtAv1E2ETestFramework::config_test();
+    }
+};
+
+TEST_P(ThreadScaleOnFlyDeathTest, NoHangThreadScaling) {
+    run_death_test();
+}
+
+INSTANTIATE_TEST_SUITE_P(SvtAv1, ThreadScaleOnFlyDeathTest,
+                         ::testing::ValuesIn(thread_scale_settings),
+                         EncTestSetting::GetSettingName);
+
+// Per-frame timing tests
+// Request the stage timestamps of every 10th frame
+static std::vector<TestFrameEvent> generate_frame_timing_events() {
+    std::vector<TestFrameEvent> events;
+    for (uint32_t frame = 0; frame < 60; frame += 10) {
+        events.push_back(
+            std::make_tuple("FrameTiming@" + std::to_string(frame),
+                            frame,
+                            FRAME_TIMING_EVENT,
+                            std::vector<std::string>{}));
+    }
+    return events;
+}
+
+/* clang-format off */
+static const std::vector<EncTestSetting> frame_timing_settings = {
+    {"FrameTimingRandomAccess",
+     {{"EncoderMode", "10"}},
+     preset_change_test_vectors,
+     generate_frame_timing_events()},
+    {"FrameTimingLowDelay",
+     {{"EncoderMode", "10"},
+      {"PredStructure", "1"}},
+     preset_change_test_vectors,
+     generate_frame_timing_events()},
+};
+/* clang-format on */
+
+class FrameTimingTest : public SvtAv1E2ETestFramework {};
+
+// Exactly the requested packets carry a record, stamped from input to output
+TEST_P(FrameTimingTest, TimingPerRequestedPacket) {
+    config_test();
+    for (auto test_vector : enc_setting.test_vectors) {
+        init_test(test_vector);
+        run_encode_process();
+
+        EXPECT_EQ(frame_timings_.size(), enc_setting.event_vector.size());
+        for (const SvtAv1FrameTiming &timing : frame_timings_) {
+            const uint64_t input = timing.stage_us[SVT_AV1_FRAME_STAGE_INPUT];
+            const uint64_t output = timing.stage_us[SVT_AV1_FRAME_STAGE_OUTPUT];
+            EXPECT_NE(input, 0u);
+            EXPECT_GE(output, input);
+            for (int stage = 0; stage < SVT_AV1_FRAME_STAGE_COUNT; stage++) {
+                if (timing.stage_us[stage]) {
+                    EXPECT_GE(timing.stage_us[stage], input);
+                    EXPECT_LE(timing.stage_us[stage], output);
+                }
+            }
+            EXPECT_NE(timing.stage_us[SVT_AV1_FRAME_STAGE_EC], 0u);
+        }
+
+        deinit_test();
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SvtAv1, FrameTimingTest,
+                         ::testing::ValuesIn(frame_timing_settings),
+                         EncTestSetting::GetSettingName);
+
 // Post-encode recode VBV compliance tests for RTC CBR.
 // Encodes with a sharp rate drop to stress VBV, then compares max buffer
 // fullness WITH vs WITHOUT recode to verify the recode path helps.
@@ -1093,3 +1207,228 @@ TEST_P(PostEncRecodeTest, VBVCompliance) {
 INSTANTIATE_TEST_SUITE_P(SvtAv1, PostEncRecodeTest,
                          ::testing::ValuesIn(post_enc_recode_settings),
                          EncTestSetting::GetSettingName);
+
+// Open-loop motion field export and import tests.
+// A leader encode writes its motion fields through MeFieldOutFile, the same
+// SVTMEF file as --me-field-out, and a follower encode of the same source
+// imports them through MeFieldInFile.
+static std::vector<TestVideoVector> me_field_test_vectors = {
+    std::make_tuple("kirland_640_480_30.yuv", YUV_VIDEO_FILE, IMG_FMT_420, 640,
+                    480, 8, 0, 0, 30),
+};
+
+/* clang-format off */
+static const std::vector<EncTestSetting> me_field_settings = {
+    {"MeFieldB64",
+     {{"EncoderMode", "8"},
+      {"CRF", "35"}},
+     me_field_test_vectors},
+    {"MeFieldAllBlocks",
+     {{"EncoderMode", "8"},
+      {"CRF", "35"},
+      {"MeFieldAllBlocks", "1"}},
+     me_field_test_vectors},
+};
+/* clang-format on */
+
+class MeFieldTest : public SvtAv1E2ETestFramework {
+  protected:
+    void config_test() override {
+        enable_decoder = true;
+        enable_recon = true;
+        enable_config = true;
+        SvtAv1E2ETestFramework::config_test();
+    }
+
+    std::string me_field_path() const {
+        return enc_setting.name + ".mef";
+    }
+
+    // Encode the vector with the motion field file given by token, and
+    // return the bitstream
+    std::vector<uint8_t> encode_with_me_field(TestVideoVector &test_vector,
+                                              const char *token) {
+        EXPECT_EQ(set_enc_config(
+                      enc_config_.get(), token, me_field_path().c_str()),
+                  EB_ErrorNone);
+        init_test(test_vector);
+        run_encode_process();
+        std::vector<uint8_t> bitstream = bitstream_;
+        deinit_test();
+        return bitstream;
+    }
+};
+
+// The file holds one well-formed field per searched picture, and a follower
+// at another rate seeded with it stays conformant
+TEST_P(MeFieldTest, FileRoundTrip) {
+    config_test();
+    const bool all_blocks = enc_setting.setting.count("MeFieldAllBlocks") != 0;
+    for (auto test_vector : enc_setting.test_vectors) {
+        const std::vector<uint8_t> leader =
+            encode_with_me_field(test_vector, "MeFieldOutFile");
+        ASSERT_FALSE(leader.empty());
+
+        ASSERT_EQ(set_enc_config(enc_config_.get(),
+                                 "MeFieldInFile",
+                                 me_field_path().c_str()),
+                  EB_ErrorNone);
+        ASSERT_EQ(load_me_fields(enc_config_.get()), EB_ErrorNone);
+        const uint32_t width = std::get<3>(test_vector);
+        const uint32_t height = std::get<4>(test_vector);
+        uint32_t fields = 0;
+        for (uint64_t i = 0; i < enc_config_->me_field_count; i++) {
+            const SvtAv1MeField *field = enc_config_->me_fields[i];
+            if (!field)
+                continue;
+            fields++;
+            EXPECT_EQ(field->picture_number, i);
+            EXPECT_EQ(field->width, width);
+            EXPECT_EQ(field->height, height);
+            EXPECT_EQ(field->b64_cols, (width + 63) / 64);
+            EXPECT_EQ(field->b64_rows, (height + 63) / 64);
+            EXPECT_GT(field->ref_count, 0u);
+            EXPECT_EQ(field->block_count,
+                      all_blocks ? SVT_AV1_ME_FIELD_BLOCKS : 1u);
+            for (uint8_t r = 0; r < field->ref_count; r++)
+                EXPECT_NE(field->ref_picture_number[r], i);
+        }
+        // every picture but the key frame is searched
+        EXPECT_GT(fields, 0u);
+        EXPECT_LT(fields, std::get<8>(test_vector));
+        release_me_fields(enc_config_.get());
+        fclose(enc_config_->me_field_in_file);
+        enc_config_->me_field_in_file = nullptr;
+
+        ASSERT_EQ(set_enc_config(enc_config_.get(), "CRF", "45"), EB_ErrorNone);
+        const std::vector<uint8_t> follower =
+            encode_with_me_field(test_vector, "MeFieldInFile");
+        EXPECT_FALSE(follower.empty());
+        ASSERT_EQ(set_enc_config(enc_config_.get(), "CRF", "35"), EB_ErrorNone);
+        remove(me_field_path().c_str());
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SvtAv1, MeFieldTest,
+                         ::testing::ValuesIn(me_field_settings),
+                         EncTestSetting::GetSettingName);
+
+// A follower importing every block vector at the CRF of the leader takes the
+// motion search of the leader as is, so it writes the same bitstream. The
+// same fields with every vector zeroed must change it, or the follower did
+// not use them.
+class MeFieldFollowerTest : public MeFieldTest {};
+
+TEST_P(MeFieldFollowerTest, MatchesLeaderAtSameCrf) {
+    config_test();
+    for (auto test_vector : enc_setting.test_vectors) {
+        const std::vector<uint8_t> leader =
+            encode_with_me_field(test_vector, "MeFieldOutFile");
+        const std::vector<uint8_t> follower =
+            encode_with_me_field(test_vector, "MeFieldInFile");
+        ASSERT_FALSE(leader.empty());
+        EXPECT_TRUE(leader == follower)
+            << "follower bitstream differs from the leader";
+
+        // init_test() does not load the fields again once the file is closed
+        ASSERT_EQ(set_enc_config(enc_config_.get(),
+                                 "MeFieldInFile",
+                                 me_field_path().c_str()),
+                  EB_ErrorNone);
+        ASSERT_EQ(load_me_fields(enc_config_.get()), EB_ErrorNone);
+        fclose(enc_config_->me_field_in_file);
+        enc_config_->me_field_in_file = nullptr;
+        for (uint64_t i = 0; i < enc_config_->me_field_count; i++) {
+            SvtAv1MeField *field = enc_config_->me_fields[i];
+            if (!field)
+                continue;
+            SvtAv1MeFieldMv *mvs = SVT_AV1_ME_FIELD_MVS(field);
+            const size_t count = (size_t)field->b64_cols * field->b64_rows *
+                                 field->ref_count * field->block_count;
+            for (size_t mv = 0; mv < count; mv++) {
+                if (mvs[mv].x != SVT_AV1_ME_FIELD_INVALID_MV) {
+                    mvs[mv].x = 0;
+                    mvs[mv].y = 0;
+                }
+            }
+        }
+        init_test(test_vector);
+        run_encode_process();
+        EXPECT_FALSE(bitstream_ == leader)
+            << "follower ignored the imported vectors";
+        deinit_test();
+        remove(me_field_path().c_str());
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SvtAv1, MeFieldFollowerTest,
+                         ::testing::Values(me_field_settings[1]),
+                         EncTestSetting::GetSettingName);
+
+// Motion vector projection tests.
+// At M10 and faster the ME of a picture waits for the motion field of its
+// nearest reference. The wait must neither hang nor make the output depend
+// on how the kernels are scheduled, with one or more threads, on the thread
+// pool or on dispatch workers.
+static std::vector<TestVideoVector> mv_projection_test_vectors = {
+    std::make_tuple("kirland_640_480_30.yuv", YUV_VIDEO_FILE, IMG_FMT_420, 640,
+                    480, 8, 0, 0, 30),
+};
+
+/* clang-format off */
+static const std::vector<EncTestSetting> mv_projection_settings = {
+    {"MvProjectionM10", {{"EncoderMode", "10"}}, mv_projection_test_vectors},
+    {"MvProjectionM12", {{"EncoderMode", "12"}}, mv_projection_test_vectors},
+};
+
+// Threading of each encode: lp, thread pool, dispatch workers
+static const std::vector<EncSetting> mv_projection_threading = {
+    {{"LevelOfParallelism", "1"}, {"ThreadPool", "0"}, {"DispatchWorkers", "0"}},
+    {{"LevelOfParallelism", "2"}, {"ThreadPool", "0"}, {"DispatchWorkers", "0"}},
+    {{"LevelOfParallelism", "2"}, {"ThreadPool", "1"}, {"DispatchWorkers", "0"}},
+    {{"LevelOfParallelism", "2"}, {"ThreadPool", "0"}, {"DispatchWorkers", "2"}},
+};
+/* clang-format on */
+
+class MvProjectionTest : public SvtAv1E2ETestFramework {
+  protected:
+    void config_test() override {
+        enable_decoder = true;
+        enable_recon = true;
+        enable_config = true;
+        SvtAv1E2ETestFramework::config_test();
+    }
+};
+
+// Every threading gives the bitstream of lp 1, and its recon matches the
+// reference decoder
+TEST_P(MvProjectionTest, SameOutputAcrossThreading) {
+    config_test();
+    for (auto test_vector : enc_setting.test_vectors) {
+        std::vector<uint8_t> reference;
+        for (const EncSetting &threading : mv_projection_threading) {
+            std::string name;
+            for (const auto &x : threading) {
+                ASSERT_EQ(set_enc_config(enc_config_.get(),
+                                         x.first.c_str(),
+                                         x.second.c_str()),
+                          EB_ErrorNone);
+                name += x.first + "=" + x.second + " ";
+            }
+            SCOPED_TRACE(name);
+            init_test(test_vector);
+            run_encode_process();
+            ASSERT_FALSE(bitstream_.empty());
+            if (reference.empty())
+                reference = bitstream_;
+            else
+                EXPECT_TRUE(bitstream_ == reference)
+                    << "output depends on the threading";
+            deinit_test();
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SvtAv1, MvProjectionTest,
+                         ::testing::ValuesIn(mv_projection_settings),
+                         EncTestSetting::GetSettingName);